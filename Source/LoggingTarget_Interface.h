@@ -50,7 +50,9 @@ public:
 
 	/**
 	 * Method to be overloaded by ancestors to act as an interface
-	 * for generic data insertion for logging
+	 * for generic data insertion for logging.
+	 * In headless engine mode this is called directly from the engine's background threads
+	 * instead of the message thread, possibly from several at once, so the implementation has to be threadsafe.
 	 */
 	virtual void AddLogData(NodeId NId, ProtocolId SenderPId, ProtocolType SenderType, RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData) = 0;
 };
@@ -35,6 +35,7 @@ Forward_only_valueChanges::Forward_only_valueChanges(ProcessingEngineNode* paren
 {
 	SetMode(ObjectHandlingMode::OHM_Forward_only_valueChanges);
 	m_precision = 0.001f;
+	m_objectValueFilters.resize(ROI_InvalidMAX);
 }
 
 /**
@@ -42,6 +43,7 @@ Forward_only_valueChanges::Forward_only_valueChanges(ProcessingEngineNode* paren
  */
 Forward_only_valueChanges::~Forward_only_valueChanges()
 {
+	stopTimerThread();
 }
 
 /**
@@ -69,6 +71,125 @@ bool Forward_only_valueChanges::setStateXml(XmlElement* stateXml)
 		m_typeBIsAcknowledging = (0 != (typeABAckMask & 0x10));
 	}
 
+	if (!ReadValueFilters(stateXml->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::VALUEFILTERS))))
+		return false;
+
+	// read the optional message budget for cached value dumps, defaults to sending a dump in one go
+	auto outputRateXmlElement = stateXml->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::OUTPUTRATE));
+	{
+		const ScopedLock l(m_currentValuesLock);
+		if (outputRateXmlElement)
+			m_cacheDumpRate = jmax(0, outputRateXmlElement->getIntAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::VALUE)));
+		else
+			m_cacheDumpRate = 0;
+		m_pendingCacheDumps.clear();
+	}
+
+	UpdateTimerThread();
+
+	return true;
+}
+
+/**
+ * Method to get the interval the timer thread is required to run at.
+ * Held back values and paced dumps only exist if any minimum interval or dump budget is configured,
+ * so the flush timer is not required otherwise. Derived classes may extend this for their own periodic tasks.
+ * @return	The interval in ms, zero if the timer thread is not required.
+ */
+int Forward_only_valueChanges::GetTimerThreadInterval()
+{
+	auto isThrottling = m_defaultMinIntervalMs > 0.0
+		|| std::any_of(m_objectValueFilters.begin(), m_objectValueFilters.end(), [](const ValueFilter& filter) { return filter.minIntervalMs > 0.0; })
+		|| std::any_of(m_channelValueFilters.begin(), m_channelValueFilters.end(), [](const std::pair<const RemoteObject, ValueFilter>& filter) { return filter.second.minIntervalMs > 0.0; });
+	auto isTimerRequired = isThrottling || m_cacheDumpRate > 0;
+
+	return isTimerRequired ? s_pendingValueFlushIntervalMs : 0;
+}
+
+/**
+ * Method to start, restart or stop the timer thread according to the currently required interval.
+ * Has to be called whenever configuration that is taken into account by GetTimerThreadInterval changes.
+ */
+void Forward_only_valueChanges::UpdateTimerThread()
+{
+	auto timerThreadInterval = GetTimerThreadInterval();
+	if (timerThreadInterval == m_timerThreadInterval && (timerThreadInterval > 0) == isTimerThreadRunning())
+		return;
+
+	if (isTimerThreadRunning())
+		stopTimerThread();
+
+	m_timerThreadInterval = timerThreadInterval;
+	if (m_timerThreadInterval > 0)
+		startTimerThread(m_timerThreadInterval);
+}
+
+/**
+ * Helper method to read the per object value filter settings from configuration.
+ * Filters are configured as child elements of ValueFilters, named as the remote object they apply to, e.g.
+ * <ValueFilters Interval="20"><MatrixInput_Gain Value="0.5" Mode="absolute" Interval="50"/><Positioning_SourcePosition_XY Value="0.002" Mode="relative" Id="3"/></ValueFilters>
+ * Value is the deadband, either absolute or relative to the value range of the object, Interval the minimum time in ms between two forwarded values.
+ * If an Id is given, the settings only apply to that channel of the object.
+ *
+ * @param valueFiltersXmlElement	The ValueFilters xml element to read the settings from. Nullptr resets all settings.
+ * @return	True if the settings were read successfully, false if an element is invalid.
+ */
+bool Forward_only_valueChanges::ReadValueFilters(XmlElement* valueFiltersXmlElement)
+{
+	const ScopedLock l(m_currentValuesLock);
+
+	m_objectValueFilters.assign(ROI_InvalidMAX, ValueFilter());
+	m_channelValueFilters.clear();
+	m_pendingValues.clear();
+	m_defaultMinIntervalMs = 0.0;
+
+	if (!valueFiltersXmlElement)
+		return true;
+
+	auto valueAttributeName = ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::VALUE);
+	auto modeAttributeName = ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::MODE);
+	auto intervalAttributeName = ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::INTERVAL);
+	auto idAttributeName = ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::ID);
+
+	m_defaultMinIntervalMs = jmax(0.0, valueFiltersXmlElement->getDoubleAttribute(intervalAttributeName, 0.0));
+
+	for (auto filterXmlElement : valueFiltersXmlElement->getChildIterator())
+	{
+		// identify the referred object by iterating over all known ones and comparing tag name
+		auto roi = ROI_Invalid;
+		for (int i = ROI_Invalid + 1; i < ROI_BridgingMAX; ++i)
+		{
+			if (filterXmlElement->getTagName() == ProcessingEngineConfig::GetObjectTagName(static_cast<RemoteObjectIdentifier>(i)))
+			{
+				roi = static_cast<RemoteObjectIdentifier>(i);
+				break;
+			}
+		}
+		if (ROI_Invalid == roi)
+			return false;
+
+		ValueFilter filter;
+		if (filterXmlElement->hasAttribute(valueAttributeName))
+		{
+			filter.isDeadbandSet = true;
+			filter.deadband = jmax(0.0f, static_cast<float>(filterXmlElement->getDoubleAttribute(valueAttributeName)));
+			// a relative deadband is given as fraction of the value range of the object
+			auto rangeLength = ProcessingEngineConfig::GetRemoteObjectRange(roi).getLength();
+			if (filterXmlElement->getStringAttribute(modeAttributeName) == "relative" && rangeLength > 0.0f)
+				filter.deadband *= rangeLength;
+		}
+		if (filterXmlElement->hasAttribute(intervalAttributeName))
+		{
+			filter.isMinIntervalSet = true;
+			filter.minIntervalMs = jmax(0.0, filterXmlElement->getDoubleAttribute(intervalAttributeName));
+		}
+
+		if (filterXmlElement->hasAttribute(idAttributeName))
+			m_channelValueFilters[RemoteObject(roi, RemoteObjectAddressing(static_cast<ChannelId>(filterXmlElement->getIntAttribute(idAttributeName)), INVALID_ADDRESS_VALUE))] = filter;
+		else
+			m_objectValueFilters.at(roi) = filter;
+	}
+
 	return true;
 }
 
@@ -90,71 +211,171 @@ bool Forward_only_valueChanges::OnReceivedMessageFromProtocol(const ProtocolId P
 	UpdateOnlineState(PId);
 
 	if (IsCachedValuesQuery(roi))
-		return SendValueCacheToProtocol(PId);
+		return SendValueCacheToProtocol(PId, msgData);
+
+	// the received message data outlives sending, so its payload does not have to be copied
+	auto outgoingMessages = OutgoingMessages(false);
+	{
+		const ScopedLock l(m_currentValuesLock);
 
-	auto isGetValueQuery = IsGetValueQuery(roi, msgData);
-	if (isGetValueQuery)
-		SetCurrentValue(PId, roi, msgData._addrVal, RemoteObjectMessageData());
+		auto isGetValueQuery = IsGetValueQuery(roi, msgData);
+		if (isGetValueQuery)
+			SetCurrentValue(PId, roi, msgData._addrVal, RemoteObjectMessageData());
+
+		// Check the incoming value against the currently cached value for the incoming protocol.
+		// The currently cached value is taken from one of the two caches, A or B, and if a change 
+		// is detected, the value in that cache is updated accordingly. 
+		// BEWARE it is not updated in the complementary other cache - that is/has to be done after successful sending
+		if (!IsChangedDataValue(PId, roi, msgData._addrVal, msgData))
+			return false;
+
+		// values of throttled objects are held back and forwarded by the flush timer, once the minimum interval has elapsed
+		if (IsValueForwardThrottled(PId, roi, msgData._addrVal, msgData, msgMeta))
+			return true;
+
+		if (!CollectValueChange(PId, roi, msgData, msgMeta, isGetValueQuery, outgoingMessages))
+			return false;
+	}
 
-	// Check the incoming value against the currently cached value for the incoming protocol.
-	// The currently cached value is taken from one of the two caches, A or B, and if a change 
-	// is detected, the value in that cache is updated accordingly. 
-	// BEWARE it is not updated in the complementary other cache - that is/has to be done after successful sending
-	if (!IsChangedDataValue(PId, roi, msgData._addrVal, msgData))
+	return SendOutgoingMessages(outgoingMessages);
+}
+
+/**
+ * Method to collect the messages to forward a changed value received from a protocol to all protocols of the complementary role.
+ * The lock has to be held by the caller, the collected messages are to be sent once it is released.
+ *
+ * @param PId				The id of the protocol that received the data
+ * @param roi				The object id to send a message for
+ * @param msgData			The actual message value/content data
+ * @param msgMeta			The meta information on the message data that was received
+ * @param isGetValueQuery	Bool indication if the message is a value query
+ * @param outgoingMessages	The messages to add the messages to forward the value to.
+ * @return	True if the value is to be forwarded, false if the protocol is unknown
+ */
+bool Forward_only_valueChanges::CollectValueChange(const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, const RemoteObjectMessageMetaInfo& msgMeta, bool isGetValueQuery, OutgoingMessages& outgoingMessages)
+{
+	auto isTypeA = (std::find(GetProtocolAIds().begin(), GetProtocolAIds().end(), PId) != GetProtocolAIds().end());
+	auto isTypeB = !isTypeA && (std::find(GetProtocolBIds().begin(), GetProtocolBIds().end(), PId) != GetProtocolBIds().end());
+	if (!isTypeA && !isTypeB)
 		return false;
 
-	if (std::find(GetProtocolAIds().begin(), GetProtocolAIds().end(), PId) != GetProtocolAIds().end())
+	// Send to all protocols of the complementary type
+	auto const& targetPIds = isTypeA ? GetProtocolBIds() : GetProtocolAIds();
+	auto isTargetAcknowledging = isTypeA ? IsTypeBAcknowledging() : IsTypeAAcknowledging();
+	for (auto const& targetPId : targetPIds)
 	{
-		// Send to all typeB protocols
-		auto overallSendSuccess = true;
-		for (auto const& protocolB : GetProtocolBIds())
+		if (msgMeta._ExternalId != targetPId || msgMeta._Category != RemoteObjectMessageMetaInfo::MC_SetMessageAcknowledgement)
 		{
-			if (msgMeta._ExternalId != protocolB || msgMeta._Category != RemoteObjectMessageMetaInfo::MC_SetMessageAcknowledgement)
+			// sending is only done when the value about to be sent is differing from the last known value from the protocol in question
+			if (IsChangedDataValue(targetPId, roi, msgData._addrVal, msgData, false))
 			{
-				// sending is only done when the value about to be sent is differing from the last known value from the protocol in question
-				if (IsChangedDataValue(protocolB, roi, msgData._addrVal, msgData, false))
-				{
-					auto sendSuccess = parentNode->SendMessageTo(protocolB, roi, msgData);
-					// If the value was sent successfully, save it to cache (to make it the 'last known' from this protocol).
-					// In case the protocol is expected to acknowledge the value, we make an exception, since acknowledge values are
-					// used to update bridged protocols that have not yet received that latest value. E.g. DS100 ack values that are a
-					// reaction on a GenericOSC SET have to be bridged back to connected DiGiCo.
-					if ((sendSuccess && !IsTypeBAcknowledging()) || isGetValueQuery)
-						SetCurrentValue(protocolB, roi, msgData._addrVal, msgData); // set the updated value as current for the complementary cache as well
-					overallSendSuccess = sendSuccess && overallSendSuccess;
-				}
+				// If the value was sent successfully, save it to cache (to make it the 'last known' from this protocol).
+				// In case the protocol is expected to acknowledge the value, we make an exception, since acknowledge values are
+				// used to update bridged protocols that have not yet received that latest value. E.g. DS100 ack values that are a
+				// reaction on a GenericOSC SET have to be bridged back to connected DiGiCo.
+				if (isGetValueQuery)
+					SetCurrentValue(targetPId, roi, msgData._addrVal, msgData); // set the updated value as current for the complementary cache as well
+				AddOutgoingMessage(outgoingMessages, targetPId, roi, msgData, !isTargetAcknowledging && !isGetValueQuery);
 			}
 		}
+	}
+
+	return true;
+}
+
+/**
+ * Constructor of the message to a protocol collected while the current values lock is held.
+ *
+ * @param targetPId				The id of the protocol to send the message to.
+ * @param objectId				The object id to send the message for.
+ * @param data					The message data to send.
+ * @param copyPayload			Bool indication if the payload has to be copied, since it does not outlive the lock.
+ * @param setAsCurrentOnSuccess	Bool indication if the value is to be set as current value of the target protocol once it was sent successfully.
+ */
+Forward_only_valueChanges::OutgoingMessage::OutgoingMessage(const ProtocolId targetPId, const RemoteObjectIdentifier objectId, const RemoteObjectMessageData& data, bool copyPayload, bool setAsCurrentOnSuccess)
+	: PId(targetPId), roi(objectId), isSetAsCurrentOnSuccess(setAsCurrentOnSuccess)
+{
+	if (copyPayload)
+		msgData.payloadCopy(data);
+	else
+		msgData = data;
+}
 
-		return overallSendSuccess;
+/**
+ * Copy constructor, required to copy owned payloads when the collected messages are relocated,
+ * since the message data itself only copies the reference to the payload.
+ *
+ * @param other	The message to copy.
+ */
+Forward_only_valueChanges::OutgoingMessage::OutgoingMessage(const OutgoingMessage& other)
+	: PId(other.PId), roi(other.roi), isSetAsCurrentOnSuccess(other.isSetAsCurrentOnSuccess), isSent(other.isSent)
+{
+	if (other.msgData._payloadOwned)
+		msgData.payloadCopy(other.msgData);
+	else
+		msgData = other.msgData;
+}
+
+/**
+ * Helper method to add a message to the collected messages. The lock has to be held by the caller.
+ *
+ * @param outgoingMessages		The messages to add to.
+ * @param PId					The id of the protocol to send the message to.
+ * @param roi					The object id to send the message for.
+ * @param msgData				The message data to send.
+ * @param setAsCurrentOnSuccess	Bool indication if the value is to be set as current value of the protocol once it was sent successfully.
+ */
+void Forward_only_valueChanges::AddOutgoingMessage(OutgoingMessages& outgoingMessages, const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, bool setAsCurrentOnSuccess)
+{
+	outgoingMessages.messages.emplace_back(PId, roi, msgData, outgoingMessages.isPayloadCopied, setAsCurrentOnSuccess);
+}
+
+/**
+ * Helper method to send the collected messages. The lock must not be held by the caller,
+ * to not block protocol and timer threads while sending. It is only taken again afterwards to set the
+ * successfully sent values as current values of their protocols, where required.
+ *
+ * @param outgoingMessages	The messages to send.
+ * @return	True if all messages were sent successfully, false if not
+ */
+bool Forward_only_valueChanges::SendOutgoingMessages(OutgoingMessages& outgoingMessages)
+{
+	auto overallSendSuccess = true;
+	auto isSetAsCurrentRequired = false;
+	for (auto& outgoingMessage : outgoingMessages.messages)
+	{
+		outgoingMessage.isSent = SendOutgoingMessage(outgoingMessage);
+		isSetAsCurrentRequired = isSetAsCurrentRequired || (outgoingMessage.isSent && outgoingMessage.isSetAsCurrentOnSuccess);
+		overallSendSuccess = outgoingMessage.isSent && overallSendSuccess;
 	}
-	else if (std::find(GetProtocolBIds().begin(), GetProtocolBIds().end(), PId) != GetProtocolBIds().end())
+
+	if (isSetAsCurrentRequired)
 	{
-		// Send to all typeA protocols
-		auto overallSendSuccess = true;
-		for (auto const& protocolA : GetProtocolAIds())
+		const ScopedLock l(m_currentValuesLock);
+		for (auto const& outgoingMessage : outgoingMessages.messages)
 		{
-			if (msgMeta._ExternalId != protocolA || msgMeta._Category != RemoteObjectMessageMetaInfo::MC_SetMessageAcknowledgement)
-			{
-				// sending is only done when the value about to be sent is differing from the last known value from the protocol in question
-				if (IsChangedDataValue(protocolA, roi, msgData._addrVal, msgData, false))
-				{
-					auto sendSuccess = parentNode->SendMessageTo(protocolA, roi, msgData);
-					// If the value was sent successfully, save it to cache (to make it the 'last known' from this protocol).
-					// In case the protocol is expected to acknowledge the value, we make an exception, since acknowledge values are
-					// used to update bridged protocols that have not yet received that latest value. E.g. DS100 ack values that are a
-					// reaction on a GenericOSC SET have to be bridged back to connected DiGiCo.
-					if ((sendSuccess && !IsTypeAAcknowledging()) || isGetValueQuery)
-						SetCurrentValue(protocolA, roi, msgData._addrVal, msgData); // set the updated value as current for the complementary cache as well
-					overallSendSuccess = sendSuccess && overallSendSuccess;
-				}
-			}
+			if (outgoingMessage.isSent && outgoingMessage.isSetAsCurrentOnSuccess)
+				SetCurrentValue(outgoingMessage.PId, outgoingMessage.roi, outgoingMessage.msgData._addrVal, outgoingMessage.msgData);
 		}
-
-		return overallSendSuccess;
 	}
-	else
+
+	return overallSendSuccess;
+}
+
+/**
+ * Method to send a single collected message via the parent node.
+ * Can be reimplemented to capture the messages instead, e.g. to test the data handling without a node.
+ *
+ * @param outgoingMessage	The message to send.
+ * @return	True if the message was sent successfully, false if not
+ */
+bool Forward_only_valueChanges::SendOutgoingMessage(const OutgoingMessage& outgoingMessage)
+{
+	const ProcessingEngineNode* parentNode = ObjectDataHandling_Abstract::GetParentNode();
+	if (!parentNode)
 		return false;
+
+	return parentNode->SendMessageTo(outgoingMessage.PId, outgoingMessage.roi, outgoingMessage.msgData);
 }
 
 /**
@@ -175,86 +396,16 @@ bool Forward_only_valueChanges::IsChangedDataValue(const ProtocolId PId, const R
 	if (IsKeepaliveObject(roi))
 		return true;
     
-	if (m_precision == 0)
-		return true;
-
-	auto isChangedDataValue = false;
-    
-    // verify the protocol in question has a set of cached values
-	if (1 != m_currentValues.count(PId))
-		isChangedDataValue = true;
-    
-    // Depending on what protocol received the value, use the corresponding value cache for the protocol type
-	auto& currentValues = m_currentValues[PId];
-
-	// if our hash does not yet contain our ROI, initialize it
-	if ((currentValues.count(roi) == 0) || (currentValues.at(roi).count(roAddr) == 0))
-	{
-		isChangedDataValue = true;
-	}
-	else
+	// without deadband every value is regarded as changed, but it still is stored
+	// as current value, e.g. for the minimum interval throttling to forward it later on
+	auto deadband = GetValueDeadband(roi, roAddr);
+	auto isChangedDataValue = true;
+	if (deadband != 0)
 	{
-		const RemoteObjectMessageData& currentVal = currentValues.at(roi).at(roAddr);
-		if ((currentVal._valType != msgData._valType) || (currentVal._valCount != msgData._valCount) || (currentVal._payloadSize != msgData._payloadSize))
-		{
-			isChangedDataValue = true;
-		}
-		else
-		{
-			uint16 valCount = currentVal._valCount;
-			RemoteObjectValueType valType = currentVal._valType;
-			auto refData = currentVal._payload;
-			auto newData = msgData._payload;
-			
-			for (int i = 0; i < valCount; ++i)
-			{
-				switch (valType)
-				{
-				case ROVT_INT:
-					{
-					// convert payload to correct pointer type
-					auto refValPtr = static_cast<int*>(refData);
-					auto newValPtr = static_cast<int*>(newData);
-					// grab actual value
-					auto referenceValue = *refValPtr;
-					auto newValue = *newValPtr;
-					// increase pointer to next value (to access it in next valCount loop iteration)
-					refData = refValPtr +1;
-					newData = newValPtr +1;
-					// if integer values differ, precision is irrelevant
-					isChangedDataValue = isChangedDataValue || (referenceValue != newValue);
-					}
-					break;
-				case ROVT_FLOAT:
-					{
-					// convert payload to correct pointer type
-					auto refValPtr = static_cast<float*>(refData);
-					auto newValPtr = static_cast<float*>(newData);
-					// grab actual value and apply precision to get a comparable value
-					auto referenceValue = *refValPtr;
-					auto newValue		= *newValPtr;
-					auto valueDifference = referenceValue - newValue;
-					// increase pointer to next value (to access it in next valCount loop iteration)
-					refData = refValPtr +1;
-					newData = newValPtr +1;
-					// if the float difference is up to equal of the configured precision, no change is signaled
-					isChangedDataValue = isChangedDataValue || (std::fabs(valueDifference) > m_precision);
-					}
-					break;
-				case ROVT_STRING:
-					{
-					auto refVal = String(static_cast<char*>(currentVal._payload), currentVal._payloadSize);
-					auto newVal = String(static_cast<char*>(msgData._payload), msgData._payloadSize);
-					isChangedDataValue = isChangedDataValue || (refVal != newVal);
-					}
-					break;
-				case ROVT_NONE:
-				default:
-					isChangedDataValue = true;
-					break;
-				}
-			}
-		}
+		// a value is regarded as changed if none is known yet for the protocol and addressing
+		auto valueStore = GetValueStore(PId, roi, false);
+		auto slot = valueStore ? valueStore->FindSlot(roAddr) : -1;
+		isChangedDataValue = (slot < 0) || valueStore->IsChangedValue(slot, msgData, deadband);
 	}
 
 	if (isChangedDataValue && setAsNewCurrentData)
@@ -265,7 +416,7 @@ bool Forward_only_valueChanges::IsChangedDataValue(const ProtocolId PId, const R
 
 /**
  * Helper method to set a new RemoteObjectMessageData obj. to internal map of current values.
- * Takes care of cleaning up previously stored data if required.
+ * The value is copied into the value store, previously stored data is reused if possible.
  *
  * @param PId                The id of the protocol that received the value to check for if it differs from currently cached one.
  * @param roi		The ROI that shall be stored
@@ -277,27 +428,227 @@ void Forward_only_valueChanges::SetCurrentValue(const ProtocolId PId, const Remo
 	if (IsKeepaliveObject(roi))
 		return;
 
-	// Depending on what protocol received the value, use the corresponding value cache for the protocol type
-	auto& currentValues = m_currentValues[PId];
-    
-	// Check if the new data value addressing is currently not present in internal hash
-	// or if it differs in its value size and needs to be reinitialized
-	if ((currentValues.count(roi) == 0) || (currentValues.at(roi).count(roAddr) == 0) ||
-		(currentValues.at(roi).at(roAddr)._payloadSize != msgData._payloadSize))
+	// Depending on what protocol received the value, use the corresponding value store for the protocol type
+	auto valueStore = GetValueStore(PId, roi, true);
+	if (!valueStore)
+		return;
+
+	// every value set gets a new version, to be able to dump only the values changed since a given version.
+	// On overflow versions restart, older values then are regarded as newer, which only leads to too many values being dumped.
+	if (m_currentValueVersion == std::numeric_limits<int>::max())
+		m_currentValueVersion = 0;
+
+	auto slot = valueStore->GetOrCreateSlot(roAddr);
+	valueStore->SetValue(slot, msgData);
+	valueStore->SetVersion(slot, ++m_currentValueVersion);
+}
+
+/**
+ * Helper method to check if forwarding a changed value has to be held back, because the minimum interval
+ * configured for the object has not yet elapsed since the last value was forwarded.
+ * Held back values are forwarded by the flush timer once the interval has elapsed, using the value that is current
+ * at that time, so intermediate values are dropped but the last value always arrives.
+ *
+ * @param PId		The id of the protocol that received the value.
+ * @param roi		The ROI that was received
+ * @param roAddr	The remote object addressing the value is stored for
+ * @param msgData	The received message data
+ * @param msgMeta	The meta information on the received message data
+ * @return	True if the value is held back and must not be forwarded now, false if it is to be forwarded.
+ */
+bool Forward_only_valueChanges::IsValueForwardThrottled(const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectAddressing& roAddr, const RemoteObjectMessageData& msgData, const RemoteObjectMessageMetaInfo& msgMeta)
+{
+	if (IsGetValueQuery(roi, msgData))
+		return false;
+	if (IsKeepaliveObject(roi))
+		return false;
+
+	auto minIntervalMs = GetValueMinInterval(roi, roAddr);
+	if (minIntervalMs <= 0.0)
+		return false;
+
+	auto valueStore = GetValueStore(PId, roi, true);
+	if (!valueStore)
+		return false;
+
+	auto slot = valueStore->GetOrCreateSlot(roAddr);
+	auto nowMs = Time::getMillisecondCounterHiRes();
+	auto dueTimeMs = valueStore->GetForwardTime(slot) + minIntervalMs;
+	auto pendingValueKey = std::make_pair(PId, RemoteObject(roi, roAddr));
+
+	if (nowMs >= dueTimeMs)
 	{
-		// If the data value exists, but has wrong size, reinitialize it
-        currentValues[roi][roAddr].payloadCopy(msgData);
+		m_pendingValues.erase(pendingValueKey);
+		valueStore->SetForwardTime(slot, nowMs);
+		return false;
 	}
-	else
+
+	m_pendingValues[pendingValueKey] = { msgData._addrVal, msgMeta, dueTimeMs };
+	return true;
+}
+
+/**
+ * Reimplemented from TimerThreadBase to forward the held back values that are due
+ * and to send the next part of paced cached value dumps.
+ */
+void Forward_only_valueChanges::timerThreadCallback()
+{
+	// the due values and dumped values are taken from the value stores, so their payloads have to be copied to outlive the lock
+	auto outgoingMessages = OutgoingMessages(true);
+	{
+		const ScopedLock l(m_currentValuesLock);
+
+		CollectDueValues(outgoingMessages);
+		CollectPendingCacheDumps(outgoingMessages);
+	}
+
+	SendOutgoingMessages(outgoingMessages);
+}
+
+/**
+ * Helper method to collect the messages to forward the values held back due to minimum interval throttling, that are due.
+ * The lock has to be held by the caller, the collected messages are to be sent once it is released.
+ * @param	outgoingMessages	The messages to add the messages to forward the due values to. Have to copy the payloads.
+ */
+void Forward_only_valueChanges::CollectDueValues(OutgoingMessages& outgoingMessages)
+{
+	if (m_pendingValues.empty())
+		return;
+
+	// collect the due values first, since forwarding might modify the held back values
+	auto nowMs = Time::getMillisecondCounterHiRes();
+	std::vector<std::pair<std::pair<ProtocolId, RemoteObject>, PendingValue>> dueValues;
+	for (auto pendingValuesIter = m_pendingValues.begin(); pendingValuesIter != m_pendingValues.end(); )
+	{
+		if (pendingValuesIter->second.dueTimeMs <= nowMs)
+		{
+			dueValues.push_back(*pendingValuesIter);
+			pendingValuesIter = m_pendingValues.erase(pendingValuesIter);
+		}
+		else
+			++pendingValuesIter;
+	}
+
+	for (auto const& dueValue : dueValues)
 	{
-		// do not copy entire data struct, since we need to keep our payload ptr
-        currentValues.at(roi).at(roAddr)._addrVal = roAddr;
-        currentValues.at(roi).at(roAddr)._valCount = msgData._valCount;
-        currentValues.at(roi).at(roAddr)._valType = msgData._valType;
-		memcpy(currentValues.at(roi).at(roAddr)._payload, msgData._payload, msgData._payloadSize);
+		auto const& PId = dueValue.first.first;
+		auto const& remoteObject = dueValue.first.second;
+
+		auto valueStore = GetValueStore(PId, remoteObject._Id, false);
+		auto slot = valueStore ? valueStore->FindSlot(remoteObject._Addr) : -1;
+		if (slot < 0)
+			continue;
+
+		// a slot without a stored value must not be forwarded, since receivers would take it for a value query
+		auto const& currentValue = valueStore->GetValue(slot);
+		if (currentValue._valType == ROVT_NONE)
+			continue;
+
+		// forward the current value addressed as originally received
+		auto msgData = currentValue;
+		msgData._addrVal = dueValue.second.msgAddr;
+		valueStore->SetForwardTime(slot, nowMs);
+
+		CollectValueChange(PId, remoteObject._Id, msgData, dueValue.second.msgMeta, false, outgoingMessages);
 	}
 }
 
+/**
+ * Helper method to get the value filter settings configured for a single channel of a remote object.
+ *
+ * @param roi		The ROI to get the settings for.
+ * @param roAddr	The remote object addressing to get the settings for.
+ * @return	The settings or nullptr if none are configured for the channel.
+ */
+const Forward_only_valueChanges::ValueFilter* Forward_only_valueChanges::GetChannelValueFilter(const RemoteObjectIdentifier roi, const RemoteObjectAddressing& roAddr)
+{
+	if (m_channelValueFilters.empty())
+		return nullptr;
+
+	auto channelValueFilterIter = m_channelValueFilters.find(RemoteObject(roi, RemoteObjectAddressing(roAddr._first, INVALID_ADDRESS_VALUE)));
+	if (channelValueFilterIter == m_channelValueFilters.end())
+		return nullptr;
+
+	return &channelValueFilterIter->second;
+}
+
+/**
+ * Getter for the deadband to use for the values of a remote object.
+ * Settings for the channel take precedence over settings for the object, the global precision is used if neither is configured.
+ *
+ * @param roi		The ROI to get the deadband for.
+ * @param roAddr	The remote object addressing to get the deadband for.
+ * @return	The absolute deadband.
+ */
+float Forward_only_valueChanges::GetValueDeadband(const RemoteObjectIdentifier roi, const RemoteObjectAddressing& roAddr)
+{
+	auto channelValueFilter = GetChannelValueFilter(roi, roAddr);
+	if (channelValueFilter && channelValueFilter->isDeadbandSet)
+		return channelValueFilter->deadband;
+
+	if (roi >= 0 && roi < static_cast<int>(m_objectValueFilters.size()) && m_objectValueFilters[roi].isDeadbandSet)
+		return m_objectValueFilters[roi].deadband;
+
+	return m_precision;
+}
+
+/**
+ * Getter for the minimum interval between two forwarded values of a remote object.
+ * Settings for the channel take precedence over settings for the object, the default interval is used if neither is configured.
+ *
+ * @param roi		The ROI to get the minimum interval for.
+ * @param roAddr	The remote object addressing to get the minimum interval for.
+ * @return	The minimum interval in ms, zero if values are not throttled.
+ */
+double Forward_only_valueChanges::GetValueMinInterval(const RemoteObjectIdentifier roi, const RemoteObjectAddressing& roAddr)
+{
+	auto channelValueFilter = GetChannelValueFilter(roi, roAddr);
+	if (channelValueFilter && channelValueFilter->isMinIntervalSet)
+		return channelValueFilter->minIntervalMs;
+
+	if (roi >= 0 && roi < static_cast<int>(m_objectValueFilters.size()) && m_objectValueFilters[roi].isMinIntervalSet)
+		return m_objectValueFilters[roi].minIntervalMs;
+
+	return m_defaultMinIntervalMs;
+}
+
+/**
+ * Getter for the lock protecting the value stores, to be held by derived objects while processing received values.
+ * @return	The lock.
+ */
+CriticalSection& Forward_only_valueChanges::GetCurrentValuesLock()
+{
+	return m_currentValuesLock;
+}
+
+/**
+ * Helper method to get the store of current values for a protocol and remote object.
+ *
+ * @param PId				The id of the protocol to get the value store for.
+ * @param roi				The ROI to get the value store for.
+ * @param createIfMissing	Bool indication if the value store shall be created if it does not exist yet.
+ * @return	The value store or nullptr if it does not exist (and was not to be created) or the ROI is invalid.
+ */
+ObjectValueStore* Forward_only_valueChanges::GetValueStore(const ProtocolId PId, const RemoteObjectIdentifier roi, bool createIfMissing)
+{
+	if (roi < 0 || roi >= ROI_InvalidMAX)
+		return nullptr;
+
+	auto protocolValueStoresIter = m_currentValues.find(PId);
+	if (protocolValueStoresIter == m_currentValues.end())
+	{
+		if (!createIfMissing)
+			return nullptr;
+		protocolValueStoresIter = m_currentValues.insert(std::make_pair(PId, std::vector<std::unique_ptr<ObjectValueStore>>(ROI_InvalidMAX))).first;
+	}
+
+	auto& valueStore = protocolValueStoresIter->second.at(roi);
+	if (!valueStore && createIfMissing)
+		valueStore = std::make_unique<ObjectValueStore>();
+
+	return valueStore.get();
+}
+
 /**
  * Getter for the private precision value
  * @return	The internal precision value.
@@ -328,24 +679,211 @@ bool Forward_only_valueChanges::IsCachedValuesQuery(const RemoteObjectIdentifier
 
 /**
  * Sends the contents of internal value cache to the specified protocol via parent listener.
- * @param	PId	The id of the protocol to send the value cache contents to.
- * @param	Bool on success, false if some error occured (params invalid, sending failed...)
+ * The query may carry the version that was replied to the last query as single int value. In that case only
+ * the values changed since that version are sent, followed by a query reply with the current version.
+ * If a message budget is configured, the values are sent paced by the flush timer instead of in one go.
+ * The lock must not be held by the caller, since the values are sent once it is released.
+ * @param	PId				The id of the protocol to send the value cache contents to.
+ * @param	queryMsgData	The message data of the query.
+ * @return	Bool on success, false if some error occured (params invalid, sending failed...)
  */
-bool Forward_only_valueChanges::SendValueCacheToProtocol(const ProtocolId PId)
+bool Forward_only_valueChanges::SendValueCacheToProtocol(const ProtocolId PId, const RemoteObjectMessageData& queryMsgData)
 {
 	const ProcessingEngineNode* parentNode = ObjectDataHandling_Abstract::GetParentNode();
 	if (!parentNode)
 		return false;
 
-	// verify the protocol in question has a set of cached values
-	if (1 != m_currentValues.count(PId))
+	// the values are taken from the value stores, so their payloads have to be copied to outlive the lock
+	auto outgoingMessages = OutgoingMessages(true);
+	auto collectSuccess = true;
+	{
+		const ScopedLock l(m_currentValuesLock);
+
+		// verify the protocol in question has a set of cached values
+		if (1 != m_currentValues.count(PId))
+			return false;
+
+		auto cacheDump = CreateCacheDump(PId, queryMsgData);
+
+		// a paced dump replaces one that is still pending for the protocol, since it contains all its values as well
+		if (m_cacheDumpRate > 0)
+		{
+			m_pendingCacheDumps[PId] = std::move(cacheDump);
+			return true;
+		}
+
+		outgoingMessages.messages.reserve(cacheDump.objects.size() + 1);
+		for (auto const& remoteObject : cacheDump.objects)
+			collectSuccess = CollectCachedValue(outgoingMessages, PId, remoteObject) && collectSuccess;
+		if (cacheDump.isVersionedQuery)
+			CollectCachedValuesVersion(outgoingMessages, PId, cacheDump.version);
+	}
+
+	return SendOutgoingMessages(outgoingMessages) && collectSuccess;
+}
+
+/**
+ * Helper method to create the dump of the values cached for a protocol, requested by a cached values query.
+ * The lock has to be held by the caller.
+ * @param	PId				The id of the protocol to dump the value cache contents of.
+ * @param	queryMsgData	The message data of the query.
+ * @return	The dump, containing the objects to send the cached values of.
+ */
+Forward_only_valueChanges::PendingCacheDump Forward_only_valueChanges::CreateCacheDump(const ProtocolId PId, const RemoteObjectMessageData& queryMsgData)
+{
+	// versions newer than the current one are not known (e.g. from before a restart), so all values are sent in that case
+	auto isVersionedQuery = (queryMsgData._valType == ROVT_INT && queryMsgData._valCount == 1 && queryMsgData._payload != nullptr && queryMsgData._payloadSize == sizeof(int));
+	auto sinceVersion = isVersionedQuery ? *static_cast<int*>(queryMsgData._payload) : 0;
+	if (sinceVersion < 0 || sinceVersion > m_currentValueVersion)
+		sinceVersion = 0;
+
+	auto cacheDump = PendingCacheDump();
+	cacheDump.version = m_currentValueVersion;
+	cacheDump.isVersionedQuery = isVersionedQuery;
+
+	auto const& valueStores = m_currentValues.at(PId);
+	for (int roi = 0; roi < static_cast<int>(valueStores.size()); roi++)
+	{
+		auto valueStore = valueStores.at(roi).get();
+		if (!valueStore)
+			continue;
+		for (int slot = 0; slot < valueStore->GetSlotCount(); slot++)
+		{
+			if (valueStore->GetVersion(slot) > sinceVersion)
+				cacheDump.objects.push_back(RemoteObject(static_cast<RemoteObjectIdentifier>(roi), valueStore->GetValue(slot)._addrVal));
+		}
+	}
+
+	return cacheDump;
+}
+
+/**
+ * Method to collect the messages to send the values cached for one protocol that were set since the given version to another protocol,
+ * if they differ from the values last known from the other protocol. Can be used to bring a protocol up to date
+ * that missed value changes, e.g. since values were sent to a different protocol in the meantime.
+ * The lock has to be held by the caller, the collected messages are to be sent once it is released.
+ * @param	sourcePId			The id of the protocol to take the cached values from.
+ * @param	targetPId			The id of the protocol to send the values to.
+ * @param	sinceVersion		The value version to send the values set later than.
+ * @param	outgoingMessages	The messages to add the values to. Have to copy the payloads.
+ * @return	True on success, false if no values are cached for the source protocol.
+ */
+bool Forward_only_valueChanges::CollectCachedValuesReplay(const ProtocolId sourcePId, const ProtocolId targetPId, int sinceVersion, OutgoingMessages& outgoingMessages)
+{
+	if (1 != m_currentValues.count(sourcePId))
+		return false;
+
+	auto isTargetTypeA = (std::find(GetProtocolAIds().begin(), GetProtocolAIds().end(), targetPId) != GetProtocolAIds().end());
+	auto isTargetAcknowledging = isTargetTypeA ? IsTypeAAcknowledging() : IsTypeBAcknowledging();
+
+	auto const& valueStores = m_currentValues.at(sourcePId);
+	for (int roi = 0; roi < static_cast<int>(valueStores.size()); roi++)
+	{
+		auto valueStore = valueStores.at(roi).get();
+		if (!valueStore)
+			continue;
+		for (int slot = 0; slot < valueStore->GetSlotCount(); slot++)
+		{
+			// slots only holding a value query do not have a value to replay
+			auto value = valueStore->GetValue(slot);
+			if (valueStore->GetVersion(slot) <= sinceVersion || value._valType == ROVT_NONE)
+				continue;
+
+			auto objectId = static_cast<RemoteObjectIdentifier>(roi);
+			if (!IsChangedDataValue(targetPId, objectId, value._addrVal, value, false))
+				continue;
+
+			AddOutgoingMessage(outgoingMessages, targetPId, objectId, value, !isTargetAcknowledging);
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Getter for the version given to the last value set to any value store.
+ * @return	The current value version.
+ */
+int Forward_only_valueChanges::GetCurrentValueVersion()
+{
+	const ScopedLock l(m_currentValuesLock);
+	return m_currentValueVersion;
+}
+
+/**
+ * Helper method to collect the next part of the pending paced cached value dumps, within the configured message budget.
+ * Protocols with a pending dump are served in turns. The lock has to be held by the caller, the collected messages are to be sent once it is released.
+ * @param	outgoingMessages	The messages to add the dumped values to. Have to copy the payloads.
+ */
+void Forward_only_valueChanges::CollectPendingCacheDumps(OutgoingMessages& outgoingMessages)
+{
+	auto nowMs = Time::getMillisecondCounterHiRes();
+	if (m_pendingCacheDumps.empty())
+	{
+		m_cacheDumpAllowance = 0.0;
+		m_lastCacheDumpTimeMs = nowMs;
+		return;
+	}
+
+	// the allowance is limited to what one timer interval permits, so a delayed timer does not lead to a burst
+	auto maxAllowance = jmax(1.0, s_pendingValueFlushIntervalMs * m_cacheDumpRate / 1000.0);
+	m_cacheDumpAllowance = jmin(maxAllowance, m_cacheDumpAllowance + (nowMs - m_lastCacheDumpTimeMs) * m_cacheDumpRate / 1000.0);
+	m_lastCacheDumpTimeMs = nowMs;
+
+	while (m_cacheDumpAllowance >= 1.0 && !m_pendingCacheDumps.empty())
+	{
+		for (auto pendingCacheDumpsIter = m_pendingCacheDumps.begin(); pendingCacheDumpsIter != m_pendingCacheDumps.end() && m_cacheDumpAllowance >= 1.0; )
+		{
+			auto PId = pendingCacheDumpsIter->first;
+			auto& cacheDump = pendingCacheDumpsIter->second;
+
+			if (cacheDump.nextObjectIndex < cacheDump.objects.size())
+			{
+				CollectCachedValue(outgoingMessages, PId, cacheDump.objects.at(cacheDump.nextObjectIndex++));
+				m_cacheDumpAllowance -= 1.0;
+			}
+
+			if (cacheDump.nextObjectIndex >= cacheDump.objects.size())
+			{
+				if (cacheDump.isVersionedQuery)
+					CollectCachedValuesVersion(outgoingMessages, PId, cacheDump.version);
+				pendingCacheDumpsIter = m_pendingCacheDumps.erase(pendingCacheDumpsIter);
+			}
+			else
+				++pendingCacheDumpsIter;
+		}
+	}
+}
+
+/**
+ * Helper method to collect the message to send the value currently cached for a remote object to a protocol.
+ * The lock has to be held by the caller.
+ * @param	outgoingMessages	The messages to add the value to. Have to copy the payloads.
+ * @param	PId					The id of the protocol to send the value to, also the protocol the value is cached for.
+ * @param	remoteObject		The remote object to send the value for, addressed as in value store.
+ * @return	True on success, false if no value is cached.
+ */
+bool Forward_only_valueChanges::CollectCachedValue(OutgoingMessages& outgoingMessages, const ProtocolId PId, const RemoteObject& remoteObject)
+{
+	auto valueStore = GetValueStore(PId, remoteObject._Id, false);
+	auto slot = valueStore ? valueStore->FindSlot(remoteObject._Addr) : -1;
+	if (slot < 0)
 		return false;
 
-    auto sendSuccess = true;
-    for (auto const& cachedValue : m_currentValues.at(PId))
-        for (auto const& cachedValueObject : cachedValue.second)
-            sendSuccess = sendSuccess && parentNode->SendMessageTo(PId, cachedValue.first, cachedValueObject.second);
-    return sendSuccess;
+	AddOutgoingMessage(outgoingMessages, PId, remoteObject._Id, valueStore->GetValue(slot));
+	return true;
+}
+
+/**
+ * Helper method to collect the reply to a versioned cached values query with the version the sent values represent.
+ * The querying client can use it in its next query to only get the values changed since.
+ * @param	outgoingMessages	The messages to add the version to. Have to copy the payloads.
+ * @param	PId					The id of the protocol to send the version to.
+ * @param	version				The version to send.
+ */
+void Forward_only_valueChanges::CollectCachedValuesVersion(OutgoingMessages& outgoingMessages, const ProtocolId PId, int version)
+{
+	AddOutgoingMessage(outgoingMessages, PId, ROI_RemoteProtocolBridge_GetAllKnownValues, RemoteObjectMessageData(RemoteObjectAddressing(), ROVT_INT, 1, &version, sizeof(int)));
 }
 
 /**
@@ -19,8 +19,10 @@
 #pragma once
 
 #include "../ObjectDataHandling_Abstract.h"
+#include "ObjectValueStore.h"
 #include "../../../RemoteProtocolBridgeCommon.h"
 #include "../../ProcessingEngineConfig.h"
+#include "../../TimerThreadBase.h"
 
 #include <JuceHeader.h>
 
@@ -29,8 +31,10 @@ class ProcessingEngineNode;
 
 /**
  * Class Forward_only_valueChanges is a class for filtering received value data to only forward changed values.
+ * A value is regarded as changed if it differs by more than the deadband configured for the object (or the global precision),
+ * changed values of objects with a minimum interval configured are held back and forwarded as the last value once the interval has elapsed.
  */
-class Forward_only_valueChanges : public ObjectDataHandling_Abstract
+class Forward_only_valueChanges : public ObjectDataHandling_Abstract, public TimerThreadBase
 {
 public:
 	Forward_only_valueChanges(ProcessingEngineNode* parentNode);
@@ -40,23 +44,126 @@ public:
 
 	bool OnReceivedMessageFromProtocol(const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, const RemoteObjectMessageMetaInfo& msgMeta) override;
 
-	const std::map<ProtocolId, std::map<RemoteObjectIdentifier, std::map<RemoteObjectAddressing, RemoteObjectMessageData>>>& GetCurrentValues() { return m_currentValues; };
-
 protected:
+	/**
+	 * A message to a protocol, collected while the current values lock is held, to be sent once the lock is released.
+	 */
+	struct OutgoingMessage
+	{
+		OutgoingMessage(const ProtocolId targetPId, const RemoteObjectIdentifier objectId, const RemoteObjectMessageData& data, bool copyPayload, bool setAsCurrentOnSuccess);
+		OutgoingMessage(const OutgoingMessage& other);
+		OutgoingMessage& operator=(const OutgoingMessage& other) = delete;
+
+		ProtocolId				PId;						/**< The id of the protocol to send the message to. */
+		RemoteObjectIdentifier	roi;						/**< The object id to send the message for. */
+		RemoteObjectMessageData	msgData;					/**< The message data, either referring to the collected payload or holding a copy of it. */
+		bool					isSetAsCurrentOnSuccess;	/**< Indication if the value is to be set as current value of the target protocol once it was sent successfully. */
+		bool					isSent{ false };			/**< Indication if the message was sent successfully. */
+	};
+
+	/**
+	 * The messages collected while the current values lock is held. Payloads that do not outlive the lock,
+	 * e.g. values taken from a value store, have to be copied, since the stores may change as soon as the lock is released.
+	 */
+	struct OutgoingMessages
+	{
+		explicit OutgoingMessages(bool copyPayloads) : isPayloadCopied(copyPayloads) {}
+
+		std::vector<OutgoingMessage>	messages;			/**< The messages in the order they are to be sent in. */
+		bool							isPayloadCopied;	/**< Indication if the payloads of added messages are to be copied. */
+	};
+
+	void AddOutgoingMessage(OutgoingMessages& outgoingMessages, const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, bool setAsCurrentOnSuccess = false);
+	bool SendOutgoingMessages(OutgoingMessages& outgoingMessages);
+	virtual bool SendOutgoingMessage(const OutgoingMessage& outgoingMessage);
+
+	virtual bool CollectValueChange(const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, const RemoteObjectMessageMetaInfo& msgMeta, bool isGetValueQuery, OutgoingMessages& outgoingMessages);
+
 	bool IsChangedDataValue(const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectAddressing& roAddr, const RemoteObjectMessageData& msgData, bool setAsNewCurrentData = true);
     void SetCurrentValue(const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectAddressing& roAddr, const RemoteObjectMessageData& msgData);
+	bool IsValueForwardThrottled(const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectAddressing& roAddr, const RemoteObjectMessageData& msgData, const RemoteObjectMessageMetaInfo& msgMeta);
+
+	float GetValueDeadband(const RemoteObjectIdentifier roi, const RemoteObjectAddressing& roAddr);
+	double GetValueMinInterval(const RemoteObjectIdentifier roi, const RemoteObjectAddressing& roAddr);
+
+	CriticalSection& GetCurrentValuesLock();
 
 	float GetPrecision();
 	void SetPrecision(float precision);
 
 	bool IsCachedValuesQuery(const RemoteObjectIdentifier roi);
-	bool SendValueCacheToProtocol(const ProtocolId PId);
+	bool SendValueCacheToProtocol(const ProtocolId PId, const RemoteObjectMessageData& queryMsgData);
+	bool CollectCachedValuesReplay(const ProtocolId sourcePId, const ProtocolId targetPId, int sinceVersion, OutgoingMessages& outgoingMessages);
+	int GetCurrentValueVersion();
 
 	bool IsTypeAAcknowledging();
 	bool IsTypeBAcknowledging();
 	
+	//==============================================================================
+	virtual int GetTimerThreadInterval();
+	void UpdateTimerThread();
+	void timerThreadCallback() override;
+
 private:
-	std::map<ProtocolId, std::map<RemoteObjectIdentifier, std::map<RemoteObjectAddressing, RemoteObjectMessageData>>>	m_currentValues;	/**< Hash of current value data known per protocol of ProcessingNode to use to compare to incoming data regarding value changes. */
+	/**
+	 * Filter settings for the values of a remote object or of a single channel of it.
+	 */
+	struct ValueFilter
+	{
+		float	deadband{ 0.0f };			/**< The absolute amount a value has to differ by to be regarded as changed. */
+		double	minIntervalMs{ 0.0 };		/**< The minimum time in ms between two forwarded values. */
+		bool	isDeadbandSet{ false };		/**< Indication if the deadband is configured or the next less specific one is to be used. */
+		bool	isMinIntervalSet{ false };	/**< Indication if the minimum interval is configured or the next less specific one is to be used. */
+	};
+
+	/**
+	 * A value that was held back due to minimum interval throttling and has to be forwarded once the interval has elapsed.
+	 * The value itself is not held here, but taken from the value store of the receiving protocol when forwarding.
+	 */
+	struct PendingValue
+	{
+		RemoteObjectAddressing		msgAddr;	/**< The addressing of the message as originally received. */
+		RemoteObjectMessageMetaInfo	msgMeta;	/**< The meta info of the message as originally received. */
+		double						dueTimeMs;	/**< The time in ms the value is to be forwarded at. */
+	};
+
+	/**
+	 * A dump of cached values to a protocol that is sent paced by the flush timer.
+	 */
+	struct PendingCacheDump
+	{
+		std::vector<RemoteObject>	objects;					/**< The objects (addressed as in value store) to send the cached values of. */
+		std::size_t					nextObjectIndex{ 0 };		/**< The index of the next object to send. */
+		int							version{ 0 };				/**< The value version the dump represents, to reply with after the last value. */
+		bool						isVersionedQuery{ false };	/**< Indication if the dump was queried with a version and therefor has to be replied to with the version. */
+	};
+
+	bool ReadValueFilters(XmlElement* valueFiltersXmlElement);
+
+	void CollectDueValues(OutgoingMessages& outgoingMessages);
+	PendingCacheDump CreateCacheDump(const ProtocolId PId, const RemoteObjectMessageData& queryMsgData);
+	void CollectPendingCacheDumps(OutgoingMessages& outgoingMessages);
+	bool CollectCachedValue(OutgoingMessages& outgoingMessages, const ProtocolId PId, const RemoteObject& remoteObject);
+	void CollectCachedValuesVersion(OutgoingMessages& outgoingMessages, const ProtocolId PId, int version);
+	const ValueFilter* GetChannelValueFilter(const RemoteObjectIdentifier roi, const RemoteObjectAddressing& roAddr);
+
+	ObjectValueStore* GetValueStore(const ProtocolId PId, const RemoteObjectIdentifier roi, bool createIfMissing);
+
+	static constexpr int s_pendingValueFlushIntervalMs = 5;	/**< The interval at which held back values are checked for being due to be forwarded. */
+
+	std::vector<ValueFilter>									m_objectValueFilters;	/**< The value filter settings per remote object (indexed by roi). */
+	std::map<RemoteObject, ValueFilter>							m_channelValueFilters;	/**< The value filter settings for single channels of remote objects (record addressing is ignored). */
+	double														m_defaultMinIntervalMs{ 0.0 };	/**< The minimum interval to use for objects that do not have one configured. */
+	std::map<std::pair<ProtocolId, RemoteObject>, PendingValue>	m_pendingValues;		/**< The values held back due to minimum interval throttling per receiving protocol and remote object (addressed as in value store). */
+	int															m_currentValueVersion{ 0 };		/**< The version given to the last value set to any value store, increasing with every value set. */
+	int															m_cacheDumpRate{ 0 };			/**< The budget of messages per second to send cached value dumps with. Zero sends dumps in one go. */
+	double														m_cacheDumpAllowance{ 0.0 };	/**< The number of cached value messages that may currently be sent. */
+	double														m_lastCacheDumpTimeMs{ 0.0 };	/**< The time in ms the cached value message allowance was last updated at. */
+	std::map<ProtocolId, PendingCacheDump>						m_pendingCacheDumps;	/**< The paced dumps of cached values currently being sent, per protocol. */
+	int															m_timerThreadInterval{ 0 };		/**< The interval in ms the timer thread was last started with. */
+	CriticalSection												m_currentValuesLock;	/**< Lock to protect the value stores and held back values against concurrent access from protocol and flush thread. */
+
+	std::map<ProtocolId, std::vector<std::unique_ptr<ObjectValueStore>>>	m_currentValues;	/**< Store of current value data known per protocol of ProcessingNode and remote object (indexed by roi) to use to compare to incoming data regarding value changes. */
 	bool m_typeAIsAcknowledging{ false };																									/**< Bool indicator that defines if the protocols in role A are expected to reply with acknowledge value message on any sent value update. */
 	bool m_typeBIsAcknowledging{ false };																									/**< Bool indicator that defines if the protocols in role B are expected to reply with acknowledge value message on any sent value update. */
 	float m_precision;																														/**< Value precision to use for processing. */
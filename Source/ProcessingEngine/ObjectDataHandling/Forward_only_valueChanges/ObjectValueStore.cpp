@@ -0,0 +1,266 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "ObjectValueStore.h"
+
+
+// **************************************************************************************
+//    class ObjectValueStore
+// **************************************************************************************
+/**
+ * Constructor of class ObjectValueStore.
+ */
+ObjectValueStore::ObjectValueStore()
+{
+}
+
+/**
+ * Destructor
+ */
+ObjectValueStore::~ObjectValueStore()
+{
+}
+
+/**
+ * Helper method to calculate the index of an addressing in the dense slot table.
+ * @param addressing	The addressing to get the index for.
+ * @return	The index or -1 if the addressing is outside of the dense table.
+ */
+int ObjectValueStore::GetDenseIndex(const RemoteObjectAddressing& addressing) const
+{
+	auto channelIndex = addressing._first + 1;
+	auto recordIndex = addressing._second + 1;
+	if (channelIndex < 0 || channelIndex >= s_denseChannelStride || recordIndex < 0 || recordIndex >= s_denseRecordStride)
+		return -1;
+
+	return recordIndex * s_denseChannelStride + channelIndex;
+}
+
+/**
+ * Getter for the slot that holds the value of an addressing.
+ * @param addressing	The addressing to get the slot for.
+ * @return	The slot or -1 if no value is known for the addressing.
+ */
+int ObjectValueStore::FindSlot(const RemoteObjectAddressing& addressing) const
+{
+	auto denseIndex = GetDenseIndex(addressing);
+	if (denseIndex >= 0)
+		return (denseIndex < static_cast<int>(m_denseSlots.size())) ? m_denseSlots[denseIndex] : -1;
+
+	auto sparseSlotIter = m_sparseSlots.find(addressing);
+	return (sparseSlotIter != m_sparseSlots.end()) ? sparseSlotIter->second : -1;
+}
+
+/**
+ * Getter for the slot that holds the value of an addressing, that adds an empty slot if none exists yet.
+ * @param addressing	The addressing to get the slot for.
+ * @return	The slot.
+ */
+int ObjectValueStore::GetOrCreateSlot(const RemoteObjectAddressing& addressing)
+{
+	auto slot = FindSlot(addressing);
+	if (slot >= 0)
+		return slot;
+
+	slot = GetSlotCount();
+	m_addressings.push_back(addressing);
+	m_valueTypes.push_back(ROVT_NONE);
+	m_valueCounts.push_back(0);
+	m_floatOffsets.push_back(0);
+	m_floatCapacities.push_back(0);
+	m_intOffsets.push_back(0);
+	m_intCapacities.push_back(0);
+	m_stringValues.emplace_back();
+	m_forwardTimes.push_back(0.0);
+	m_versions.push_back(0);
+
+	auto denseIndex = GetDenseIndex(addressing);
+	if (denseIndex >= 0)
+	{
+		if (m_denseSlots.empty())
+			m_denseSlots.resize(s_denseChannelStride * s_denseRecordStride, -1);
+		m_denseSlots[denseIndex] = slot;
+	}
+	else
+		m_sparseSlots[addressing] = slot;
+
+	return slot;
+}
+
+/**
+ * Getter for the number of slots, which is the number of addressings a value is known for.
+ * @return	The slot count.
+ */
+int ObjectValueStore::GetSlotCount() const
+{
+	return static_cast<int>(m_addressings.size());
+}
+
+/**
+ * Method to check if a value differs from the value known for a slot.
+ * Numeric values are compared all at once in a branch free loop,
+ * float values are regarded as changed if they differ by more than the given precision.
+ * The float values are not stored quantised to the precision, since the precision may differ per call
+ * and values jittering around a quantisation step would be regarded as changed every time.
+ * @param slot		The slot to compare against.
+ * @param msgData	The value to compare.
+ * @param precision	The float precision to apply.
+ * @return	True if the value differs.
+ */
+bool ObjectValueStore::IsChangedValue(int slot, const RemoteObjectMessageData& msgData, float precision) const
+{
+	auto valueType = m_valueTypes[slot];
+	auto valueCount = m_valueCounts[slot];
+	if (valueType != msgData._valType || valueCount != msgData._valCount)
+		return true;
+
+	auto changed = false;
+	switch (valueType)
+	{
+	case ROVT_INT:
+		{
+			if (msgData._payloadSize != valueCount * sizeof(int) || nullptr == msgData._payload)
+				return true;
+			auto knownValues = m_intValues.data() + m_intOffsets[slot];
+			auto newValues = static_cast<const int*>(msgData._payload);
+			for (int i = 0; i < valueCount; i++)
+				changed |= (knownValues[i] != newValues[i]);
+		}
+		break;
+	case ROVT_FLOAT:
+		{
+			if (msgData._payloadSize != valueCount * sizeof(float) || nullptr == msgData._payload)
+				return true;
+			auto knownValues = m_floatValues.data() + m_floatOffsets[slot];
+			auto newValues = static_cast<const float*>(msgData._payload);
+			for (int i = 0; i < valueCount; i++)
+				changed |= (std::fabs(knownValues[i] - newValues[i]) > precision);
+		}
+		break;
+	case ROVT_STRING:
+		{
+			auto const& knownValue = m_stringValues[slot];
+			changed = (knownValue.size() != msgData._payloadSize)
+				|| (msgData._payloadSize > 0 && (nullptr == msgData._payload || 0 != std::memcmp(knownValue.data(), msgData._payload, msgData._payloadSize)));
+		}
+		break;
+	case ROVT_NONE:
+	default:
+		changed = (valueCount > 0);
+		break;
+	}
+
+	return changed;
+}
+
+/**
+ * Method to set the value of a slot.
+ * @param slot		The slot to set the value for.
+ * @param msgData	The value to set.
+ */
+void ObjectValueStore::SetValue(int slot, const RemoteObjectMessageData& msgData)
+{
+	auto valueType = msgData._valType;
+
+	m_valueTypes[slot] = valueType;
+	m_valueCounts[slot] = msgData._valCount;
+
+	switch (valueType)
+	{
+	case ROVT_INT:
+		SetNumericValues(slot, m_intValues, m_intOffsets, m_intCapacities, msgData);
+		break;
+	case ROVT_FLOAT:
+		SetNumericValues(slot, m_floatValues, m_floatOffsets, m_floatCapacities, msgData);
+		break;
+	case ROVT_STRING:
+		if (msgData._payloadSize > 0 && nullptr != msgData._payload)
+			m_stringValues[slot].assign(static_cast<const char*>(msgData._payload), msgData._payloadSize);
+		else
+			m_stringValues[slot].clear();
+		break;
+	case ROVT_NONE:
+	default:
+		m_valueCounts[slot] = 0;
+		break;
+	}
+}
+
+/**
+ * Getter for the value of a slot. The returned data refers to the stored values
+ * and therefor is only valid until the store is modified.
+ * @param slot	The slot to get the value for.
+ * @return	The value, including the addressing of the slot.
+ */
+const RemoteObjectMessageData ObjectValueStore::GetValue(int slot)
+{
+	auto valueType = m_valueTypes[slot];
+	auto valueCount = m_valueCounts[slot];
+	switch (valueType)
+	{
+	case ROVT_INT:
+		return RemoteObjectMessageData(m_addressings[slot], valueType, valueCount, m_intValues.data() + m_intOffsets[slot], static_cast<std::uint32_t>(valueCount * sizeof(int)));
+	case ROVT_FLOAT:
+		return RemoteObjectMessageData(m_addressings[slot], valueType, valueCount, m_floatValues.data() + m_floatOffsets[slot], static_cast<std::uint32_t>(valueCount * sizeof(float)));
+	case ROVT_STRING:
+		return RemoteObjectMessageData(m_addressings[slot], valueType, valueCount, m_stringValues[slot].data(), static_cast<std::uint32_t>(m_stringValues[slot].size()));
+	case ROVT_NONE:
+	default:
+		return RemoteObjectMessageData(m_addressings[slot], ROVT_NONE, 0, nullptr, 0);
+	}
+}
+
+/**
+ * Getter for the time the value of a slot was last forwarded at.
+ * @param slot	The slot to get the forward time for.
+ * @return	The forward time in ms, zero if the value was not forwarded yet.
+ */
+double ObjectValueStore::GetForwardTime(int slot) const
+{
+	return m_forwardTimes[slot];
+}
+
+/**
+ * Setter for the time the value of a slot was last forwarded at.
+ * @param slot			The slot to set the forward time for.
+ * @param forwardTimeMs	The forward time in ms.
+ */
+void ObjectValueStore::SetForwardTime(int slot, double forwardTimeMs)
+{
+	m_forwardTimes[slot] = forwardTimeMs;
+}
+
+/**
+ * Getter for the version the value of a slot was last set with.
+ * @param slot	The slot to get the version for.
+ * @return	The version, zero if it was never set.
+ */
+int ObjectValueStore::GetVersion(int slot) const
+{
+	return m_versions[slot];
+}
+
+/**
+ * Setter for the version the value of a slot was last set with.
+ * @param slot		The slot to set the version for.
+ * @param version	The version.
+ */
+void ObjectValueStore::SetVersion(int slot, int version)
+{
+	m_versions[slot] = version;
+}
@@ -0,0 +1,111 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include "../../../RemoteProtocolBridgeCommon.h"
+
+#include <JuceHeader.h>
+
+
+/**
+ * Class ObjectValueStore holds the last known values of all addressings of one remote object
+ * as structure of arrays. Addressings are resolved to a slot index through a dense table,
+ * the values of a slot are held in flat typed arrays, so comparing a value against
+ * the known one does not need any lookup in nested maps or any conversion.
+ */
+class ObjectValueStore
+{
+public:
+	ObjectValueStore();
+	~ObjectValueStore();
+
+	//==============================================================================
+	int FindSlot(const RemoteObjectAddressing& addressing) const;
+	int GetOrCreateSlot(const RemoteObjectAddressing& addressing);
+	int GetSlotCount() const;
+
+	//==============================================================================
+	bool IsChangedValue(int slot, const RemoteObjectMessageData& msgData, float precision) const;
+	void SetValue(int slot, const RemoteObjectMessageData& msgData);
+	const RemoteObjectMessageData GetValue(int slot);
+
+	//==============================================================================
+	double GetForwardTime(int slot) const;
+	void SetForwardTime(int slot, double forwardTimeMs);
+
+	int GetVersion(int slot) const;
+	void SetVersion(int slot, int version);
+
+private:
+	//==============================================================================
+	int GetDenseIndex(const RemoteObjectAddressing& addressing) const;
+
+	/**
+	 * Helper to copy the numeric values of a message to the typed value array of a slot.
+	 * The array is only grown if the slot needs more values than reserved for it in this array before,
+	 * so a slot switching between value types reuses the room it already has in each array.
+	 * Values missing in a too short payload are set to zero.
+	 * @param slot			The slot to set the values for.
+	 * @param values		The typed value array matching the value type of the message.
+	 * @param offsets		The offset of the values of each slot in the typed value array.
+	 * @param capacities	The number of values reserved for each slot in the typed value array.
+	 * @param msgData		The message to copy the values from.
+	 */
+	template <typename T>
+	void SetNumericValues(int slot, std::vector<T>& values, std::vector<int>& offsets, std::vector<int>& capacities, const RemoteObjectMessageData& msgData)
+	{
+		auto valueCount = static_cast<int>(msgData._valCount);
+		if (capacities[slot] < valueCount)
+		{
+			offsets[slot] = static_cast<int>(values.size());
+			capacities[slot] = valueCount;
+			values.resize(values.size() + static_cast<std::size_t>(valueCount));
+		}
+
+		auto availableCount = (nullptr != msgData._payload) ? jmin(valueCount, static_cast<int>(msgData._payloadSize / sizeof(T))) : 0;
+		auto slotValues = values.data() + offsets[slot];
+		if (availableCount > 0)
+			std::memcpy(slotValues, msgData._payload, static_cast<std::size_t>(availableCount) * sizeof(T));
+		std::fill(slotValues + availableCount, slotValues + valueCount, T(0));
+	}
+
+	//==============================================================================
+	static constexpr int s_maxDenseChannel = 128;	/**< The highest channel addressed through the dense table, matching the DS100 input count. */
+	static constexpr int s_maxDenseRecord = 8;		/**< The highest record addressed through the dense table, covering all mapping areas. */
+	static constexpr int s_denseChannelStride = s_maxDenseChannel + 2;	/**< Channels from INVALID_ADDRESS_VALUE up to the maximum. */
+	static constexpr int s_denseRecordStride = s_maxDenseRecord + 2;	/**< Records from INVALID_ADDRESS_VALUE up to the maximum. */
+
+	std::vector<int>							m_denseSlots;		/**< The slot per dense addressing index, -1 if not yet used. */
+	std::map<RemoteObjectAddressing, int>		m_sparseSlots;		/**< The slot per addressing, for addressings outside of the dense table. */
+
+	std::vector<RemoteObjectAddressing>			m_addressings;		/**< The addressing per slot. */
+	std::vector<RemoteObjectValueType>			m_valueTypes;		/**< The value type per slot. */
+	std::vector<std::uint16_t>					m_valueCounts;		/**< The value count per slot. */
+
+	std::vector<float>							m_floatValues;
+	std::vector<int>							m_floatOffsets;		/**< The offset of the values of a slot in the float value array. */
+	std::vector<int>							m_floatCapacities;	/**< The number of values reserved for a slot in the float value array. */
+	std::vector<int>							m_intValues;
+	std::vector<int>							m_intOffsets;		/**< The offset of the values of a slot in the int value array. */
+	std::vector<int>							m_intCapacities;	/**< The number of values reserved for a slot in the int value array. */
+	std::vector<std::string>					m_stringValues;		/**< The string value per slot. */
+
+	std::vector<double>							m_forwardTimes;		/**< The time in ms the value of a slot was last forwarded at, used for minimum interval throttling. */
+	std::vector<int>							m_versions;			/**< The version the value of a slot was last set with, used for incremental cache dumps. */
+};
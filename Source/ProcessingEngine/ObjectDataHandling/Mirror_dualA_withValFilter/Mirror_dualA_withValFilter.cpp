@@ -46,6 +46,8 @@ Mirror_dualA_withValFilter::Mirror_dualA_withValFilter(ProcessingEngineNode* par
  */
 Mirror_dualA_withValFilter::~Mirror_dualA_withValFilter()
 {
+	// liveness monitoring is done through our reimplementation, so the timer must not outlive this object
+	stopTimerThread();
 }
 
 /**
@@ -85,10 +87,17 @@ bool Mirror_dualA_withValFilter::setStateXml(XmlElement* stateXml)
 
 	auto protoFailoverTimeElement = stateXml->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::FAILOVERTIME));
 	if (protoFailoverTimeElement)
+	{
+		const ScopedLock l(GetCurrentValuesLock());
 		SetProtoFailoverTime(protoFailoverTimeElement->getAllSubText().getDoubleValue());
+		// the optional heartbeat interval enables active liveness monitoring, to fail over without waiting for the slave to send anything
+		m_heartbeatInterval = jmax(0.0, protoFailoverTimeElement->getDoubleAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::INTERVAL), 0.0));
+	}
 	else
 		return false;
 
+	UpdateTimerThread();
+
 	return true;
 }
 
@@ -103,11 +112,6 @@ bool Mirror_dualA_withValFilter::setStateXml(XmlElement* stateXml)
  */
 bool Mirror_dualA_withValFilter::OnReceivedMessageFromProtocol(const ProtocolId receiverProtocolId, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, const RemoteObjectMessageMetaInfo& msgMeta)
 {
-	// a valid parent node is required to be able to do anything with the received message
-	auto parentNode = ObjectDataHandling_Abstract::GetParentNode();
-	if (!parentNode)
-		return false;
-
 	// do some sanity checks on this instances configuration parameters and the given message data origin id
 	auto mirrorConfigValid = (GetProtocolAIds().size() == 2);
 	auto isProtocolTypeA = (std::find(GetProtocolAIds().begin(), GetProtocolAIds().end(), receiverProtocolId) != GetProtocolAIds().end());
@@ -120,25 +124,40 @@ bool Mirror_dualA_withValFilter::OnReceivedMessageFromProtocol(const ProtocolId
 	UpdateOnlineState(receiverProtocolId);
 
 	if (IsCachedValuesQuery(roi))
-		return SendValueCacheToProtocol(receiverProtocolId);
-
-	auto isGetValueQuery = IsGetValueQuery(roi, msgData);
-	if (isGetValueQuery)
-		SetCurrentValue(receiverProtocolId, roi, msgData._addrVal, RemoteObjectMessageData());
+		return SendValueCacheToProtocol(receiverProtocolId, msgData);
 
-	// check the incoming data regarding value change to then forward and if required mirror it to other protocols
-	if (IsChangedDataValue(receiverProtocolId, roi, msgData._addrVal, msgData))
+	// the received message data outlives sending, so its payload does not have to be copied
+	auto outgoingMessages = OutgoingMessages(false);
 	{
+		const ScopedLock l(GetCurrentValuesLock());
+
+		// pongs replying to our own heartbeat pings are only relevant for the online state, others are forwarded to typeB as before
+		if (roi == ROI_HeartbeatPong && isProtocolTypeA && m_heartbeatInterval > 0.0)
+		{
+			if (receiverProtocolId != m_currentMaster || m_forwardedPingCount <= 0)
+				return true;
+			m_forwardedPingCount--;
+		}
+		else if (roi == ROI_HeartbeatPing && isProtocolTypeB)
+			m_forwardedPingCount++;
+
+		auto isGetValueQuery = IsGetValueQuery(roi, msgData);
+		if (isGetValueQuery)
+			SetCurrentValue(receiverProtocolId, roi, msgData._addrVal, RemoteObjectMessageData());
+
+		// check the incoming data regarding value change to then forward and if required mirror it to other protocols
+		if (!IsChangedDataValue(receiverProtocolId, roi, msgData._addrVal, msgData))
+			return false;
+
 		// mirror and forward to all B if data comes from A
 		if (isProtocolTypeA)
 		{
 			// data mirroring is only done inbetween typeA protocols
-			MirrorDataIfRequired(receiverProtocolId, roi, msgData);
+			MirrorDataIfRequired(receiverProtocolId, roi, msgData, outgoingMessages);
 
 			// now do the basic A to B forwarding - only from master A
 			if (receiverProtocolId == m_currentMaster)
 			{
-				auto overallSendSuccess = true;
 				for (auto const& protocolBId : GetProtocolBIds())
 				{
 					if (msgMeta._ExternalId != roi || msgMeta._Category != RemoteObjectMessageMetaInfo::MC_SetMessageAcknowledgement)
@@ -146,21 +165,17 @@ bool Mirror_dualA_withValFilter::OnReceivedMessageFromProtocol(const ProtocolId
 						// sending is only done when the value about to be sent is differing from the last known value from the protocol in question
 						if (IsChangedDataValue(protocolBId, roi, msgData._addrVal, msgData, false))
 						{
-							auto sendSuccess = parentNode->SendMessageTo(protocolBId, roi, msgData);
 							// If the value was sent successfully, save it to cache (to make it the 'last known' from this protocol).
 							// In case the protocol is expected to acknowledge the value, we make an exception, since acknowledge values are
 							// used to update bridged protocols that have not yet received that latest value. E.g. DS100 ack values that are a
 							// reaction on a GenericOSC SET have to be bridged back to connected DiGiCo.
-							if ((sendSuccess && !IsTypeBAcknowledging()) || isGetValueQuery)
+							if (isGetValueQuery)
 								SetCurrentValue(protocolBId, roi, msgData._addrVal, msgData); // set the updated value as current for the complementary cache as well
-							overallSendSuccess = sendSuccess && overallSendSuccess;
+							AddOutgoingMessage(outgoingMessages, protocolBId, roi, msgData, !IsTypeBAcknowledging() && !isGetValueQuery);
 						}
 					}
 				}
-				return overallSendSuccess;
 			}
-			else
-				return true;
 		}
 		// forward to A current master if data comes from B
 		else if (isProtocolTypeB)
@@ -168,24 +183,18 @@ bool Mirror_dualA_withValFilter::OnReceivedMessageFromProtocol(const ProtocolId
 			// sending is only done when the value about to be sent is differing from the last known value from the protocol in question
 			if (IsChangedDataValue(m_currentMaster, roi, msgData._addrVal, msgData, false))
 			{
-				auto sendSuccess = parentNode->SendMessageTo(m_currentMaster, roi, msgData);
 				// If the value was sent successfully, save it to cache (to make it the 'last known' from this protocol).
 				// In case the protocol is expected to acknowledge the value, we make an exception, since acknowledge values are
 				// used to update bridged protocols that have not yet received that latest value. E.g. DS100 ack values that are a
 				// reaction on a GenericOSC SET have to be bridged back to connected DiGiCo.
-				if ((sendSuccess && !IsTypeAAcknowledging()) || isGetValueQuery)
+				if (isGetValueQuery)
 					SetCurrentValue(m_currentMaster, roi, msgData._addrVal, msgData); // set the updated value as current for the complementary cache as well
-
-				return sendSuccess;
+				AddOutgoingMessage(outgoingMessages, m_currentMaster, roi, msgData, !IsTypeAAcknowledging() && !isGetValueQuery);
 			}
-			else
-				return true;
 		}
-		else
-			return false;
 	}
-	else
-		return false;
+
+	return SendOutgoingMessages(outgoingMessages);
 }
 
 
@@ -200,34 +209,116 @@ void Mirror_dualA_withValFilter::UpdateOnlineState(ProtocolId id)
 {
 	ObjectDataHandling_Abstract::UpdateOnlineState(id);
 
-	// swap master and slave if the master has failed to react in the configured failover time
-	if (id == m_currentSlave && GetLastProtocolReactionTSMap().count(m_currentMaster) > 0)
+	// the replayed values are taken from the value stores, so their payloads have to be copied to outlive the lock
+	auto outgoingMessages = OutgoingMessages(true);
 	{
-		auto masterStaleTime = Time::getMillisecondCounterHiRes() - GetLastProtocolReactionTSMap().at(m_currentMaster);
-		if (masterStaleTime > GetProtoFailoverTime())
-		{
-			SetChangedProtocolState(m_currentMaster, OHS_Protocol_Slave);
-			SetChangedProtocolState(m_currentSlave, OHS_Protocol_Master);
-			std::swap(m_currentMaster, m_currentSlave);
-		}
+		const ScopedLock l(GetCurrentValuesLock());
+
+		// remember what values the master has seen, to know what has to be replayed to the slave when failing over
+		if (id == m_currentMaster)
+			m_masterSeenValueVersion = GetCurrentValueVersion();
+
+		// swap master and slave if the master has failed to react in the configured failover time
+		if (id == m_currentSlave && GetProtocolStaleTime(m_currentMaster) > GetProtoFailoverTime())
+			SwapMasterAndSlave(outgoingMessages);
+	}
+
+	SendOutgoingMessages(outgoingMessages);
+}
+
+/**
+ * Reimplemented to additionally run the timer thread at the interval required for active liveness monitoring.
+ * The master is checked several times within the failover time, to detect its failure close to the configured time.
+ * @return	The interval in ms, zero if the timer thread is not required.
+ */
+int Mirror_dualA_withValFilter::GetTimerThreadInterval()
+{
+	auto timerThreadInterval = Forward_only_valueChanges::GetTimerThreadInterval();
+	if (m_heartbeatInterval <= 0.0)
+		return timerThreadInterval;
+
+	auto livenessCheckInterval = jmax(1, static_cast<int>(jmin(m_heartbeatInterval, GetProtoFailoverTime() / s_livenessChecksPerFailoverTime)));
+	return (timerThreadInterval > 0) ? jmin(timerThreadInterval, livenessCheckInterval) : livenessCheckInterval;
+}
+
+/**
+ * Reimplemented to additionally monitor the liveness of the typeA protocols.
+ */
+void Mirror_dualA_withValFilter::timerThreadCallback()
+{
+	Forward_only_valueChanges::timerThreadCallback();
+
+	// the replayed values are taken from the value stores, so their payloads have to be copied to outlive the lock
+	auto outgoingMessages = OutgoingMessages(true);
+	{
+		const ScopedLock l(GetCurrentValuesLock());
+
+		MonitorLiveness(outgoingMessages);
+	}
+
+	SendOutgoingMessages(outgoingMessages);
+}
+
+/**
+ * Helper method to probe both typeA protocols with heartbeat pings and to fail over to the slave
+ * as soon as the master has not reacted within the failover time, without waiting for the slave to send anything.
+ * Pings are sent at least twice per failover time, so a reacting master is never regarded as stale.
+ * The lock has to be held by the caller, the collected messages are to be sent once it is released.
+ * @param	outgoingMessages	The messages to add the pings and the values replayed on failover to. Have to copy the payloads.
+ */
+void Mirror_dualA_withValFilter::MonitorLiveness(OutgoingMessages& outgoingMessages)
+{
+	if (GetProtocolAIds().size() != 2)
+		return;
+
+	auto nowMs = static_cast<double>(GetMillisecondCounter());
+	if (m_heartbeatInterval > 0.0 && nowMs - m_lastHeartbeatTimeMs >= jmin(m_heartbeatInterval, 0.5 * GetProtoFailoverTime()))
+	{
+		m_lastHeartbeatTimeMs = nowMs;
+		for (auto const& protocolAId : GetProtocolAIds())
+			AddOutgoingMessage(outgoingMessages, protocolAId, ROI_HeartbeatPing, RemoteObjectMessageData());
 	}
+
+	// the slave has to be alive itself to take over
+	if (GetProtocolStaleTime(m_currentMaster) > GetProtoFailoverTime() && GetProtocolStaleTime(m_currentSlave) <= GetProtoFailoverTime())
+		SwapMasterAndSlave(outgoingMessages);
+}
+
+/**
+ * Helper method to swap master and slave. The values that typeB protocols have sent or received since
+ * the former master last reacted, were not mirrored to the former slave, so these are replayed to it right away.
+ * The lock has to be held by the caller, the collected messages are to be sent once it is released.
+ * @param	outgoingMessages	The messages to add the replayed values to. Have to copy the payloads.
+ */
+void Mirror_dualA_withValFilter::SwapMasterAndSlave(OutgoingMessages& outgoingMessages)
+{
+	SetChangedProtocolState(m_currentMaster, OHS_Protocol_Slave);
+	SetChangedProtocolState(m_currentSlave, OHS_Protocol_Master);
+	std::swap(m_currentMaster, m_currentSlave);
+
+	m_forwardedPingCount = 0;
+
+	for (auto const& protocolBId : GetProtocolBIds())
+		CollectCachedValuesReplay(protocolBId, m_currentMaster, m_masterSeenValueVersion, outgoingMessages);
+
+	m_masterSeenValueVersion = GetCurrentValueVersion();
 }
 
 /**
  * Method to check if the incoming protocol typeA data shall be mirrored to the other typeA protocol
- * and if the check is positive, exec the mirroring by sending the data.
+ * and if the check is positive, collect the message to mirror the data.
+ * The lock has to be held by the caller, the collected messages are to be sent once it is released.
  *
- * @param PId		The id of the protocol that received the data
- * @param roi		The object id that was received
- * @param msgData	The actual message value/content data
- * @return			True if the mirroring was executed or not required, otherwise false
+ * @param PId				The id of the protocol that received the data
+ * @param roi				The object id that was received
+ * @param msgData			The actual message value/content data
+ * @param outgoingMessages	The messages to add the mirrored data to.
+ * @return			True if the mirroring is to be executed or not required, otherwise false
  */
-bool Mirror_dualA_withValFilter::MirrorDataIfRequired(ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData)
+bool Mirror_dualA_withValFilter::MirrorDataIfRequired(ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, OutgoingMessages& outgoingMessages)
 {
-	// a valid parent node is required to be able to do anything with the received message
-	auto parentNode = ObjectDataHandling_Abstract::GetParentNode();
 	// only typeA protocols are relevant and expected as input for mirroring in this OHM
-	if (std::find(GetProtocolAIds().begin(), GetProtocolAIds().end(), PId) == GetProtocolAIds().end() || !parentNode)
+	if (std::find(GetProtocolAIds().begin(), GetProtocolAIds().end(), PId) == GetProtocolAIds().end())
 	{
 		jassertfalse;
 		return false;
@@ -239,18 +330,13 @@ bool Mirror_dualA_withValFilter::MirrorDataIfRequired(ProtocolId PId, const Remo
 		// sending is only done when the value about to be sent is differing from the last known value from the protocol in question
 		if (IsChangedDataValue(m_currentSlave, roi, msgData._addrVal, msgData))
 		{
-			auto sendSuccess = parentNode->SendMessageTo(m_currentSlave, roi, msgData);
 			// If the value was sent successfully, save it to cache (to make it the 'last known' from this protocol).
 			// In case the protocol is expected to acknowledge the value, we make an exception, since acknowledge values are
 			// used to update bridged protocols that have not yet received that latest value. E.g. DS100 ack values that are a
 			// reaction on a GenericOSC SET have to be bridged back to connected DiGiCo.
-			if (sendSuccess && !IsTypeAAcknowledging())
-				SetCurrentValue(m_currentSlave, roi, msgData._addrVal, msgData); // set the updated value as current for the complementary cache as well
-
-			return sendSuccess;
+			AddOutgoingMessage(outgoingMessages, m_currentSlave, roi, msgData, !IsTypeAAcknowledging());
 		}
-		else
-			return true;
+		return true;
 	}
 	else
 		return false;
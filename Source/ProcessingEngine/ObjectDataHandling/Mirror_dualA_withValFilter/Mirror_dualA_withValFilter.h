@@ -49,14 +49,29 @@ public:
 	//==============================================================================
 	void UpdateOnlineState(ProtocolId id) override;
 
+protected:
+	//==============================================================================
+	int GetTimerThreadInterval() override;
+	void timerThreadCallback() override;
+
 private:
 	void SetProtoFailoverTime(double timeout);
 	double GetProtoFailoverTime();
 	
-	bool MirrorDataIfRequired(ProtocolId PId, RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData);
+	bool MirrorDataIfRequired(ProtocolId PId, RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, OutgoingMessages& outgoingMessages);
+
+	void MonitorLiveness(OutgoingMessages& outgoingMessages);
+	void SwapMasterAndSlave(OutgoingMessages& outgoingMessages);
 
-	double		m_protoFailoverTime;	/**< . */
+	static constexpr int s_livenessChecksPerFailoverTime = 4;	/**< The number of times the master is checked for being stale within the failover time, to fail over at most a quarter late. */
+
+	double		m_protoFailoverTime;	/**< The time in ms the master may not react before failing over to the slave. */
 	ProtocolId	m_currentMaster;		/**< Protocol Id of the protocol currently handled as master. */
 	ProtocolId	m_currentSlave;			/**< Protocol Id of the protocol currently handled as slave. */
 
+	double		m_heartbeatInterval{ 0.0 };		/**< The interval in ms to actively probe both typeA protocols with heartbeat pings at. Zero disables active liveness monitoring. */
+	double		m_lastHeartbeatTimeMs{ 0.0 };	/**< The time in ms the last heartbeat pings were sent at. */
+	int			m_masterSeenValueVersion{ 0 };	/**< The value version current when the master last reacted, values set later are replayed to the slave on failover. */
+	int			m_forwardedPingCount{ 0 };		/**< The number of heartbeat pings from typeB forwarded to the master, that still await their pong to be forwarded back. */
+
 };
@@ -0,0 +1,202 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "MuxRoutingTable.h"
+
+
+// **************************************************************************************
+//    class MuxRoutingTable
+// **************************************************************************************
+/**
+ * Constructor of class MuxRoutingTable.
+ */
+MuxRoutingTable::MuxRoutingTable()
+{
+}
+
+/**
+ * Destructor
+ */
+MuxRoutingTable::~MuxRoutingTable()
+{
+}
+
+/**
+ * Method to derive all routes for the given protocols and channel count configuration.
+ * Needs to be called whenever one of the inputs changes, since routes of a previous
+ * configuration reference protocol id lists that are replaced by this.
+ *
+ * @param protocolAIds	The ids of the protocols of type A.
+ * @param protocolBIds	The ids of the protocols of type B.
+ * @param protoChCntA	Channel count configuration value that is to be expected per protocol type A.
+ * @param protoChCntB	Channel count configuration value that is to be expected per protocol type B.
+ */
+void MuxRoutingTable::Rebuild(const std::vector<ProtocolId>& protocolAIds, const std::vector<ProtocolId>& protocolBIds, int protoChCntA, int protoChCntB)
+{
+	m_protocolAIds = protocolAIds;
+	m_protocolBIds = protocolBIds;
+	m_protoChCntA = protoChCntA;
+	m_protoChCntB = protoChCntB;
+
+	m_sources.clear();
+	m_routes.clear();
+	m_sourceIndices.assign(s_maxDenseProtocolId + 1, -1);
+
+	auto addSources = [this](const std::vector<ProtocolId>& protocolIds, bool isTypeA, int channelCount) {
+		for (auto i = 0; i < static_cast<int>(protocolIds.size()); i++)
+		{
+			Source source;
+			source.protocolId = protocolIds.at(i);
+			source.isTypeA = isTypeA;
+			source.protocolIndex = i;
+			source.firstRouteIndex = static_cast<int>(m_routes.size());
+			source.channelCount = channelCount > 0 ? channelCount : s_maxDenseChannel;
+
+			// a protocol id that is known as type A already keeps its type A routes, as the lookup by iterating both lists did before
+			if (source.protocolId <= static_cast<ProtocolId>(s_maxDenseProtocolId) && m_sourceIndices.at(static_cast<std::size_t>(source.protocolId)) == -1)
+				m_sourceIndices.at(static_cast<std::size_t>(source.protocolId)) = static_cast<int>(m_sources.size());
+
+			// dense routes from INVALID_ADDRESS_VALUE channel (objects without channel addressing) up to the channel count
+			for (auto channel = INVALID_ADDRESS_VALUE; channel <= source.channelCount; channel++)
+				m_routes.push_back(ComputeRoute(source, channel));
+
+			m_sources.push_back(source);
+		}
+	};
+
+	addSources(m_protocolAIds, true, m_protoChCntA);
+	addSources(m_protocolBIds, false, m_protoChCntB);
+}
+
+/**
+ * Method to get the route of a message received by the given protocol for the given channel.
+ *
+ * @param PId		The id of the protocol that received the message.
+ * @param channel	The channel the message is addressed to.
+ * @param route		The route to fill.
+ * @return	True if the protocol id is known as source, false if not.
+ */
+bool MuxRoutingTable::GetRoute(const ProtocolId PId, const ChannelId channel, Route& route) const
+{
+	auto source = FindSource(PId);
+	if (nullptr == source)
+		return false;
+
+	if (channel >= INVALID_ADDRESS_VALUE && channel <= source->channelCount)
+		route = m_routes[static_cast<std::size_t>(source->firstRouteIndex + channel - INVALID_ADDRESS_VALUE)];
+	else
+		route = ComputeRoute(*source, channel);
+
+	return true;
+}
+
+/**
+ * Method to get the route of a message received by the given protocol, that is to be sent
+ * to all protocols of the complementary type with unchanged channel, as required for keepalive objects.
+ *
+ * @param PId		The id of the protocol that received the message.
+ * @param channel	The channel the message is addressed to.
+ * @param route		The route to fill.
+ * @return	True if the protocol id is known as source, false if not.
+ */
+bool MuxRoutingTable::GetBroadcastRoute(const ProtocolId PId, const ChannelId channel, Route& route) const
+{
+	if (!GetRoute(PId, channel, route))
+		return false;
+
+	auto& targetProtocolIds = route.isTargetTypeA ? m_protocolAIds : m_protocolBIds;
+	route.targetProtocols = targetProtocolIds.data();
+	route.targetProtocolCount = static_cast<int>(targetProtocolIds.size());
+	route.targetChannel = channel;
+
+	return true;
+}
+
+/**
+ * Helper to find the source entry of a protocol id. Ids up to s_maxDenseProtocolId are
+ * resolved through the dense index, larger ones by iterating the few sources.
+ *
+ * @param PId	The id of the protocol to find the source for.
+ * @return	The source entry or nullptr if the protocol id is not known.
+ */
+const MuxRoutingTable::Source* MuxRoutingTable::FindSource(const ProtocolId PId) const
+{
+	if (PId <= static_cast<ProtocolId>(s_maxDenseProtocolId))
+	{
+		if (m_sourceIndices.empty())
+			return nullptr;
+
+		auto sourceIndex = m_sourceIndices[static_cast<std::size_t>(PId)];
+		return (sourceIndex >= 0) ? &m_sources[static_cast<std::size_t>(sourceIndex)] : nullptr;
+	}
+
+	for (auto const& source : m_sources)
+		if (source.protocolId == PId)
+			return &source;
+
+	return nullptr;
+}
+
+/**
+ * Helper to compute the route for a source and channel in respect to the multiplexing configuration values.
+ * The channel is made absolute by adding the channels of all preceding protocols of the source type, that
+ * absolute channel then is split up again into the protocol index and channel of the target type.
+ * If the target channel count is not limited, the message is routed to all target protocols with absolute channel.
+ *
+ * @param source	The source entry of the protocol that received the message.
+ * @param channel	The channel the message is addressed to.
+ * @return	The computed route, with no target protocols if the absolute channel exceeds the available target protocols.
+ */
+MuxRoutingTable::Route MuxRoutingTable::ComputeRoute(const Source& source, const ChannelId channel) const
+{
+	auto sourceChCnt = source.isTypeA ? m_protoChCntA : m_protoChCntB;
+	auto targetChCnt = source.isTypeA ? m_protoChCntB : m_protoChCntA;
+	auto& targetProtocolIds = source.isTypeA ? m_protocolBIds : m_protocolAIds;
+
+	auto absChNr = static_cast<ChannelId>(source.protocolIndex * (sourceChCnt != INVALID_ADDRESS_VALUE ? sourceChCnt : 0)) + channel;
+	auto targetChannel = ChannelId(0);
+	auto targetProtocolIndex = 0;
+	if (targetChCnt > 0)
+	{
+		targetChannel = static_cast<ChannelId>(absChNr % targetChCnt);
+		if (targetChannel == 0)
+			targetChannel = targetChCnt;
+		targetProtocolIndex = (absChNr - 1) / targetChCnt;
+	}
+	if (targetChannel == 0)
+		targetChannel = absChNr;
+
+	Route route;
+	route.isTargetTypeA = !source.isTypeA;
+	route.targetChannel = targetChannel;
+	route.originChannel = absChNr;
+	if (targetChCnt == INVALID_ADDRESS_VALUE)
+	{
+		// route to all target protocols
+		route.targetProtocols = targetProtocolIds.data();
+		route.targetProtocolCount = static_cast<int>(targetProtocolIds.size());
+	}
+	else if (targetProtocolIndex >= 0 && targetProtocolIndex < static_cast<int>(targetProtocolIds.size()))
+	{
+		// route to the single target protocol the message can be demultiplexed to
+		route.targetProtocols = targetProtocolIds.data() + targetProtocolIndex;
+		route.targetProtocolCount = 1;
+	}
+
+	return route;
+}
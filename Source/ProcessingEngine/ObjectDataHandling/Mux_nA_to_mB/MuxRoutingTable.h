@@ -0,0 +1,92 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include "../../../RemoteProtocolBridgeCommon.h"
+
+#include <JuceHeader.h>
+
+
+/**
+ * Class MuxRoutingTable holds the precomputed (de-)multiplexing routes of the Mux object handling modes.
+ * For every source protocol and channel, the protocols of the complementary type to send to and the
+ * channel to use for them are derived once when the configuration or the protocol ids change,
+ * so routing a received message is a plain table lookup without any search or allocation.
+ * Channels beyond the dense table are routed by the same computation on the fly.
+ */
+class MuxRoutingTable
+{
+public:
+	/**
+	 * The route of a message from one source protocol and channel.
+	 * The target protocols are a range in the table's own protocol id list,
+	 * so a route is only valid until the table is rebuilt.
+	 */
+	struct Route
+	{
+		const ProtocolId*	targetProtocols{ nullptr };						/**< The first protocol id to send to. */
+		int					targetProtocolCount{ 0 };						/**< The number of protocol ids to send to. */
+		bool				isTargetTypeA{ false };							/**< Indication if the target protocols are of type A. */
+		ChannelId			targetChannel{ INVALID_ADDRESS_VALUE };			/**< The channel to use when sending to the target protocols. */
+		ChannelId			originChannel{ INVALID_ADDRESS_VALUE };			/**< The absolute channel without (de-)multiplexing offset. */
+	};
+
+public:
+	MuxRoutingTable();
+	~MuxRoutingTable();
+
+	//==============================================================================
+	void Rebuild(const std::vector<ProtocolId>& protocolAIds, const std::vector<ProtocolId>& protocolBIds, int protoChCntA, int protoChCntB);
+
+	//==============================================================================
+	bool GetRoute(const ProtocolId PId, const ChannelId channel, Route& route) const;
+	bool GetBroadcastRoute(const ProtocolId PId, const ChannelId channel, Route& route) const;
+
+private:
+	/**
+	 * The position of a source protocol in the table.
+	 */
+	struct Source
+	{
+		ProtocolId	protocolId{ 0 };		/**< The id of the source protocol. */
+		bool		isTypeA{ false };		/**< Indication if the source protocol is of type A. */
+		int			protocolIndex{ 0 };		/**< The index of the protocol in the list of its type. */
+		int			firstRouteIndex{ 0 };	/**< The index of the route for INVALID_ADDRESS_VALUE channel in the dense route list. */
+		int			channelCount{ 0 };		/**< The number of channels covered by the dense route list, starting at channel 1. */
+	};
+
+	//==============================================================================
+	const Source* FindSource(const ProtocolId PId) const;
+	Route ComputeRoute(const Source& source, const ChannelId channel) const;
+
+	//==============================================================================
+	static constexpr int s_maxDenseChannel = 128;		/**< The highest channel covered by the dense table if the channel count is not limited, matching the DS100 input count. */
+	static constexpr int s_maxDenseProtocolId = 1024;	/**< The highest protocol id resolved through the dense id index. */
+
+	std::vector<ProtocolId>		m_protocolAIds;			/**< The own copy of the type A protocol ids, referenced by the routes. */
+	std::vector<ProtocolId>		m_protocolBIds;			/**< The own copy of the type B protocol ids, referenced by the routes. */
+	int							m_protoChCntA{ 0 };		/**< Channel count configuration value that is to be expected per protocol type A. */
+	int							m_protoChCntB{ 0 };		/**< Channel count configuration value that is to be expected per protocol type B. */
+
+	std::vector<int>			m_sourceIndices;		/**< The source index per protocol id, -1 if the protocol id is not known. */
+	std::vector<Source>			m_sources;				/**< The sources, type A protocols first. */
+	std::vector<Route>			m_routes;				/**< The dense routes of all sources, per source from INVALID_ADDRESS_VALUE channel up to its channel count. */
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MuxRoutingTable)
+};
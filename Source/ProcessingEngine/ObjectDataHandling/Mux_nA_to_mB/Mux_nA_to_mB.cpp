@@ -45,6 +45,32 @@ Mux_nA_to_mB::~Mux_nA_to_mB()
 {
 }
 
+/**
+ * Reimplemented to update the routing table with the new typeA protocol,
+ * since protocol ids are added by the parent node after the configuration was applied.
+ *
+ * @param PAId	Protocol Id of typeA protocol to add.
+ */
+void Mux_nA_to_mB::AddProtocolAId(ProtocolId PAId)
+{
+	ObjectDataHandling_Abstract::AddProtocolAId(PAId);
+
+	UpdateRoutingTable();
+}
+
+/**
+ * Reimplemented to update the routing table with the new typeB protocol,
+ * since protocol ids are added by the parent node after the configuration was applied.
+ *
+ * @param PBId	Protocol Id of typeB protocol to add.
+ */
+void Mux_nA_to_mB::AddProtocolBId(ProtocolId PBId)
+{
+	ObjectDataHandling_Abstract::AddProtocolBId(PBId);
+
+	UpdateRoutingTable();
+}
+
 /**
  * Reimplemented to set the custom parts from configuration for the datahandling object.
  *
@@ -71,9 +97,19 @@ bool Mux_nA_to_mB::setStateXml(XmlElement* stateXml)
 	else
 		return false;
 
+	UpdateRoutingTable();
+
 	return true;
 }
 
+/**
+ * Helper to rebuild the routing table from the current protocol ids and channel count configuration.
+ */
+void Mux_nA_to_mB::UpdateRoutingTable()
+{
+	m_routingTable.Rebuild(GetProtocolAIds(), GetProtocolBIds(), m_protoChCntA, m_protoChCntB);
+}
+
 /**
  * Method to be called by parent node on receiving data from node protocol with given id
  *
@@ -92,48 +128,22 @@ bool Mux_nA_to_mB::OnReceivedMessageFromProtocol(const ProtocolId PId, const Rem
 		return false;
 
 	UpdateOnlineState(PId);
-    
-    auto modMsgData = msgData;
-
-	if (m_protoChCntA>0 && m_protoChCntB>0)
-	{
-		auto PIdAIter = std::find(GetProtocolAIds().begin(), GetProtocolAIds().end(), PId);
-		auto PIdBIter = std::find(GetProtocolBIds().begin(), GetProtocolBIds().end(), PId);
-		if (PIdAIter != GetProtocolAIds().end())
-		{
-			jassert(msgData._addrVal._first <= m_protoChCntA);
-			auto protocolAIndex = PIdAIter - GetProtocolAIds().begin();
-			auto absChNr = static_cast<int>(protocolAIndex * m_protoChCntA) + msgData._addrVal._first;
-			auto protocolBIndex = absChNr / (m_protoChCntB + 1);
-			auto chForB = static_cast<std::int32_t>(absChNr % m_protoChCntB);
-			if (chForB == 0)
-				chForB = static_cast<std::int32_t>(m_protoChCntB);
-
-            modMsgData._addrVal._first = chForB;
-			if (GetProtocolBIds().size() >= protocolBIndex + 1)
-				if (msgMeta._ExternalId != GetProtocolBIds()[protocolBIndex] || msgMeta._Category != RemoteObjectMessageMetaInfo::MC_SetMessageAcknowledgement)
-					return parentNode->SendMessageTo(GetProtocolBIds()[protocolBIndex], roi, modMsgData);
-				else
-					return true;
-		}
-		else if (PIdBIter != GetProtocolBIds().end())
-		{
-			jassert(msgData._addrVal._first <= m_protoChCntB);
-			auto protocolBIndex = PIdBIter - GetProtocolBIds().begin();
-			auto absChNr = static_cast<int>(protocolBIndex * m_protoChCntB) + msgData._addrVal._first;
-			auto protocolAIndex = absChNr / (m_protoChCntA + 1);
-			auto chForA = static_cast<std::int32_t>(absChNr % m_protoChCntA);
-			if (chForA == 0)
-				chForA = static_cast<std::int32_t>(m_protoChCntA);
-
-            modMsgData._addrVal._first = chForA;
-			if (GetProtocolAIds().size() >= protocolAIndex + 1)
-				if (msgMeta._ExternalId != GetProtocolAIds()[protocolAIndex] || msgMeta._Category != RemoteObjectMessageMetaInfo::MC_SetMessageAcknowledgement)
-					return parentNode->SendMessageTo(GetProtocolAIds()[protocolAIndex], roi, modMsgData);
-				else
-					return true;
-		}
-	}
-
-	return false;
+
+	if (m_protoChCntA <= 0 || m_protoChCntB <= 0)
+		return false;
+
+	MuxRoutingTable::Route route;
+	if (!m_routingTable.GetRoute(PId, msgData._addrVal._first, route) || route.targetProtocolCount < 1)
+		return false;
+
+	jassert(msgData._addrVal._first <= (route.isTargetTypeA ? m_protoChCntB : m_protoChCntA));
+
+	auto targetPId = route.targetProtocols[0];
+	if (msgMeta._ExternalId == targetPId && msgMeta._Category == RemoteObjectMessageMetaInfo::MC_SetMessageAcknowledgement)
+		return true;
+
+	auto modMsgData = msgData;
+	modMsgData._addrVal._first = route.targetChannel;
+
+	return parentNode->SendMessageTo(targetPId, roi, modMsgData);
 }
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include "MuxRoutingTable.h"
 #include "../ObjectDataHandling_Abstract.h"
 #include "../../../RemoteProtocolBridgeCommon.h"
 #include "../../ProcessingEngineConfig.h"
@@ -39,6 +40,9 @@ public:
 	Mux_nA_to_mB(ProcessingEngineNode* parentNode);
 	~Mux_nA_to_mB();
 
+	void AddProtocolAId(ProtocolId PAId) override;
+	void AddProtocolBId(ProtocolId PBId) override;
+
 	bool setStateXml(XmlElement* stateXml) override;
 
 	bool OnReceivedMessageFromProtocol(const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, const RemoteObjectMessageMetaInfo& msgMeta) override;
@@ -50,7 +54,11 @@ protected:
 	ProtocolId MapObjectAddressing(ProtocolId PId, RemoteObjectMessageData& msgData);
 
 private:
+	void UpdateRoutingTable();
+
 	int m_protoChCntA;	/**< Channel count configuration value that is to be expected per protocol type A. */
 	int m_protoChCntB;	/**< Channel count configuration value that is to be expected per protocol type B. */
 
+	MuxRoutingTable	m_routingTable;	/**< The precomputed routes per source protocol and channel. */
+
 };
@@ -43,6 +43,34 @@ Mux_nA_to_mB_withValFilter::Mux_nA_to_mB_withValFilter(ProcessingEngineNode* par
  */
 Mux_nA_to_mB_withValFilter::~Mux_nA_to_mB_withValFilter()
 {
+	// held back values are forwarded through our reimplementation, so the flush timer must not outlive this object
+	stopTimerThread();
+}
+
+/**
+ * Reimplemented to update the routing table with the new typeA protocol,
+ * since protocol ids are added by the parent node after the configuration was applied.
+ *
+ * @param PAId	Protocol Id of typeA protocol to add.
+ */
+void Mux_nA_to_mB_withValFilter::AddProtocolAId(ProtocolId PAId)
+{
+	Forward_only_valueChanges::AddProtocolAId(PAId);
+
+	UpdateRoutingTable();
+}
+
+/**
+ * Reimplemented to update the routing table with the new typeB protocol,
+ * since protocol ids are added by the parent node after the configuration was applied.
+ *
+ * @param PBId	Protocol Id of typeB protocol to add.
+ */
+void Mux_nA_to_mB_withValFilter::AddProtocolBId(ProtocolId PBId)
+{
+	Forward_only_valueChanges::AddProtocolBId(PBId);
+
+	UpdateRoutingTable();
 }
 
 /**
@@ -68,9 +96,21 @@ bool Mux_nA_to_mB_withValFilter::setStateXml(XmlElement* stateXml)
 	else
 		return false;
 
+	UpdateRoutingTable();
+
 	return true;
 }
 
+/**
+ * Helper to rebuild the routing table from the current protocol ids and channel count configuration.
+ * The current values lock is held, to not rebuild the routes while a message or held back value is routed.
+ */
+void Mux_nA_to_mB_withValFilter::UpdateRoutingTable()
+{
+	const ScopedLock l(GetCurrentValuesLock());
+	m_routingTable.Rebuild(GetProtocolAIds(), GetProtocolBIds(), m_protoChCntA, m_protoChCntB);
+}
+
 /**
  * Method to be called by parent node on receiving data from node protocol with given id
  *
@@ -87,175 +127,124 @@ bool Mux_nA_to_mB_withValFilter::OnReceivedMessageFromProtocol(const ProtocolId
 	if (!parentNode)
 		return false;
 
-	// do some sanity checks on this instances configuration parameters and the given message data origin id
-	auto muxConfigValid = (m_protoChCntA > 0 || m_protoChCntA == INVALID_ADDRESS_VALUE) && (m_protoChCntB > 0 || m_protoChCntB == INVALID_ADDRESS_VALUE);
-	auto isProtocolTypeA = (std::find(GetProtocolAIds().begin(), GetProtocolAIds().end(), PId) != GetProtocolAIds().end());
-	auto isProtocolTypeB = (std::find(GetProtocolBIds().begin(), GetProtocolBIds().end(), PId) != GetProtocolBIds().end());
-	auto protocolIdValid = isProtocolTypeA || isProtocolTypeB;
-
-	if (!muxConfigValid || !protocolIdValid)
-		return false;
+	// cached values queries are replied to after releasing the lock as well
+	auto isCachedValuesQuery = IsCachedValuesQuery(roi);
 
-	UpdateOnlineState(PId);
+	// the received message data outlives sending, so its payload does not have to be copied
+	auto outgoingMessages = OutgoingMessages(false);
+	{
+		// the routes are only valid while the routing table is not rebuilt, which is done while holding the current values lock as well
+		const ScopedLock l(GetCurrentValuesLock());
 
-	if (IsCachedValuesQuery(roi))
-		return SendValueCacheToProtocol(PId);
+		// do some sanity checks on this instances configuration parameters and the given message data origin id
+		auto muxConfigValid = (m_protoChCntA > 0 || m_protoChCntA == INVALID_ADDRESS_VALUE) && (m_protoChCntB > 0 || m_protoChCntB == INVALID_ADDRESS_VALUE);
+		MuxRoutingTable::Route route;
+		auto protocolIdValid = muxConfigValid && GetRoute(PId, roi, msgData, route);
 
-	auto isGetValueQuery = IsGetValueQuery(roi, msgData);
-	if (isGetValueQuery)
-		SetCurrentValue(PId, roi, msgData._addrVal, RemoteObjectMessageData());
+		if (!muxConfigValid || !protocolIdValid)
+			return false;
 
-	auto modMsgData = msgData;
-	// check for changed value based on mapped addressing and target protocol id before forwarding data
-	auto targetProtoSrc = GetTargetProtocolsAndSource(PId, roi, modMsgData);
-	auto mappedOrigAddr = GetMappedOriginAddressing(PId, roi, modMsgData);
-	auto targetProtoValid = !targetProtoSrc.first.empty();
+		UpdateOnlineState(PId);
 
-	if (targetProtoValid && IsChangedDataValue(PId, roi, mappedOrigAddr, modMsgData))
-	{
-		// finally before forwarding data, the target channel has to be adjusted according to what we determined beforehand to be the correct mapped channel for target protocol
-        modMsgData._addrVal._first = targetProtoSrc.second;
-		auto overallSendSuccess = true;
-		for (auto const& targetPId : targetProtoSrc.first)
+		if (!isCachedValuesQuery)
 		{
-			if (msgMeta._ExternalId != targetPId || msgMeta._Category != RemoteObjectMessageMetaInfo::MC_SetMessageAcknowledgement)
-			{
-				// sending is only done when the value about to be sent is differing from the last known value from the protocol in question
-				if (IsChangedDataValue(targetPId, roi, modMsgData._addrVal, modMsgData, false))
-				{
-					auto isTargetProtocolTypeA = (std::find(GetProtocolAIds().begin(), GetProtocolAIds().end(), targetPId) != GetProtocolAIds().end());
-					auto isAcknowledgingProtocol = isTargetProtocolTypeA ? IsTypeAAcknowledging() : IsTypeBAcknowledging();
-
-					auto sendSuccess = parentNode->SendMessageTo(targetPId, roi, modMsgData);
-					// If the value was sent successfully, save it to cache (to make it the 'last known' from this protocol).
-					// In case the protocol is expected to acknowledge the value, we make an exception, since acknowledge values are
-					// used to update bridged protocols that have not yet received that latest value. E.g. DS100 ack values that are a
-					// reaction on a GenericOSC SET have to be bridged back to connected DiGiCo.
-					if ((sendSuccess && !isAcknowledgingProtocol) || isGetValueQuery)
-						SetCurrentValue(targetPId, roi, modMsgData._addrVal, modMsgData); // set the updated value as current for the complementary cache as well
-					overallSendSuccess = sendSuccess && overallSendSuccess;
-				}
-			}
+			auto isGetValueQuery = IsGetValueQuery(roi, msgData);
+			if (isGetValueQuery)
+				SetCurrentValue(PId, roi, msgData._addrVal, RemoteObjectMessageData());
+
+			// check for changed value based on mapped addressing and target protocol id before forwarding data
+			auto mappedOrigAddr = RemoteObjectAddressing(route.originChannel, msgData._addrVal._second);
+			auto targetProtoValid = route.targetProtocolCount > 0;
+
+			if (!targetProtoValid || !IsChangedDataValue(PId, roi, mappedOrigAddr, msgData))
+				return false;
+
+			// values of throttled objects are held back and forwarded by the flush timer, once the minimum interval has elapsed
+			if (IsValueForwardThrottled(PId, roi, mappedOrigAddr, msgData, msgMeta))
+				return true;
+
+			CollectTargetProtocolMessages(route, roi, msgData, msgMeta, isGetValueQuery, outgoingMessages);
 		}
-		return overallSendSuccess;
 	}
-	else
-		return false;
+
+	if (isCachedValuesQuery)
+		return SendValueCacheToProtocol(PId, msgData);
+
+	return SendOutgoingMessages(outgoingMessages);
 }
 
 /**
- * Method to derive the protocol and source id the incoming data has to be sent to, in respect to the given multiplexing configuration values.
+ * Reimplemented to collect the messages to forward a changed value to the protocols and channel it is multiplexed to.
  *
- * @param PId		The id of the protocol that received the data
- * @param roi		The object id the msgData belongs to
- * @param msgData	The actual message value/content data
- * @return			The protocol indexes the mapped value shall be sent to and the mapped source id to use when sending the data to the protocols
+ * @param PId				The id of the protocol that received the data
+ * @param roi				The object id to send a message for
+ * @param msgData			The actual message value/content data, addressed as originally received
+ * @param msgMeta			The meta information on the message data that was received
+ * @param isGetValueQuery	Bool indication if the message is a value query
+ * @param outgoingMessages	The messages to add the messages to forward the value to.
+ * @return	True if the value is to be forwarded, false if it cannot be routed
  */
-std::pair<std::vector<ProtocolId>, ChannelId> Mux_nA_to_mB_withValFilter::GetTargetProtocolsAndSource(const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectMessageData &msgData)
+bool Mux_nA_to_mB_withValFilter::CollectValueChange(const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, const RemoteObjectMessageMetaInfo& msgMeta, bool isGetValueQuery, OutgoingMessages& outgoingMessages)
 {
-	auto PIdAIter = std::find(GetProtocolAIds().begin(), GetProtocolAIds().end(), PId);
-	auto PIdBIter = std::find(GetProtocolBIds().begin(), GetProtocolBIds().end(), PId);
-	if (PIdAIter != GetProtocolAIds().end())
-	{
-		// if we deal with a keepalive, return all typeB protocols as target
-		if (IsKeepaliveObject(roi))
-			return std::make_pair(GetProtocolBIds(), msgData._addrVal._first);
-
-		auto protocolAIndex = PIdAIter - GetProtocolAIds().begin();
-		auto absChNr = static_cast<int>(protocolAIndex * (m_protoChCntA != INVALID_ADDRESS_VALUE ? m_protoChCntA : 0)) + msgData._addrVal._first;
-		auto chForB = 0;
-		auto protocolBIndex = 0;
-		if (m_protoChCntB > 0)
-		{
-			chForB = static_cast<std::int32_t>(absChNr % m_protoChCntB);
-			if (chForB == 0)
-				chForB = m_protoChCntB;
-			auto protocolBNr = static_cast<int>(((absChNr - 1) / m_protoChCntB) + 1.0f);
-			protocolBIndex = protocolBNr - 1;
-		}
-		if (chForB == 0)
-			chForB = static_cast<std::int32_t>(absChNr);
-
-		if (m_protoChCntB == INVALID_ADDRESS_VALUE)
-			// return all typeB protocols
-			return std::make_pair(GetProtocolBIds(), chForB);
-		else if (GetProtocolBIds().size() >= protocolBIndex + 1)
-			// return the single typeB protocol the message from typeB can be demultiplexed to, combined with the determined channel for the typeB protocol
-			return std::make_pair(std::vector<ProtocolId>{ GetProtocolBIds()[protocolBIndex] }, chForB);
-		else
-			// default no protocol id and mapped channel
-			return std::make_pair(std::vector<ProtocolId>(), chForB);
-	}
-	else if (PIdBIter != GetProtocolBIds().end())
-	{
-		// if we deal with a keepalive, return all typeA protocols as target
-		if (IsKeepaliveObject(roi))
-			return std::make_pair(GetProtocolAIds(), msgData._addrVal._first);
-
-		auto protocolBIndex = PIdBIter - GetProtocolBIds().begin();
-		auto absChNr = static_cast<int>(protocolBIndex * (m_protoChCntB != INVALID_ADDRESS_VALUE ? m_protoChCntB : 0)) + msgData._addrVal._first;
-		auto chForA = 0;
-		auto protocolAIndex = 0;
-		if (m_protoChCntA > 0)
-		{
-			chForA = static_cast<std::int32_t>(absChNr % m_protoChCntA);
-			if (chForA == 0)
-				chForA = m_protoChCntA;
-			auto protocolANr = static_cast<int>(((absChNr - 1) / m_protoChCntA) + 1.0f);
-			protocolAIndex = protocolANr - 1;
-		}
-		if (chForA == 0)
-			chForA = static_cast<std::int32_t>(absChNr);
-
-		if (m_protoChCntA == INVALID_ADDRESS_VALUE)
-			// return all typeA protocols
-			return std::make_pair(GetProtocolAIds(), chForA);
-		else if (GetProtocolAIds().size() >= protocolAIndex + 1)
-			// return the single typeA protocol the message from typeB can be demultiplexed to, combined with the determined channel for the typeA protocol
-			return std::make_pair(std::vector<ProtocolId>{ GetProtocolAIds()[protocolAIndex] }, chForA);
-		else
-			// default no protocol id and mapped channel
-			return std::make_pair(std::vector<ProtocolId>(), chForA);
-	}
-	else
-		jassertfalse; // unknown incoming protocol id may not happen!
+	MuxRoutingTable::Route route;
+	if (!GetRoute(PId, roi, msgData, route) || route.targetProtocolCount < 1)
+		return false;
 
-	return std::make_pair(std::vector<ProtocolId>(), static_cast<ChannelId>(INVALID_ADDRESS_VALUE));
+	CollectTargetProtocolMessages(route, roi, msgData, msgMeta, isGetValueQuery, outgoingMessages);
+	return true;
 }
 
 /**
- * Method to get a mapped object addressing that represents the actual absolute object addressing without (de-)multiplexing offsets.
+ * Helper to look up the route of a message in the routing table. Keepalive objects are routed
+ * to all protocols of the complementary type, without modifying the channel.
  *
  * @param PId		The id of the protocol that received the data
  * @param roi		The object id the msgData belongs to
  * @param msgData	The actual message value/content data
- * @return	The protocol index the mapped value shall be sent to
+ * @param route		The route to fill
+ * @return	True if the protocol id is known as typeA or typeB, false if not
  */
-RemoteObjectAddressing Mux_nA_to_mB_withValFilter::GetMappedOriginAddressing(const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData)
+bool Mux_nA_to_mB_withValFilter::GetRoute(const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, MuxRoutingTable::Route& route)
 {
-	ignoreUnused(roi);
-
-	auto PIdAIter = std::find(GetProtocolAIds().begin(), GetProtocolAIds().end(), PId);
-	auto PIdBIter = std::find(GetProtocolBIds().begin(), GetProtocolBIds().end(), PId);
-	// if the protocol id is found to belong to a protocol of type A, handle it accordingly
-	if (PIdAIter != GetProtocolAIds().end())
-	{
-		auto protocolAIndex = PIdAIter - GetProtocolAIds().begin();
-		auto absChNr = static_cast<int>(protocolAIndex * (m_protoChCntA != INVALID_ADDRESS_VALUE ? m_protoChCntA : 0)) + msgData._addrVal._first;
-
-		return RemoteObjectAddressing(absChNr, msgData._addrVal._second);
-	}
-	// otherwise if the protocol id is found to belong to a protocol of type B, handle it accordingly as well
-	else if (PIdBIter != GetProtocolBIds().end())
-	{
-		auto protocolBIndex = PIdBIter - GetProtocolBIds().begin();
-		auto absChNr = static_cast<int>(protocolBIndex * (m_protoChCntB != INVALID_ADDRESS_VALUE ? m_protoChCntB : 0)) + msgData._addrVal._first;
-
-		return RemoteObjectAddressing(absChNr, msgData._addrVal._second);
-	}
-	// invalid return if the given protocol id is neither known as type a nor b
+	if (IsKeepaliveObject(roi))
+		return m_routingTable.GetBroadcastRoute(PId, msgData._addrVal._first, route);
 	else
+		return m_routingTable.GetRoute(PId, msgData._addrVal._first, route);
+}
+
+/**
+ * Helper method to collect the messages to send a changed value to the given target protocols, using the given mapped channel.
+ * The current values lock has to be held by the caller, the collected messages are to be sent once it is released.
+ *
+ * @param route			The protocols to send to and the mapped channel to use, as looked up in the routing table
+ * @param roi				The object id to send a message for
+ * @param msgData			The actual message value/content data, addressed as originally received
+ * @param msgMeta			The meta information on the message data that was received
+ * @param isGetValueQuery	Bool indication if the message is a value query
+ * @param outgoingMessages	The messages to add the messages to the target protocols to.
+ */
+void Mux_nA_to_mB_withValFilter::CollectTargetProtocolMessages(const MuxRoutingTable::Route& route, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, const RemoteObjectMessageMetaInfo& msgMeta, bool isGetValueQuery, OutgoingMessages& outgoingMessages)
+{
+	// finally before forwarding data, the target channel has to be adjusted according to what we determined beforehand to be the correct mapped channel for target protocol
+	auto modMsgData = msgData;
+	modMsgData._addrVal._first = route.targetChannel;
+	auto isAcknowledgingProtocol = route.isTargetTypeA ? IsTypeAAcknowledging() : IsTypeBAcknowledging();
+	for (auto i = 0; i < route.targetProtocolCount; i++)
 	{
-		return RemoteObjectAddressing();
+		auto targetPId = route.targetProtocols[i];
+		if (msgMeta._ExternalId != targetPId || msgMeta._Category != RemoteObjectMessageMetaInfo::MC_SetMessageAcknowledgement)
+		{
+			// sending is only done when the value about to be sent is differing from the last known value from the protocol in question
+			if (IsChangedDataValue(targetPId, roi, modMsgData._addrVal, modMsgData, false))
+			{
+				// If the value was sent successfully, save it to cache (to make it the 'last known' from this protocol).
+				// In case the protocol is expected to acknowledge the value, we make an exception, since acknowledge values are
+				// used to update bridged protocols that have not yet received that latest value. E.g. DS100 ack values that are a
+				// reaction on a GenericOSC SET have to be bridged back to connected DiGiCo.
+				if (isGetValueQuery)
+					SetCurrentValue(targetPId, roi, modMsgData._addrVal, modMsgData); // set the updated value as current for the complementary cache as well
+				AddOutgoingMessage(outgoingMessages, targetPId, roi, modMsgData, !isAcknowledgingProtocol && !isGetValueQuery);
+			}
+		}
 	}
 }
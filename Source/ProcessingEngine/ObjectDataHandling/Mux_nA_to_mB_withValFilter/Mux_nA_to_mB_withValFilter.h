@@ -19,6 +19,7 @@
 #pragma once
 
 #include "../Forward_only_valueChanges/Forward_only_valueChanges.h"
+#include "../Mux_nA_to_mB/MuxRoutingTable.h"
 #include "../../../RemoteProtocolBridgeCommon.h"
 #include "../../ProcessingEngineConfig.h"
 
@@ -37,6 +38,9 @@ public:
 	Mux_nA_to_mB_withValFilter(ProcessingEngineNode* parentNode);
 	~Mux_nA_to_mB_withValFilter();
 
+	void AddProtocolAId(ProtocolId PAId) override;
+	void AddProtocolBId(ProtocolId PBId) override;
+
 	bool setStateXml(XmlElement* stateXml) override;
 
 	bool OnReceivedMessageFromProtocol(const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, const RemoteObjectMessageMetaInfo& msgMeta) override;
@@ -45,11 +49,16 @@ protected:
 	int GetProtoChCntA();
 	int GetProtoChCntB();
 
+	bool CollectValueChange(const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, const RemoteObjectMessageMetaInfo& msgMeta, bool isGetValueQuery, OutgoingMessages& outgoingMessages) override;
+
 private:
-	std::pair<std::vector<ProtocolId>, ChannelId> GetTargetProtocolsAndSource(const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectMessageData &msgData);
-	RemoteObjectAddressing GetMappedOriginAddressing(const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData);
+	void UpdateRoutingTable();
+	bool GetRoute(const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, MuxRoutingTable::Route& route);
+	void CollectTargetProtocolMessages(const MuxRoutingTable::Route& route, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, const RemoteObjectMessageMetaInfo& msgMeta, bool isGetValueQuery, OutgoingMessages& outgoingMessages);
 
 	int m_protoChCntA; /**< Channel count configuration value that is to be expected per protocol type A. */
 	int m_protoChCntB; /**< Channel count configuration value that is to be expected per protocol type B. */
 
+	MuxRoutingTable	m_routingTable;	/**< The precomputed routes per source protocol and channel. */
+
 };
@@ -47,6 +47,9 @@ ObjectDataHandling_Abstract::ObjectDataHandling_Abstract(ProcessingEngineNode* p
 	if (parentNode)
 		m_parentNodeId = parentNode->GetId();
 
+	for (auto& protocolReactionIndex : m_protocolReactionIndices)
+		protocolReactionIndex.store(-1);
+
 	SetProtocolReactionTimeout(5100);
 }
 
@@ -55,6 +58,9 @@ ObjectDataHandling_Abstract::ObjectDataHandling_Abstract(ProcessingEngineNode* p
  */
 ObjectDataHandling_Abstract::~ObjectDataHandling_Abstract()
 {
+	// the monitor accesses the protocol states, so it must be stopped before these are torn down
+	m_onlineStateMonitor.stopTimerThread();
+
 	for (auto const& aid : m_protocolAIds)
 		SetChangedProtocolState(aid, OHS_Protocol_Down);
 	for (auto const& bid : m_protocolBIds)
@@ -92,8 +98,11 @@ bool ObjectDataHandling_Abstract::setStateXml(XmlElement* stateXml)
 				m_protocolsWithReactionMonitoring.push_back(protocolId);
 		}
 	}
+
+	for (auto i = 0; i < m_protocolReactionCount.load(); i++)
+		m_protocolReactions[static_cast<std::size_t>(i)].isMonitored.store(IsReactionMonitored(m_protocolReactions[static_cast<std::size_t>(i)].protocolId.load()));
 	
-	startTimer(static_cast<int>(GetProtocolReactionTimeout()));
+	m_onlineStateMonitor.startTimerThread(static_cast<int>(GetProtocolReactionTimeout()));
 
 	return true;
 }
@@ -107,8 +116,7 @@ void ObjectDataHandling_Abstract::AddProtocolAId(ProtocolId PAId)
 {
 	m_protocolAIds.push_back(PAId);
 
-	ScopedLock l(m_protocolReactionTSLock);
-	m_protocolReactionTSMap[PAId] = Time::getMillisecondCounterHiRes();
+	AddProtocolReaction(PAId);
 
 	SetChangedProtocolState(PAId, OHS_Protocol_Down);
 }
@@ -122,8 +130,7 @@ void ObjectDataHandling_Abstract::AddProtocolBId(ProtocolId PBId)
 {
 	m_protocolBIds.push_back(PBId);
 
-	ScopedLock l(m_protocolReactionTSLock);
-	m_protocolReactionTSMap[PBId] = Time::getMillisecondCounterHiRes();
+	AddProtocolReaction(PBId);
 
 	SetChangedProtocolState(PBId, OHS_Protocol_Down);
 }
@@ -137,10 +144,14 @@ void ObjectDataHandling_Abstract::ClearProtocolIds()
 	m_protocolAIds.clear();
 	m_protocolBIds.clear();
 
-	m_currentStateMap.clear();
+	{
+		const ScopedLock l(m_protocolStateLock);
+		m_currentStateMap.clear();
+	}
 
-	ScopedLock	tsAccessLock(m_protocolReactionTSLock);
-	m_protocolReactionTSMap.clear();
+	for (auto& protocolReactionIndex : m_protocolReactionIndices)
+		protocolReactionIndex.store(-1);
+	m_protocolReactionCount.store(0);
 	m_protocolsWithReactionMonitoring.clear();
 }
 
@@ -223,6 +234,8 @@ const std::vector<ProtocolId>& ObjectDataHandling_Abstract::GetProtocolBIds()
  */
 void ObjectDataHandling_Abstract::SetChangedProtocolState(ProtocolId id, ObjectHandlingState state)
 {
+	const ScopedLock l(m_protocolStateLock);
+
 	if (m_currentStateMap.count(id) <= 0 || m_currentStateMap.at(id) != state)
 	{
 		// if new state includes down, remove up from hashed states
@@ -255,6 +268,8 @@ void ObjectDataHandling_Abstract::SetChangedProtocolState(ProtocolId id, ObjectH
  */
 void ObjectDataHandling_Abstract::AddStateListener(ObjectDataHandling_Abstract::StateListener* listener)
 {
+	const ScopedLock l(m_protocolStateLock);
+
 	if (nullptr != listener && std::find(m_stateListeners.begin(), m_stateListeners.end(), listener) == m_stateListeners.end())
 	{
 		m_stateListeners.push_back(listener);
@@ -272,6 +287,8 @@ void ObjectDataHandling_Abstract::AddStateListener(ObjectDataHandling_Abstract::
  */
 bool ObjectDataHandling_Abstract::RemoveStateListener(ObjectDataHandling_Abstract::StateListener* listener)
 {
+	const ScopedLock l(m_protocolStateLock);
+
 	auto listenerIter = std::find(m_stateListeners.begin(), m_stateListeners.end(), listener);
 	if (listener && listenerIter != m_stateListeners.end())
 	{
@@ -289,6 +306,8 @@ bool ObjectDataHandling_Abstract::RemoveStateListener(ObjectDataHandling_Abstrac
  */
 ObjectHandlingState ObjectDataHandling_Abstract::GetProtocolState(ProtocolId id)
 {
+	const ScopedLock l(m_protocolStateLock);
+
 	if (m_currentStateMap.count(id) <= 0)
 		return OHS_Invalid;
 	else
@@ -296,70 +315,145 @@ ObjectHandlingState ObjectDataHandling_Abstract::GetProtocolState(ProtocolId id)
 }
 
 /**
- * Reimplemented from Timer to update the status of all active protocols.
- * Currently this implementation only takes care of online status based on TS map.
+ * Method called by the online state monitor thread to update the status of all monitored protocols.
+ * Only the transition to down is notified, for protocols that have not received data in more than the reaction timeout.
  */
-void ObjectDataHandling_Abstract::timerCallback()
+void ObjectDataHandling_Abstract::EvaluateOnlineStates()
 {
-	for (auto const& id : GetProtocolAIds())
-	{
-		ScopedLock	tsAccessLock(m_protocolReactionTSLock);
-		// if a definition of protocols to handle regarding their online state exists but the incoming protocol is not part of them, continue
-		if (!m_protocolsWithReactionMonitoring.empty() && (std::find(m_protocolsWithReactionMonitoring.begin(), m_protocolsWithReactionMonitoring.end(), id) == m_protocolsWithReactionMonitoring.end()))
-			continue;
-		// if the protocol is not present in map, continue
-		if (m_protocolReactionTSMap.count(id) <= 0)
-			continue;
-		// if the protocol has not received data in more than what is specified in timeouttime, set it to down
-		else if (Time::getMillisecondCounterHiRes() - GetLastProtocolReactionTSMap().at(id) > GetProtocolReactionTimeout())
-			SetChangedProtocolState(id, OHS_Protocol_Down);
-	}
-	for (auto const& id : GetProtocolBIds())
+	auto protocolReactionTimeout = GetProtocolReactionTimeout();
+	auto protocolReactionCount = m_protocolReactionCount.load(std::memory_order_acquire);
+	for (auto i = 0; i < protocolReactionCount; i++)
 	{
-		ScopedLock	tsAccessLock(m_protocolReactionTSLock);
-		// if a definition of protocols to handle regarding their online state exists but the incoming protocol is not part of them, continue
-		if (!m_protocolsWithReactionMonitoring.empty() && (std::find(m_protocolsWithReactionMonitoring.begin(), m_protocolsWithReactionMonitoring.end(), id) == m_protocolsWithReactionMonitoring.end()))
+		auto& protocolReaction = m_protocolReactions[static_cast<std::size_t>(i)];
+		// if a definition of protocols to handle regarding their online state exists but the protocol is not part of them, continue
+		if (!protocolReaction.isMonitored.load(std::memory_order_relaxed))
 			continue;
-		// if the protocol is not present in map, continue
-		if (m_protocolReactionTSMap.count(id) <= 0)
-			continue;
-		// if the protocol has not received data in more than what is specified in timeouttime, set it to down
-		else if (Time::getMillisecondCounterHiRes() - GetLastProtocolReactionTSMap().at(id) > GetProtocolReactionTimeout())
-			SetChangedProtocolState(id, OHS_Protocol_Down);
+
+		auto staleTime = GetStaleTime(protocolReaction);
+		if (staleTime > protocolReactionTimeout && protocolReaction.isOnline.exchange(false))
+			SetChangedProtocolState(protocolReaction.protocolId.load(std::memory_order_relaxed), OHS_Protocol_Down);
 	}
 }
 
 /**
- * Method to update internal 'last seen' timestamp map for a given protocol.
- * This also updates protocol status according to timestamping info.
+ * Method to update the 'last seen' timestamp for a given protocol.
+ * This is called for every received message and therefor does not lock anything,
+ * only the transition to up, when the protocol receives data the first time or after being regarded as down, is notified.
  * @param	id	The protocol to update the online state for
  */
 void ObjectDataHandling_Abstract::UpdateOnlineState(ProtocolId id)
 {
-	ScopedLock	tsAccessLock(m_protocolReactionTSLock);
+	auto protocolReactionIndex = FindProtocolReaction(id);
+	if (protocolReactionIndex < 0)
+		return;
 
-	// if the protocol is not present in map and therefor seems to have initially received data, set its status to UP
-	if (0 >= m_protocolReactionTSMap.count(id))
-		SetChangedProtocolState(id, OHS_Protocol_Up);
-	// if the protocol is receiving data the first time after 1s of silence, set its status to UP
-	else if (Time::getMillisecondCounterHiRes() - GetLastProtocolReactionTSMap().at(id) > m_protocolReactionTimeout)
-		SetChangedProtocolState(id, OHS_Protocol_Up);
-	// generally if the state is not up, set it to up now
-	else if (OHS_Protocol_Up != (OHS_Protocol_Up | GetProtocolState(id)))
+	auto& protocolReaction = m_protocolReactions[static_cast<std::size_t>(protocolReactionIndex)];
+	protocolReaction.lastSeenMs.store(GetMillisecondCounter(), std::memory_order_relaxed);
+	if (!protocolReaction.isOnline.exchange(true))
 		SetChangedProtocolState(id, OHS_Protocol_Up);
+}
 
-	m_protocolReactionTSMap[id] = Time::getMillisecondCounterHiRes();
+/**
+ * Getter for the time that has passed since a protocol last received data.
+ * This is safe to be called from any thread.
+ * @param	id	The protocol to get the stale time for
+ * @return	The time in ms, zero if the protocol is not known
+ */
+std::uint32_t ObjectDataHandling_Abstract::GetProtocolStaleTime(ProtocolId id)
+{
+	auto protocolReactionIndex = FindProtocolReaction(id);
+	if (protocolReactionIndex < 0)
+		return 0;
+
+	return GetStaleTime(m_protocolReactions[static_cast<std::size_t>(protocolReactionIndex)]);
 }
 
 /**
- * Getter for the internal hash of last-seen timestamps per protocol
- * @return	The requested map reference
+ * Helper method to get the time that has passed since a protocol last reacted.
+ * The timestamp is loaded before the current time is taken, and a timestamp that is still newer,
+ * e.g. because a receiving thread updated it meanwhile, results in zero instead of wrapping around to a huge stale time.
+ * @param	protocolReaction	The reaction monitoring data of the protocol
+ * @return	The time in ms
  */
-const std::map<ProtocolId, double>& ObjectDataHandling_Abstract::GetLastProtocolReactionTSMap()
+std::uint32_t ObjectDataHandling_Abstract::GetStaleTime(const ProtocolReaction& protocolReaction)
 {
-	// no locking of m_lastProtocolReactionTSLock here, since this supposed to only be called from the node processing thread
+	auto lastSeenMs = protocolReaction.lastSeenMs.load(std::memory_order_relaxed);
+	auto staleTime = static_cast<std::int32_t>(GetMillisecondCounter() - lastSeenMs);
+	return static_cast<std::uint32_t>(jmax(0, staleTime));
+}
 
-	return m_protocolReactionTSMap;
+/**
+ * Getter for the millisecond counter the protocol reactions are timestamped and evaluated with.
+ * Can be reimplemented to run the reaction monitoring on a simulated time, e.g. to test failover deterministically.
+ * This is called from any thread.
+ * @return	The millisecond counter value
+ */
+std::uint32_t ObjectDataHandling_Abstract::GetMillisecondCounter()
+{
+	return Time::getMillisecondCounter();
+}
+
+/**
+ * Helper method to find the index of the reaction monitoring data of a protocol.
+ * Protocol ids up to s_maxDenseProtocolId are resolved through the dense index, larger ones by iterating the few protocols.
+ * @param	id	The protocol to find the data for
+ * @return	The index in the dense reaction monitoring data, -1 if the protocol is not known
+ */
+int ObjectDataHandling_Abstract::FindProtocolReaction(ProtocolId id) const
+{
+	if (id <= static_cast<ProtocolId>(s_maxDenseProtocolId))
+		return m_protocolReactionIndices[static_cast<std::size_t>(id)].load(std::memory_order_acquire);
+
+	auto protocolReactionCount = m_protocolReactionCount.load(std::memory_order_acquire);
+	for (auto i = 0; i < protocolReactionCount; i++)
+		if (m_protocolReactions[static_cast<std::size_t>(i)].protocolId.load(std::memory_order_relaxed) == id)
+			return i;
+
+	return -1;
+}
+
+/**
+ * Helper method to add reaction monitoring data for a protocol, regarding it as just seen but not yet up.
+ * Protocols are only added while configuring, the data of a protocol already known is reset.
+ * @param	id	The protocol to add the data for
+ */
+void ObjectDataHandling_Abstract::AddProtocolReaction(ProtocolId id)
+{
+	auto protocolReactionIndex = FindProtocolReaction(id);
+	auto isNewProtocol = (protocolReactionIndex < 0);
+	if (isNewProtocol)
+	{
+		protocolReactionIndex = m_protocolReactionCount.load();
+		if (protocolReactionIndex >= s_maxProtocolCount)
+		{
+			jassertfalse; // more protocols than supported by reaction monitoring
+			return;
+		}
+	}
+
+	auto& protocolReaction = m_protocolReactions[static_cast<std::size_t>(protocolReactionIndex)];
+	protocolReaction.protocolId.store(id);
+	protocolReaction.lastSeenMs.store(GetMillisecondCounter());
+	protocolReaction.isOnline.store(false);
+	protocolReaction.isMonitored.store(IsReactionMonitored(id));
+
+	// publish the data only once it is completely initialized
+	if (isNewProtocol)
+	{
+		m_protocolReactionCount.store(protocolReactionIndex + 1, std::memory_order_release);
+		if (id <= static_cast<ProtocolId>(s_maxDenseProtocolId))
+			m_protocolReactionIndices[static_cast<std::size_t>(id)].store(protocolReactionIndex, std::memory_order_release);
+	}
+}
+
+/**
+ * Helper method to check if a protocol is to be taken into account when evaluating reactiveness.
+ * @param	id	The protocol to check
+ * @return	True if no protocols to monitor are configured or the protocol is one of them, false if not
+ */
+bool ObjectDataHandling_Abstract::IsReactionMonitored(ProtocolId id) const
+{
+	return m_protocolsWithReactionMonitoring.empty() || (std::find(m_protocolsWithReactionMonitoring.begin(), m_protocolsWithReactionMonitoring.end(), id) != m_protocolsWithReactionMonitoring.end());
 }
 
 /**
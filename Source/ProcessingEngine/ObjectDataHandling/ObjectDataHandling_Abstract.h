@@ -21,6 +21,7 @@
 #include "../../RemoteProtocolBridgeCommon.h"
 
 #include "../ProcessingEngineConfig.h"
+#include "../TimerThreadBase.h"
 
 #include <JuceHeader.h>
 
@@ -30,8 +31,7 @@ class ProcessingEngineNode;
 /**
  * Class ObjectDataHandling_Abstract is an abstract interfacing base class for .
  */
-class ObjectDataHandling_Abstract : public ProcessingEngineConfig::XmlConfigurableElement,
-	public Timer
+class ObjectDataHandling_Abstract : public ProcessingEngineConfig::XmlConfigurableElement
 {
 public:
 	class StateListener : private MessageListener
@@ -116,9 +116,6 @@ public:
 	//==============================================================================
 	virtual void UpdateOnlineState(ProtocolId id);
 
-	//==============================================================================
-	void timerCallback() override;
-
 	//==============================================================================
 	static bool IsKeepaliveObject(const RemoteObjectIdentifier roi);
 	static bool IsGetValueQuery(const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData);
@@ -130,9 +127,49 @@ protected:
 	const std::vector<ProtocolId>&		GetProtocolAIds();
 	const std::vector<ProtocolId>&		GetProtocolBIds();
 	void								SetChangedProtocolState(ProtocolId id, ObjectHandlingState state);
-	const std::map<ProtocolId, double>&	GetLastProtocolReactionTSMap();
+	std::uint32_t						GetProtocolStaleTime(ProtocolId id);
+
+	virtual std::uint32_t				GetMillisecondCounter();
 
 private:
+	/**
+	 * The reaction monitoring data of a protocol. It is written by the threads delivering
+	 * received messages and read by the online state monitor without any locking.
+	 */
+	struct ProtocolReaction
+	{
+		std::atomic<ProtocolId>		protocolId{ 0 };		/**< The id of the protocol. */
+		std::atomic<std::uint32_t>	lastSeenMs{ 0 };		/**< The millisecond counter value the protocol last reacted at. */
+		std::atomic<bool>			isOnline{ false };		/**< Indication if the protocol was last notified as up. */
+		std::atomic<bool>			isMonitored{ true };	/**< Indication if the protocol is taken into account when evaluating reactiveness. */
+	};
+
+	/**
+	 * Thread to periodically evaluate the online state of the protocols, to not burden the message thread with it.
+	 */
+	class OnlineStateMonitor : public TimerThreadBase
+	{
+	public:
+		explicit OnlineStateMonitor(ObjectDataHandling_Abstract& owner) : m_owner(owner) {};
+		~OnlineStateMonitor() override { stopTimerThread(); };
+
+	protected:
+		void timerThreadCallback() override { m_owner.EvaluateOnlineStates(); };
+
+	private:
+		ObjectDataHandling_Abstract&	m_owner;	/**< The object to evaluate the online states of. */
+	};
+
+	int		FindProtocolReaction(ProtocolId id) const;
+	void	AddProtocolReaction(ProtocolId id);
+	bool	IsReactionMonitored(ProtocolId id) const;
+	void	EvaluateOnlineStates();
+
+	std::uint32_t	GetStaleTime(const ProtocolReaction& protocolReaction);
+
+	static constexpr int s_maxProtocolCount = 64;		/**< The maximum number of protocols the reactiveness can be monitored for. */
+	static constexpr int s_maxDenseProtocolId = 1024;	/**< The highest protocol id resolved to its reaction monitoring data through the dense index. */
+
 	ProcessingEngineNode*				m_parentNode;		/**< The parent node object. Needed for e.g. triggering receive notifications. */
 	ObjectHandlingMode					m_mode;				/**< Mode identifier enabling resolving derived instance type. */
 	NodeId								m_parentNodeId;		/**< The id of the objects' parent node. */
@@ -140,11 +177,15 @@ private:
 	std::vector<ProtocolId>				m_protocolBIds;		/**< Id list of protocols of type B that is active for the node and this handling module therefor. */
 
 	std::vector<ProtocolId>				m_protocolsWithReactionMonitoring;	/**< List of protocols that shall be taken into account when processing reativeness (empty means all incoming are processed). */
-	CriticalSection						m_protocolReactionTSLock;			/**< Threadsafety measure, since timestamps are written from node processing thread while others might access them from event loop. */
-	std::map<ProtocolId, double>		m_protocolReactionTSMap;			/**< Map of protocols and their last-seen-active TimeStamps. */
-	double								m_protocolReactionTimeout;			/**< Timeout in ms when a protocol is regarded as down. */
+	std::array<ProtocolReaction, s_maxProtocolCount>			m_protocolReactions;		/**< The dense reaction monitoring data of all protocols. */
+	std::atomic<int>											m_protocolReactionCount{ 0 };	/**< The number of protocols in the dense reaction monitoring data. */
+	std::array<std::atomic<int>, s_maxDenseProtocolId + 1>		m_protocolReactionIndices;	/**< The index of the reaction monitoring data per protocol id, -1 if not known. */
+	std::atomic<double>					m_protocolReactionTimeout;			/**< Timeout in ms when a protocol is regarded as down. */
 
+	CriticalSection								m_protocolStateLock;		/**< Threadsafety measure, since state transitions are notified from the protocol threads as well as the online state monitor. */
 	std::vector<StateListener*>					m_stateListeners;			/**< The list of objects that are registered to be notified on internal status changes. */
 	std::map<ProtocolId, ObjectHandlingState>	m_currentStateMap;
 
+	OnlineStateMonitor					m_onlineStateMonitor{ *this };		/**< The thread evaluating the online states of the protocols. */
+
 };
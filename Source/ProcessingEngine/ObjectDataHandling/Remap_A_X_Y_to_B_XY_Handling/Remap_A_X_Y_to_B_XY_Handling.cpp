@@ -41,6 +41,46 @@ Remap_A_X_Y_to_B_XY_Handling::Remap_A_X_Y_to_B_XY_Handling(ProcessingEngineNode*
  */
 Remap_A_X_Y_to_B_XY_Handling::~Remap_A_X_Y_to_B_XY_Handling()
 {
+	stopTimerThread();
+}
+
+/**
+ * Reimplemented to set the custom parts from configuration for the datahandling object.
+ * The optional xyMergeWindow element holds the merge window in ms (interval) and if the messages split
+ * from xy data are sent as one bundle (state). Without it, every position component is forwarded right away
+ * and the split messages are sent separately.
+ *
+ * @param stateXml	The configuration data to parse and set active
+ * @return True on success, false on failure
+ */
+bool Remap_A_X_Y_to_B_XY_Handling::setStateXml(XmlElement* stateXml)
+{
+	if (!ObjectDataHandling_Abstract::setStateXml(stateXml))
+		return false;
+
+	auto xyMergeWindowXmlElement = stateXml->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::XYMERGEWINDOW));
+	{
+		const ScopedLock l(m_currentPosValueLock);
+		if (xyMergeWindowXmlElement)
+		{
+			m_xyMergeWindowMs = jmax(0, xyMergeWindowXmlElement->getIntAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::INTERVAL)));
+			m_xySplitBundled = 1 == xyMergeWindowXmlElement->getIntAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::STATE));
+		}
+		else
+		{
+			m_xyMergeWindowMs = 0;
+			m_xySplitBundled = false;
+		}
+		m_pendingPositions.clear();
+	}
+
+	// positions waiting for their other component are forwarded at the latest half a merge window late
+	if (m_xyMergeWindowMs > 0)
+		startTimerThread(jmax(1, m_xyMergeWindowMs / 2));
+	else if (isTimerThreadRunning())
+		stopTimerThread();
+
+	return true;
 }
 
 /**
@@ -66,60 +106,53 @@ bool Remap_A_X_Y_to_B_XY_Handling::OnReceivedMessageFromProtocol(const ProtocolI
 	{
 		// the message was received by a typeA protocol
 
-		RemoteObjectIdentifier ObjIdToSend = roi;
-
-		if (roi == ROI_CoordinateMapping_SourcePosition_X)
-		{
-			// special handling of merging separate x message to a combined xy one
-			jassert(msgData._valType == ROVT_FLOAT);
-			jassert(msgData._valCount == 1);
-			jassert(msgData._payloadSize == sizeof(float));
-
-			uint32 addrId = msgData._addrVal._first + (msgData._addrVal._second << 16);
-
-			xyzVals newVals = m_currentPosValue[addrId];
-			newVals.x = ((float*)msgData._payload)[0];
-			m_currentPosValue.set(addrId, newVals);
-
-			float newXYVal[2];
-			newXYVal[0] = m_currentPosValue[addrId].x;
-			newXYVal[1] = m_currentPosValue[addrId].y;
-
-            modMsgData._valCount = 2;
-            modMsgData._payload = &newXYVal;
-            modMsgData._payloadSize = 2 * sizeof(float);
-
-			ObjIdToSend = ROI_CoordinateMapping_SourcePosition_XY;
-		}
-		else if (roi == ROI_CoordinateMapping_SourcePosition_Y)
+		if (roi == ROI_CoordinateMapping_SourcePosition_X || roi == ROI_CoordinateMapping_SourcePosition_Y)
 		{
-			// special handling of merging separate y message to a combined xy one
+			// special handling of merging separate x or y message to a combined xy one
 			jassert(msgData._valType == ROVT_FLOAT);
 			jassert(msgData._valCount == 1);
 			jassert(msgData._payloadSize == sizeof(float));
 
 			int32 addrId = msgData._addrVal._first + (msgData._addrVal._second << 16);
+			auto isX = (roi == ROI_CoordinateMapping_SourcePosition_X);
+
+			const ScopedLock l(m_currentPosValueLock);
 
 			xyzVals newVals = m_currentPosValue[addrId];
-			newVals.y = ((float*)msgData._payload)[0];
+			if (isX)
+				newVals.x = ((float*)msgData._payload)[0];
+			else
+				newVals.y = ((float*)msgData._payload)[0];
 			m_currentPosValue.set(addrId, newVals);
 
-			float newXYVal[2];
-			newXYVal[0] = m_currentPosValue[addrId].x;
-			newXYVal[1] = m_currentPosValue[addrId].y;
+			// within the merge window, the position is only forwarded once both components were received or the window has elapsed
+			if (m_xyMergeWindowMs > 0)
+			{
+				auto pendingPositionIter = m_pendingPositions.find(addrId);
+				if (pendingPositionIter == m_pendingPositions.end())
+				{
+					m_pendingPositions.insert(std::make_pair(addrId, PendingPosition{ msgData._addrVal, msgMeta, Time::getMillisecondCounterHiRes() + m_xyMergeWindowMs, isX, !isX }));
+					return true;
+				}
+
+				auto& pendingPosition = pendingPositionIter->second;
+				pendingPosition.msgMeta = msgMeta;
+				pendingPosition.isXReceived = pendingPosition.isXReceived || isX;
+				pendingPosition.isYReceived = pendingPosition.isYReceived || !isX;
+				if (!pendingPosition.isXReceived || !pendingPosition.isYReceived)
+					return true;
 
-            modMsgData._valCount = 2;
-            modMsgData._payload = &newXYVal;
-            modMsgData._payloadSize = 2 * sizeof(float);
+				m_pendingPositions.erase(pendingPositionIter);
+			}
 
-			ObjIdToSend = ROI_CoordinateMapping_SourcePosition_XY;
+			return SendPositionToProtocolsB(addrId, msgData._addrVal, msgMeta);
 		}
 
 		// Send to all typeB protocols
 		auto sendSuccess = true;
 		for (auto const& protocolB : GetProtocolBIds())
 			if (msgMeta._ExternalId != protocolB || msgMeta._Category != RemoteObjectMessageMetaInfo::MC_SetMessageAcknowledgement)
-				sendSuccess = parentNode->SendMessageTo(protocolB, ObjIdToSend, modMsgData) && sendSuccess;
+				sendSuccess = parentNode->SendMessageTo(protocolB, roi, modMsgData) && sendSuccess;
 
 		return sendSuccess;
 			
@@ -135,13 +168,16 @@ bool Remap_A_X_Y_to_B_XY_Handling::OnReceivedMessageFromProtocol(const ProtocolI
 
 			int32 addrId = msgData._addrVal._first + (msgData._addrVal._second << 16);
 
-			xyzVals newVals = m_currentPosValue[addrId];
-			newVals.x = ((float*)msgData._payload)[0];
-			newVals.y = ((float*)msgData._payload)[1];
-			m_currentPosValue.set(addrId, newVals);
+			float newXVal = ((float*)msgData._payload)[0];
+			float newYVal = ((float*)msgData._payload)[1];
+			{
+				const ScopedLock l(m_currentPosValueLock);
 
-			float newXVal = m_currentPosValue[addrId].x;
-			float newYVal = m_currentPosValue[addrId].y;
+				xyzVals newVals = m_currentPosValue[addrId];
+				newVals.x = newXVal;
+				newVals.y = newYVal;
+				m_currentPosValue.set(addrId, newVals);
+			}
 
             modMsgData._valCount = 1;
             modMsgData._payloadSize = sizeof(float);
@@ -152,6 +188,17 @@ bool Remap_A_X_Y_to_B_XY_Handling::OnReceivedMessageFromProtocol(const ProtocolI
 			{
 				if (msgMeta._ExternalId != protocolA || msgMeta._Category != RemoteObjectMessageMetaInfo::MC_SetMessageAcknowledgement)
 				{
+					if (m_xySplitBundled)
+					{
+						// send both messages in one go, for the receiver to get x and y of the same position together
+						RemoteObjectIdentifier splitRois[2] = { ROI_CoordinateMapping_SourcePosition_X, ROI_CoordinateMapping_SourcePosition_Y };
+						RemoteObjectMessageData splitMsgData[2] = { modMsgData, modMsgData };
+						splitMsgData[0]._payload = &newXVal;
+						splitMsgData[1]._payload = &newYVal;
+						sendSuccess = parentNode->SendMessagesTo(protocolA, splitRois, splitMsgData, 2) && sendSuccess;
+						continue;
+					}
+
 					modMsgData._payload = &newXVal;
 					sendSuccess = parentNode->SendMessageTo(protocolA, ROI_CoordinateMapping_SourcePosition_X, modMsgData) && sendSuccess;
 
@@ -176,3 +223,54 @@ bool Remap_A_X_Y_to_B_XY_Handling::OnReceivedMessageFromProtocol(const ProtocolI
 
 	return false;
 }
+
+/**
+ * Reimplemented from TimerThreadBase to forward the positions whose merge window has elapsed
+ * without the other component being received.
+ */
+void Remap_A_X_Y_to_B_XY_Handling::timerThreadCallback()
+{
+	const ScopedLock l(m_currentPosValueLock);
+
+	auto nowMs = Time::getMillisecondCounterHiRes();
+	for (auto pendingPositionIter = m_pendingPositions.begin(); pendingPositionIter != m_pendingPositions.end(); )
+	{
+		if (pendingPositionIter->second.dueTimeMs <= nowMs)
+		{
+			SendPositionToProtocolsB(pendingPositionIter->first, pendingPositionIter->second.addressing, pendingPositionIter->second.msgMeta);
+			pendingPositionIter = m_pendingPositions.erase(pendingPositionIter);
+		}
+		else
+			++pendingPositionIter;
+	}
+}
+
+/**
+ * Helper method to send the current combined xy position of an object to all typeB protocols.
+ * The lock for the current positions has to be held by the caller.
+ *
+ * @param addrId		The id the current position is hashed with
+ * @param addressing	The addressing to send the position with
+ * @param msgMeta		The meta information on the message data that was last received for the position
+ * @return	True if successful sent/forwarded, false if not
+ */
+bool Remap_A_X_Y_to_B_XY_Handling::SendPositionToProtocolsB(int32 addrId, const RemoteObjectAddressing& addressing, const RemoteObjectMessageMetaInfo& msgMeta)
+{
+	auto parentNode = ObjectDataHandling_Abstract::GetParentNode();
+	if (!parentNode)
+		return false;
+
+	float newXYVal[2];
+	newXYVal[0] = m_currentPosValue[addrId].x;
+	newXYVal[1] = m_currentPosValue[addrId].y;
+
+	auto xyMsgData = RemoteObjectMessageData(addressing, ROVT_FLOAT, 2, &newXYVal, 2 * sizeof(float));
+
+	// Send to all typeB protocols
+	auto sendSuccess = true;
+	for (auto const& protocolB : GetProtocolBIds())
+		if (msgMeta._ExternalId != protocolB || msgMeta._Category != RemoteObjectMessageMetaInfo::MC_SetMessageAcknowledgement)
+			sendSuccess = parentNode->SendMessageTo(protocolB, ROI_CoordinateMapping_SourcePosition_XY, xyMsgData) && sendSuccess;
+
+	return sendSuccess;
+}
@@ -21,6 +21,7 @@
 #include "../ObjectDataHandling_Abstract.h"
 #include "../../../RemoteProtocolBridgeCommon.h"
 #include "../../ProcessingEngineConfig.h"
+#include "../../TimerThreadBase.h"
 
 #include <JuceHeader.h>
 
@@ -32,8 +33,10 @@ class ProcessingEngineNode;
  * of separate received x and y position data from protocol a to a combined xy data message
  * forwarded to protocol b. Combined xy data received from protocol b on the other hand is
  * split in two messages and sent out over protocol a. Other data is simply bypassed.
+ * Optionally, x and y data received within a short merge window is combined into a single xy message,
+ * and the two messages split from xy data are sent as one bundle.
  */
-class Remap_A_X_Y_to_B_XY_Handling : public ObjectDataHandling_Abstract
+class Remap_A_X_Y_to_B_XY_Handling : public ObjectDataHandling_Abstract, public TimerThreadBase
 {
 	// helper type to be used in hashmap for three position related floats
     struct xyzVals
@@ -43,13 +46,38 @@ class Remap_A_X_Y_to_B_XY_Handling : public ObjectDataHandling_Abstract
 		float z;	//< z pos component. */
 	};
 
+	/**
+	 * A position of which only one component was received yet, waiting for the other one within the merge window.
+	 */
+	struct PendingPosition
+	{
+		RemoteObjectAddressing		addressing;		/**< The addressing of the position. */
+		RemoteObjectMessageMetaInfo	msgMeta;		/**< The meta info of the last received component message. */
+		double						dueTimeMs;		/**< The time in ms the position is to be forwarded at, even if the other component was not received. */
+		bool						isXReceived;	/**< Indication if the x component was received within the merge window. */
+		bool						isYReceived;	/**< Indication if the y component was received within the merge window. */
+	};
+
 public:
 	Remap_A_X_Y_to_B_XY_Handling(ProcessingEngineNode* parentNode);
 	~Remap_A_X_Y_to_B_XY_Handling();
 
+	bool setStateXml(XmlElement* stateXml) override;
+
 	bool OnReceivedMessageFromProtocol(const ProtocolId PId, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, const RemoteObjectMessageMetaInfo& msgMeta) override;
 
 protected:
+	//==============================================================================
+	void timerThreadCallback() override;
+
+	bool SendPositionToProtocolsB(int32 addrId, const RemoteObjectAddressing& addressing, const RemoteObjectMessageMetaInfo& msgMeta);
+
 	HashMap<int32, xyzVals> m_currentPosValue;	/**< Hash to hold current x y values for all currently used objects (identified by merge of obj. addressing to a single uint32 used as key). */
 
+private:
+	CriticalSection						m_currentPosValueLock;		/**< Lock to protect the current and pending positions against concurrent access from protocol and merge window timer thread. */
+	std::map<int32, PendingPosition>	m_pendingPositions;			/**< The positions waiting for their other component within the merge window (identified the same as in current values hash). */
+	int									m_xyMergeWindowMs{ 0 };		/**< The time in ms to wait for the other component before forwarding a position. Zero forwards every component right away. */
+	bool								m_xySplitBundled{ false };	/**< Indication if the x and y messages split from xy data are to be sent as one bundle. */
+
 };
@@ -35,6 +35,7 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "ProcessingEngine.h"
 
 #include "ProcessingEngineConfig.h"
+#include "ProtocolProcessor/OCP1ProtocolProcessor/OCP1ConnectionPool.h"
 #include "../LoggingTarget_Interface.h"
 
 // **************************************************************************************
@@ -47,7 +48,9 @@ ProcessingEngine::ProcessingEngine()
 {
 	m_IsRunning = false;
 	m_LoggingEnabled = false;
-	m_logTarget = 0;
+	m_HeadlessMode = false;
+	m_logTarget = nullptr;
+	m_ocp1ConnectionPool = std::make_unique<OCP1ConnectionPool>();
 }
 
 /**
@@ -120,6 +123,8 @@ bool ProcessingEngine::setStateXml(XmlElement* stateXml)
 			if(m_ProcessingNodes.count(nodeId) == 0)
 			{
 				m_ProcessingNodes.insert(std::make_pair(nodeId, std::make_unique<ProcessingEngineNode>(this)));
+				m_ProcessingNodes.at(nodeId)->SetHeadlessMode(m_HeadlessMode);
+				m_ProcessingNodes.at(nodeId)->SetOCP1ConnectionPool(m_ocp1ConnectionPool.get());
 			}
 
 			m_ProcessingNodes.at(nodeId)->setStateXml(nodeSectionElement);
@@ -167,6 +172,33 @@ bool ProcessingEngine::IsLoggingEnabled()
 	return m_LoggingEnabled;
 }
 
+/**
+ * Setter for the headless mode of the engine and all its nodes.
+ * In headless mode no node callbacks are posted to the JUCE message thread, they are
+ * delivered in batches from engine owned threads instead, so the engine can run
+ * as a server without a message thread being involved in the data path.
+ * The logging target has to be threadsafe in this mode.
+ *
+ * @param headless	The state (en-/disable) to set the headless mode to
+ */
+void ProcessingEngine::SetHeadlessMode(bool headless)
+{
+	m_HeadlessMode = headless;
+
+	for (auto const& node : m_ProcessingNodes)
+		node.second->SetHeadlessMode(headless);
+}
+
+/**
+ * Getter for the headless mode flag
+ *
+ * @return	True if enabled, false if not
+ */
+bool ProcessingEngine::IsHeadlessMode()
+{
+	return m_HeadlessMode;
+}
+
 /**
 * Setter for logging target object to be used to push messages to
 *
@@ -177,6 +209,19 @@ void ProcessingEngine::SetLoggingTarget(LoggingTarget_Interface* logTarget)
 	m_logTarget = logTarget;
 }
 
+/**
+ * Reimplemented to only have the nodes collect message traffic while it is actually logged.
+ *
+ * @return	All messages if logging is enabled and a logging target is set, none otherwise
+ */
+ProcessingEngineNode::NodeListener::DataInterest ProcessingEngine::GetNodeDataInterest()
+{
+	if (IsLoggingEnabled() && m_logTarget)
+		return DI_All;
+	else
+		return DI_None;
+}
+
 /**
  * Method overloaded to enqueue logging data regarding message traffic in the nodes.
  *
@@ -187,12 +232,48 @@ void ProcessingEngine::HandleNodeData(const ProcessingEngineNode::NodeCallbackMe
 	if (!IsLoggingEnabled())
 		return;
 
-	if (m_logTarget)
+	auto logTarget = m_logTarget.load();
+	if (logTarget)
+	{
+		logTarget->AddLogData(callbackMessage->_protocolMessage._nodeId, callbackMessage->_protocolMessage._senderProtocolId, callbackMessage->_protocolMessage._senderProtocolType, callbackMessage->_protocolMessage._Id, callbackMessage->_protocolMessage._msgData);
+	}
+}
+
+/**
+ * Method overloaded to enqueue logging data regarding message traffic in the nodes,
+ * for a batch of messages delivered by a node.
+ * Reimplemented to log the messages directly instead of wrapping each in a callback message.
+ *
+ * @param protocolMessages	The messages that were received by a node
+ * @param messageCount		The number of messages
+ */
+void ProcessingEngine::HandleNodeDataBatch(const ProcessingEngineNode::InterProtocolMessage* protocolMessages, int messageCount)
+{
+	auto logTarget = m_logTarget.load();
+	if (!IsLoggingEnabled() || !logTarget)
+		return;
+
+	for (auto i = 0; i < messageCount; i++)
 	{
-		m_logTarget->AddLogData(callbackMessage->_protocolMessage._nodeId, callbackMessage->_protocolMessage._senderProtocolId, callbackMessage->_protocolMessage._senderProtocolType, callbackMessage->_protocolMessage._Id, callbackMessage->_protocolMessage._msgData);
+		auto const& protocolMessage = protocolMessages[i];
+		logTarget->AddLogData(protocolMessage._nodeId, protocolMessage._senderProtocolId, protocolMessage._senderProtocolType, protocolMessage._Id, protocolMessage._msgData);
 	}
 }
 
+/**
+ * Method overloaded to report that a node dropped messages from the logged traffic,
+ * since it received more messages during one delivery interval than it collects.
+ *
+ * @param droppedCount	The number of messages missing from the logged traffic
+ */
+void ProcessingEngine::HandleNodeDataDropped(int droppedCount)
+{
+	if (!IsLoggingEnabled())
+		return;
+
+	DBG(String(__FUNCTION__) + " " + String(droppedCount) + " node messages dropped from logging");
+}
+
 void ProcessingEngine::onConfigUpdated()
 {
 	auto config = ProcessingEngineConfig::getInstance();
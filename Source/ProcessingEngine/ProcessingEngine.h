@@ -42,6 +42,7 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // Fwd. Declarations
 class LoggingTarget_Interface;
+class OCP1ConnectionPool;
 
 
 /**
@@ -64,9 +65,14 @@ public:
 	void SetLoggingTarget(LoggingTarget_Interface* logTarget);
 	bool Start();
 	bool Stop();
+	bool IsHeadlessMode();
+	void SetHeadlessMode(bool headless);
 
 	// ============================================================
+	NodeListener::DataInterest GetNodeDataInterest() override;
 	void HandleNodeData(const ProcessingEngineNode::NodeCallbackMessage* callbackMessage) override;
+	void HandleNodeDataBatch(const ProcessingEngineNode::InterProtocolMessage* protocolMessages, int messageCount) override;
+	void HandleNodeDataDropped(int droppedCount) override;
 
 	// ============================================================
 	std::unique_ptr<XmlElement> createStateXml() override;
@@ -77,10 +83,12 @@ public:
 
 private:
 	// ============================================================
+	std::unique_ptr<OCP1ConnectionPool>								m_ocp1ConnectionPool;	/**< The OCP1 connections shared by the protocols of all nodes, declared before the nodes to outlive them. */
 	std::map<unsigned int, std::unique_ptr<ProcessingEngineNode>>	m_ProcessingNodes;	/**< Hash table to hold all node objects currently active as define by config. */
 	bool															m_IsRunning;		/**< Running state flag. */
-	bool															m_LoggingEnabled;	/**< Logging state flag. */
-	LoggingTarget_Interface*										m_logTarget;		/**< Pointer to the object that shall receive logging data from the engine. */
+	std::atomic<bool>												m_LoggingEnabled;	/**< Logging state flag. Atomic, since it is read from the node callback dispatcher threads. */
+	bool															m_HeadlessMode;		/**< Headless mode flag, to run the nodes without involving the message thread in the data path. */
+	std::atomic<LoggingTarget_Interface*>							m_logTarget;		/**< Pointer to the object that shall receive logging data from the engine. Atomic, since it is read from the node callback dispatcher threads. */
 	Array<String>													m_loggingQueue;		/**< Array queue with messages to be logged. */
 
 };
@@ -86,6 +86,11 @@ public:
 		MAPPINGAREARESCALE,
 		ORIGINOFFSET,
 		OCP1CONNECTIONMODE,
+		OCP1SUBSCRIPTIONMODE,
+		OUTPUTRATE,
+		POSITIONPREDICTION,
+		VALUEFILTERS,
+		XYMERGEWINDOW,
 		VALUEACK,
 		DBPRDATA,
 	};
@@ -163,6 +168,16 @@ public:
 			return "OriginOffset";
 		case OCP1CONNECTIONMODE:
 			return "Ocp1ConnectionMode";
+		case OCP1SUBSCRIPTIONMODE:
+			return "Ocp1SubscriptionMode";
+		case OUTPUTRATE:
+			return "OutputRate";
+		case POSITIONPREDICTION:
+			return "PositionPrediction";
+		case VALUEFILTERS:
+			return "ValueFilters";
+		case XYMERGEWINDOW:
+			return "xyMergeWindow";
 		case VALUEACK:
 			return "ValueAcknowledge";
 		case DBPRDATA:
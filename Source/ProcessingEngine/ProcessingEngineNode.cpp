@@ -103,7 +103,7 @@ ProcessingEngineNode::ProcessingEngineNode(ProcessingEngineNode::NodeListener* l
  */
 ProcessingEngineNode::~ProcessingEngineNode()
 {
-	m_listeners.clear();
+	m_callbackCollector.ClearListeners();
 
 	Stop();
 }
@@ -114,8 +114,7 @@ ProcessingEngineNode::~ProcessingEngineNode()
  */
 void ProcessingEngineNode::AddListener(ProcessingEngineNode::NodeListener* listener)
 {
-	if (listener)
-		m_listeners.push_back(listener);
+	m_callbackCollector.AddListener(listener);
 }
 
 /**
@@ -125,14 +124,7 @@ void ProcessingEngineNode::AddListener(ProcessingEngineNode::NodeListener* liste
  */
 bool ProcessingEngineNode::RemoveListener(ProcessingEngineNode::NodeListener* listener)
 {
-	auto listenerIter = std::find(m_listeners.begin(), m_listeners.end(), listener);
-	if (listener && listenerIter != m_listeners.end())
-	{
-		m_listeners.erase(listenerIter);
-		return true;
-	}
-	else
-		return false;
+	return m_callbackCollector.RemoveListener(listener);
 }
 
 /**
@@ -165,6 +157,8 @@ bool ProcessingEngineNode::Start()
 	// start our thread loop
 	startThread();
 
+	m_callbackCollector.Start();
+
 	// Startup protocols
 	bool successfullyStartedA = m_typeAProtocols.size() > 0;
 	bool successfullyStartedB = true;
@@ -220,6 +214,8 @@ bool ProcessingEngineNode::Stop()
 	// clear pending messages from queue
 	m_messageQueue.clear();
 
+	m_callbackCollector.Stop();
+
 	m_nodeRunning = !(!protocolsRunning && threadShutdownSuccess);
 
 	return !m_nodeRunning;
@@ -235,6 +231,42 @@ bool ProcessingEngineNode::IsRunning()
 	return m_nodeRunning;
 }
 
+/**
+ * Setter for the headless mode.
+ * The node callbacks are collected and delivered to the listeners as one batch per delivery interval.
+ * In headless mode the batch is delivered by a thread of the engine wide TimerThreadScheduler,
+ * so the JUCE message thread is not involved at all. Listeners therefore have to be threadsafe in this mode.
+ * Otherwise a single message per interval is posted to the message thread to deliver the batch there.
+ *
+ * @param headless	True to run headless, false to deliver the node callbacks through the message thread.
+ */
+void ProcessingEngineNode::SetHeadlessMode(bool headless)
+{
+	m_callbackCollector.SetHeadlessMode(headless);
+}
+
+/**
+ * Getter for the headless mode.
+ *
+ * @return	True if the node callbacks are delivered without the message thread.
+ */
+bool ProcessingEngineNode::IsHeadlessMode() const
+{
+	return m_callbackCollector.IsHeadlessMode();
+}
+
+/**
+ * Setter for the pool of OCP1 connections that protocols created afterwards and configured
+ * for 'sharedclient' connection mode share their device connections from.
+ * The pool has to outlive the node. Without a pool, these protocols use a private connection.
+ *
+ * @param connectionPool	The pool to use, usually owned by the processing engine.
+ */
+void ProcessingEngineNode::SetOCP1ConnectionPool(OCP1ConnectionPool* connectionPool)
+{
+	m_ocp1ConnectionPool = connectionPool;
+}
+
 /**
  *
  */
@@ -412,6 +444,9 @@ bool ProcessingEngineNode::setStateXml(XmlElement* stateXml)
 	for (const auto& id : protocolBIdsToRemove)
 		m_typeBProtocols.erase(id);
 
+	// protocols that subscribe on demand get their active objects from the other protocols, now that all are set up
+	UpdateOnDemandActiveObjects();
+
 	// restore running state after config has been applied
 	if(m_restartOnXmlChange && shouldBeRunning)
 		Start();
@@ -433,7 +468,7 @@ ProtocolProcessorBase *ProcessingEngineNode::CreateProtocolProcessor(ProtocolTyp
 		case PT_OSCProtocol:
 			return new OSCProtocolProcessor(m_nodeId, listenerPortNumber);
 		case PT_OCP1Protocol:
-			return new OCP1ProtocolProcessor(m_nodeId);
+			return new OCP1ProtocolProcessor(m_nodeId, m_ocp1ConnectionPool);
 		case PT_RTTrPMProtocol:
 			return new RTTrPMProtocolProcessor(m_nodeId, listenerPortNumber);
 		case PT_MidiProtocol:
@@ -489,6 +524,40 @@ ObjectDataHandling_Abstract* ProcessingEngineNode::CreateObjectDataHandling(Obje
 	}
 }
 
+/**
+ * Helper method to derive the active objects of protocols that are configured to subscribe on demand
+ * (OCP1 'ondemand' subscription mode) from the objects the protocols of the opposite role are handling.
+ * The derived objects replace the previously derived ones, so objects no longer handled by other protocols are dropped.
+ */
+void ProcessingEngineNode::UpdateOnDemandActiveObjects()
+{
+	auto updateFromOtherRoleProtocols = [](ProtocolProcessorBase* protocol, const std::map<ProtocolId, std::unique_ptr<ProtocolProcessorBase>>& otherRoleProtocols) {
+		auto ocp1Protocol = dynamic_cast<OCP1ProtocolProcessor*>(protocol);
+		if (!ocp1Protocol || !ocp1Protocol->IsSubscribingOnDemand())
+			return;
+
+		auto onDemandObjects = std::vector<RemoteObject>();
+		for (auto const& otherRoleProtocol : otherRoleProtocols)
+		{
+			if (!otherRoleProtocol.second)
+				continue;
+
+			for (auto const& object : otherRoleProtocol.second->GetRemoteObjectsActive())
+			{
+				if (std::find(onDemandObjects.begin(), onDemandObjects.end(), object) == onDemandObjects.end())
+					onDemandObjects.push_back(object);
+			}
+		}
+
+		ocp1Protocol->SetOnDemandObjects(onDemandObjects);
+	};
+
+	for (auto const& protocolA : m_typeAProtocols)
+		updateFromOtherRoleProtocols(protocolA.second.get(), m_typeBProtocols);
+	for (auto const& protocolB : m_typeBProtocols)
+		updateFromOtherRoleProtocols(protocolB.second.get(), m_typeAProtocols);
+}
+
 /**
  * Convenience method to externally access object data handling.
  * This is meant to be used to be able to access custom data handling objects that allow
@@ -512,6 +581,8 @@ ObjectDataHandling_Abstract* ProcessingEngineNode::GetObjectDataHandling()
  */
 void ProcessingEngineNode::OnProtocolMessageReceived(ProtocolProcessorBase* receiver, const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, const RemoteObjectMessageMetaInfo& msgMeta)
 {
+	receiver->OnRemoteObjectValueReceived(roi, msgData);
+
 	m_messageQueue.enqueueMessage(InterProtocolMessage(this->GetId(), receiver->GetId(), receiver->GetType(), roi, msgData, msgMeta));
 }
 
@@ -535,24 +606,47 @@ bool ProcessingEngineNode::SendMessageTo(ProtocolId PId, const RemoteObjectIdent
 }
 
 /**
- * Reimplmented from MessageListener.
- * @param msg	The message data to handle.
+ * Getter for the effective polling rates of the active objects of member protocol with given id.
+ *
+ * @param PId	The id of the protocol to get the polling rates of
+ * @return	The polling statistics of the protocol, empty if the protocol is not known
  */
-void ProcessingEngineNode::handleMessage(const Message& msg)
+ActiveObjectsPoller::Statistics ProcessingEngineNode::GetPollingStatistics(ProtocolId PId) const
 {
-	if (auto* callbackMessage = dynamic_cast<const NodeCallbackMessage*> (&msg))
-	{
-		// broadcast received data to all listeners
-		for (const auto& listener : m_listeners)
-			listener->HandleNodeData(callbackMessage);
-	}
+	if (m_typeAProtocols.count(PId))
+		return m_typeAProtocols.at(PId)->GetPollingStatistics();
+	else if (m_typeBProtocols.count(PId))
+		return m_typeBProtocols.at(PId)->GetPollingStatistics();
+	else
+		return ActiveObjectsPoller::Statistics();
+}
+
+/**
+ * Method to forward several messages that belong together to member protocol with given id,
+ * to be sent in one go if the protocol supports it.
+ *
+ * @param PId			The id of the protocol to send the RemoteObjects to
+ * @param rois			The message object ids that correspond to the messages to be sent
+ * @param msgData		The actual message data, one per message object id
+ * @param messageCount	The number of messages to send
+ * @param externalId	An optional integer id that might be used by protocol implementations to track IO data.
+ * @return	True on success, false if a failure occurred
+ */
+bool ProcessingEngineNode::SendMessagesTo(ProtocolId PId, const RemoteObjectIdentifier* rois, const RemoteObjectMessageData* msgData, int messageCount, const int externalId) const
+{
+	if (m_typeAProtocols.count(PId))
+		return m_typeAProtocols.at(PId)->SendRemoteObjectMessages(rois, msgData, messageCount, externalId);
+	else if (m_typeBProtocols.count(PId))
+		return m_typeBProtocols.at(PId)->SendRemoteObjectMessages(rois, msgData, messageCount, externalId);
+	else
+		return false;
 }
 
 /**
  * Main thread loop reimplementation from JUCE thread.
  * This implementation waits for InterprotocolMessages being posted to
- * internal message queue, dequeues them and posts them as NodeCallbackMessage
- * to JUCE's message queue to asynchronously be forwarded to subscribed listeners.
+ * internal message queue, dequeues them and collects them to asynchronously
+ * be forwarded to subscribed listeners in batches by the callback dispatcher.
  * Afterwards, the message is synchronously handed over to datahandling module.
  */
 void ProcessingEngineNode::run()
@@ -568,7 +662,7 @@ void ProcessingEngineNode::run()
 			if (protocolMessage._msgMeta._Category != RemoteObjectMessageMetaInfo::MC_SetMessageAcknowledgement // if either we do not deal with a reply of SET data
 				|| protocolMessage._msgMeta._ExternalId != ASYNC_EXTID)										// or the SET data was not initiated by async listeners but protocols instead
 			{
-				postMessage(new NodeCallbackMessage(protocolMessage));
+				m_callbackCollector.CollectCallback(protocolMessage);
 			}
 
 			// perform internal bridging forwarding of message - synchronous
@@ -41,6 +41,7 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 // Fwd. declarations
 class ObjectDataHandling_Abstract;
+class OCP1ConnectionPool;
 class ProcessingEngine;
 
 /**
@@ -48,8 +49,7 @@ class ProcessingEngine;
  */
 class ProcessingEngineNode :	public ProtocolProcessorBase::Listener,
 								public ProcessingEngineConfig::XmlConfigurableElement,
-								private Thread,
-								private MessageListener
+								private Thread
 {
 public:
 	/**
@@ -139,7 +139,7 @@ public:
 	};
 
 	/**
-	 * Implementation of a node message to use with JUCE's message queue.
+	 * Implementation of a node message to hand single received messages to NodeListener::HandleNodeData.
 	 */
 	struct NodeCallbackMessage : public Message
 	{
@@ -158,20 +158,144 @@ public:
 		InterProtocolMessage	_protocolMessage;
 	};
 
+	/**
+	 * Implementation of a node message to trigger the delivery of the collected node callbacks on the message thread.
+	 */
+	struct NodeCallbackDeliveryMessage : public Message
+	{
+		/**
+		 * Destructor.
+		 */
+		~NodeCallbackDeliveryMessage() override {};
+	};
+
 	/**
 	 * Abstract embedded interface class for message data handling
 	 */
 	class NodeListener
 	{
+	public:
+		/**
+		 * The node data a listener is interested in, to not burden the data path with what nobody needs.
+		 */
+		enum DataInterest
+		{
+			DI_None,	/**< No node data is required, e.g. while logging is disabled. */
+			DI_Sampled,	/**< Only the latest value per object and delivery interval is required, e.g. for displaying values. */
+			DI_All		/**< Every message is required, e.g. for logging the message traffic. */
+		};
+
 	public:
 		NodeListener() {};
 		virtual ~NodeListener() {};
 
+		/**
+		 * Method to be overloaded by ancestors to declare which node data they require.
+		 * It is queried at every delivery interval, so changes take effect without further notification.
+		 * @return	The node data interest, all messages by default.
+		 */
+		virtual DataInterest GetNodeDataInterest() { return DI_All; };
+
 		/**
 		 * Method to be overloaded by ancestors to act as an interface
 		 * for handling of received message data
 		 */
 		virtual void HandleNodeData(const NodeCallbackMessage* callbackMessage) = 0;
+
+		/**
+		 * Method to be overloaded by ancestors to handle the messages a node collected during one delivery interval at once.
+		 * It is called from the message thread, or from a background thread in headless mode.
+		 * The default implementation hands each message to HandleNodeData.
+		 * @param protocolMessages	The messages, only valid for the duration of the call.
+		 * @param messageCount		The number of messages.
+		 */
+		virtual void HandleNodeDataBatch(const InterProtocolMessage* protocolMessages, int messageCount);
+
+		/**
+		 * Method to be overloaded by ancestors that require every message, to learn about messages that could not be delivered.
+		 * It is called after the batch of the same interval, if more messages arrived than a batch can hold.
+		 * @param droppedCount	The number of messages dropped since the last delivery.
+		 */
+		virtual void HandleNodeDataDropped(int droppedCount) { ignoreUnused(droppedCount); };
+	};
+
+	/**
+	 * Class to collect the node callbacks on the node thread and deliver them to the node listeners as one batch per interval.
+	 * In headless mode the batch is delivered by a thread of the engine wide TimerThreadScheduler,
+	 * otherwise a single message per interval is posted to deliver it on the message thread.
+	 */
+	class CallbackCollector : private MessageListener
+	{
+	public:
+		CallbackCollector();
+		~CallbackCollector() override;
+
+		//==============================================================================
+		void AddListener(NodeListener* listener);
+		bool RemoveListener(NodeListener* listener);
+		void ClearListeners();
+
+		//==============================================================================
+		void SetHeadlessMode(bool headless);
+		bool IsHeadlessMode() const;
+
+		//==============================================================================
+		void Start();
+		void Stop();
+
+		//==============================================================================
+		void CollectCallback(const InterProtocolMessage& protocolMessage);
+
+	private:
+		/**
+		 * Thread to periodically deliver the collected node callbacks to the listeners as one batch,
+		 * directly in headless mode and through a single message thread message per interval otherwise.
+		 */
+		class CallbackDispatcher : public TimerThreadBase
+		{
+		public:
+			explicit CallbackDispatcher(CallbackCollector& owner) : m_owner(owner) {};
+			~CallbackDispatcher() override { stopTimerThread(); };
+
+		protected:
+			void timerThreadCallback() override { m_owner.DispatchCallbacks(); };
+
+		private:
+			CallbackCollector&	m_owner;	/**< The collector to deliver the collected callbacks of. */
+		};
+
+		//==============================================================================
+		void handleMessage(const Message& msg) override;
+
+		//==============================================================================
+		void UpdateDataInterest();
+		void DispatchCallbacks();
+		void DeliverCallbacks();
+		void ClearCallbacks();
+
+		//==============================================================================
+		static constexpr int s_callbackInterval = 50;					/**< The interval in ms at which the collected callbacks are delivered to the listeners, the UI update rate. */
+		static constexpr int s_maxCallbackBatchSize = 4096;				/**< The maximum number of callbacks collected between two deliveries, further ones are dropped and counted to never stall the data path. */
+		static constexpr int s_coalescingTableSize = 2 * s_maxCallbackBatchSize;	/**< The number of slots of the hash table used to coalesce sampled callbacks, a power of two. */
+
+		std::vector<NodeListener*>			m_listeners;							/**< The listner objects, for e.g. logging message traffic. */
+		CriticalSection						m_listenersLock;						/**< Threadsafety measure, since in headless mode the listener list is read from the callback dispatcher thread. */
+		std::atomic<int>					m_dataInterest{ NodeListener::DI_None };	/**< The highest node data interest of all listeners, to skip collecting callbacks without taking the lock if nobody needs them. */
+
+		std::atomic<bool>					m_headlessMode{ false };				/**< Indication if the node callbacks are delivered by the dispatcher thread instead of the message thread. */
+		CriticalSection						m_callbacksLock;						/**< Lock to guard the collected callbacks that are handed over from the node thread to the delivering thread. */
+		std::vector<InterProtocolMessage>	m_pendingCallbacks;						/**< The reused buffer of callbacks collected since the last delivery. */
+		int									m_pendingCallbackCount{ 0 };			/**< The number of valid callbacks in the collecting buffer. */
+		int									m_droppedCallbackCount{ 0 };			/**< The number of callbacks dropped since the last delivery because the collecting buffer was full. */
+		std::vector<std::pair<int, int>>	m_coalescingTable;						/**< The generation and collecting buffer index per hash slot, to find the callback of an object to replace when sampling. */
+		int									m_coalescingGeneration{ 1 };			/**< The generation of the current collecting buffer, so the coalescing table does not have to be cleared on delivery. */
+		CriticalSection						m_deliveryLock;							/**< Lock held for a whole delivery, so deliveries from the dispatcher and the message thread around a headless mode change do not overlap. */
+		std::vector<InterProtocolMessage>	m_deliveringCallbacks;					/**< The reused buffer of callbacks being delivered, swapped with the collecting buffer on delivery. */
+		std::vector<NodeListener*>			m_deliveringListeners;					/**< The reused copy of the listener list the current delivery calls, so no listener is called with m_listenersLock held. */
+		std::atomic<bool>					m_deliveryMessagePending{ false };		/**< Indication if a delivery was posted to the message thread and not yet handled, to never queue up more than one. */
+		CallbackDispatcher					m_callbackDispatcher{ *this };			/**< The thread delivering or triggering the delivery of the collected callbacks. */
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CallbackCollector)
 	};
 
 public:
@@ -187,11 +311,19 @@ public:
 	Thread::ThreadID GetNodeThreadId();
 
 	bool SendMessageTo(ProtocolId PId, RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, const int externalId = INVALID_EXTID) const;
+	bool SendMessagesTo(ProtocolId PId, const RemoteObjectIdentifier* rois, const RemoteObjectMessageData* msgData, int messageCount, const int externalId = INVALID_EXTID) const;
+
+	ActiveObjectsPoller::Statistics GetPollingStatistics(ProtocolId PId) const;
 
 	bool Start();
 	bool Stop();
 	bool IsRunning();
 
+	void SetHeadlessMode(bool headless);
+	bool IsHeadlessMode() const;
+
+	void SetOCP1ConnectionPool(OCP1ConnectionPool* connectionPool);
+
 	//==============================================================================
 	virtual std::unique_ptr<XmlElement> createStateXml() override;
 	virtual bool setStateXml(XmlElement* stateXml) override;
@@ -199,9 +331,6 @@ public:
 	//==============================================================================
 	void OnProtocolMessageReceived(ProtocolProcessorBase* receiver, RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, const RemoteObjectMessageMetaInfo& msgMeta = RemoteObjectMessageMetaInfo(RemoteObjectMessageMetaInfo::MC_None, -1)) override;
 
-	//==============================================================================
-	void handleMessage(const Message& msg) override;
-
 	//==============================================================================
 	void run() override;
 
@@ -323,6 +452,8 @@ private:
 	ProtocolProcessorBase* CreateProtocolProcessor(ProtocolType type, int listenerPortNumber);
 	//==============================================================================
 	ObjectDataHandling_Abstract* CreateObjectDataHandling(ObjectHandlingMode mode);
+	//==============================================================================
+	void UpdateOnDemandActiveObjects();
 
 	//==============================================================================
 	bool															m_restartOnXmlChange{ true }; /**< Decide if the Node shall Stop and Start when setting the XML */
@@ -331,15 +462,17 @@ private:
 
 	NodeId															m_nodeId;			/**< The id of the bridging node object. */
 
+	OCP1ConnectionPool*												m_ocp1ConnectionPool{ nullptr };	/**< The engine owned pool OCP1 processors in 'sharedclient' connection mode get their connection from, if any. */
+
 	std::map<ProtocolId, std::unique_ptr<ProtocolProcessorBase>>	m_typeAProtocols;	/**< The remote protocols that act with role A of this node. */
 	std::map<ProtocolId, std::unique_ptr<ProtocolProcessorBase>>	m_typeBProtocols;	/**< The remote protocols that act with role B of this node. */
 
-	std::vector<ProcessingEngineNode::NodeListener*>				m_listeners;		/**< The listner objects, for e.g. logging message traffic. */
-
 	bool															m_nodeRunning;
 	WaitableEvent													m_threadRunning;
 
 	InterProtocolMessageQueue										m_messageQueue;
 
+	CallbackCollector												m_callbackCollector;	/**< The collector delivering the node callbacks to the listeners, for e.g. logging message traffic. */
+
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ProcessingEngineNode)
 };
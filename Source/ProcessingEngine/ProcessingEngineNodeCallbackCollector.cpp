@@ -0,0 +1,326 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "ProcessingEngineNode.h"
+
+
+// **************************************************************************************
+//    class ProcessingEngineNode::NodeListener
+// **************************************************************************************
+/**
+ * Default implementation to handle a batch of node callbacks, by handing each of them to HandleNodeData.
+ * Listeners that care about the overhead of wrapping every message reimplement this.
+ * @param protocolMessages	The messages the node has received.
+ * @param messageCount		The number of messages.
+ */
+void ProcessingEngineNode::NodeListener::HandleNodeDataBatch(const InterProtocolMessage* protocolMessages, int messageCount)
+{
+	for (auto i = 0; i < messageCount; i++)
+	{
+		NodeCallbackMessage callbackMessage(protocolMessages[i]);
+		HandleNodeData(&callbackMessage);
+	}
+}
+
+
+// **************************************************************************************
+//    class ProcessingEngineNode::CallbackCollector
+// **************************************************************************************
+/**
+ * Constructor
+ */
+ProcessingEngineNode::CallbackCollector::CallbackCollector()
+{
+}
+
+/**
+ * Destructor
+ */
+ProcessingEngineNode::CallbackCollector::~CallbackCollector()
+{
+	Stop();
+}
+
+/**
+ * Method to register a listener object to be delivered the collected node callbacks.
+ * @param listener	The listener object to add to the internal list of listeners
+ */
+void ProcessingEngineNode::CallbackCollector::AddListener(NodeListener* listener)
+{
+	const ScopedLock l(m_listenersLock);
+
+	if (listener)
+		m_listeners.push_back(listener);
+
+	UpdateDataInterest();
+}
+
+/**
+ * Method to remove a registered listener object.
+ * Waits for a delivery that is running on another thread to finish, so the listener is not called anymore once this returns.
+ * @param listener	The listener object to remove from the internal list of listeners
+ * @return	True if the listener was successfully removed, false if it was not found or is invalid
+ */
+bool ProcessingEngineNode::CallbackCollector::RemoveListener(NodeListener* listener)
+{
+	{
+		const ScopedLock l(m_listenersLock);
+
+		auto listenerIter = std::find(m_listeners.begin(), m_listeners.end(), listener);
+		if (!listener || listenerIter == m_listeners.end())
+			return false;
+
+		m_listeners.erase(listenerIter);
+		UpdateDataInterest();
+	}
+
+	const ScopedLock dl(m_deliveryLock);
+	return true;
+}
+
+/**
+ * Method to remove all registered listener objects.
+ * Waits for a delivery that is running on another thread to finish, so no listener is called anymore once this returns.
+ */
+void ProcessingEngineNode::CallbackCollector::ClearListeners()
+{
+	{
+		const ScopedLock l(m_listenersLock);
+		m_listeners.clear();
+		m_dataInterest = NodeListener::DI_None;
+	}
+
+	const ScopedLock dl(m_deliveryLock);
+}
+
+/**
+ * Setter for the headless mode.
+ * @param headless	True to deliver the collected callbacks from the dispatcher thread, false to deliver them through the message thread.
+ */
+void ProcessingEngineNode::CallbackCollector::SetHeadlessMode(bool headless)
+{
+	m_headlessMode = headless;
+}
+
+/**
+ * Getter for the headless mode.
+ * @return	True if the collected callbacks are delivered without the message thread.
+ */
+bool ProcessingEngineNode::CallbackCollector::IsHeadlessMode() const
+{
+	return m_headlessMode;
+}
+
+/**
+ * Starts the periodic delivery of the collected callbacks.
+ */
+void ProcessingEngineNode::CallbackCollector::Start()
+{
+	m_callbackDispatcher.startTimerThread(s_callbackInterval);
+}
+
+/**
+ * Stops the periodic delivery and discards the callbacks that were not delivered yet.
+ */
+void ProcessingEngineNode::CallbackCollector::Stop()
+{
+	m_callbackDispatcher.stopTimerThread();
+	ClearCallbacks();
+}
+
+/**
+ * Reimplemented from MessageListener.
+ * @param msg	The message data to handle.
+ */
+void ProcessingEngineNode::CallbackCollector::handleMessage(const Message& msg)
+{
+	if (dynamic_cast<const NodeCallbackDeliveryMessage*> (&msg) != nullptr)
+	{
+		m_deliveryMessagePending = false;
+
+		// a delivery posted before switching to headless mode is stale, the dispatcher delivers itself now
+		if (!m_headlessMode)
+			DeliverCallbacks();
+	}
+}
+
+/**
+ * Helper method to update the highest node data interest of all listeners.
+ * Must be called with m_listenersLock held.
+ */
+void ProcessingEngineNode::CallbackCollector::UpdateDataInterest()
+{
+	auto dataInterest = NodeListener::DI_None;
+	for (const auto& listener : m_listeners)
+		dataInterest = jmax(dataInterest, listener->GetNodeDataInterest());
+
+	m_dataInterest = dataInterest;
+}
+
+/**
+ * Helper method to collect a node callback, to be delivered with the next batch.
+ * Nothing is collected if no listener is interested. If the listeners only require sampled data,
+ * a callback replaces the one collected for the same object since the last delivery.
+ * Callbacks beyond the batch size are dropped and counted, to be reported with the next delivery.
+ * The buffer slots are reused, so this does not allocate once the buffer has grown to the message rate.
+ * @param protocolMessage	The message to collect.
+ */
+void ProcessingEngineNode::CallbackCollector::CollectCallback(const InterProtocolMessage& protocolMessage)
+{
+	auto dataInterest = m_dataInterest.load();
+	if (dataInterest == NodeListener::DI_None)
+		return;
+
+	const ScopedLock l(m_callbacksLock);
+
+	auto callbackIndex = m_pendingCallbackCount;
+	std::pair<int, int>* coalescingSlot = nullptr;
+	if (dataInterest == NodeListener::DI_Sampled)
+	{
+		if (m_coalescingTable.empty())
+			m_coalescingTable.resize(s_coalescingTableSize, std::make_pair(0, 0));
+
+		// open addressing with linear probing, slots of earlier generations count as free
+		auto hash = static_cast<std::uint32_t>(protocolMessage._senderProtocolId) * 73856093u
+			^ static_cast<std::uint32_t>(protocolMessage._Id) * 19349663u
+			^ static_cast<std::uint32_t>(protocolMessage._msgData._addrVal._first) * 83492791u
+			^ static_cast<std::uint32_t>(protocolMessage._msgData._addrVal._second) * 2654435761u;
+		for (auto probe = 0; probe < s_coalescingTableSize; probe++)
+		{
+			auto& slot = m_coalescingTable[(hash + probe) & (s_coalescingTableSize - 1)];
+			if (slot.first != m_coalescingGeneration)
+			{
+				coalescingSlot = &slot;
+				break;
+			}
+
+			auto const& collectedMessage = m_pendingCallbacks[slot.second];
+			if (collectedMessage._senderProtocolId == protocolMessage._senderProtocolId
+				&& collectedMessage._Id == protocolMessage._Id
+				&& collectedMessage._msgData._addrVal == protocolMessage._msgData._addrVal)
+			{
+				callbackIndex = slot.second;
+				break;
+			}
+		}
+	}
+
+	if (callbackIndex == m_pendingCallbackCount)
+	{
+		if (m_pendingCallbackCount >= s_maxCallbackBatchSize)
+		{
+			m_droppedCallbackCount++;
+			return;
+		}
+
+		if (coalescingSlot != nullptr)
+			*coalescingSlot = std::make_pair(m_coalescingGeneration, callbackIndex);
+
+		m_pendingCallbackCount++;
+	}
+
+	if (callbackIndex < static_cast<int>(m_pendingCallbacks.size()))
+		m_pendingCallbacks[callbackIndex] = protocolMessage;
+	else
+		m_pendingCallbacks.push_back(protocolMessage);
+}
+
+/**
+ * Helper method to be called at every delivery interval from the callback dispatcher thread.
+ * It refreshes the data interest of the listeners and delivers the collected callbacks
+ * right away in headless mode, or posts a single message to deliver them on the message thread otherwise.
+ */
+void ProcessingEngineNode::CallbackCollector::DispatchCallbacks()
+{
+	{
+		const ScopedLock l(m_listenersLock);
+		UpdateDataInterest();
+	}
+
+	if (m_headlessMode)
+	{
+		DeliverCallbacks();
+		return;
+	}
+
+	{
+		const ScopedLock l(m_callbacksLock);
+		if (m_pendingCallbackCount == 0 && m_droppedCallbackCount == 0)
+			return;
+	}
+
+	if (!m_deliveryMessagePending.exchange(true))
+		postMessage(new NodeCallbackDeliveryMessage());
+}
+
+/**
+ * Helper method to deliver the collected node callbacks to the interested listeners as one batch.
+ * The collecting buffer is swapped out, so the node thread is only held up for the swap
+ * and not while the listeners handle the batch.
+ * The listeners are called on a copy of the listener list, so they may add or remove listeners
+ * and listener changes from other threads are not held up by the delivery.
+ * The delivering buffers are guarded for the whole delivery, since the dispatcher and the message thread
+ * both can deliver for a short while when the headless mode is changed.
+ */
+void ProcessingEngineNode::CallbackCollector::DeliverCallbacks()
+{
+	const ScopedLock dl(m_deliveryLock);
+
+	auto messageCount = 0;
+	auto droppedCount = 0;
+	{
+		const ScopedLock l(m_callbacksLock);
+		if (m_pendingCallbackCount == 0 && m_droppedCallbackCount == 0)
+			return;
+
+		std::swap(m_pendingCallbacks, m_deliveringCallbacks);
+		messageCount = m_pendingCallbackCount;
+		m_pendingCallbackCount = 0;
+		droppedCount = m_droppedCallbackCount;
+		m_droppedCallbackCount = 0;
+		m_coalescingGeneration++;
+	}
+
+	{
+		const ScopedLock l(m_listenersLock);
+		m_deliveringListeners.assign(m_listeners.begin(), m_listeners.end());
+	}
+
+	for (const auto& listener : m_deliveringListeners)
+	{
+		auto dataInterest = listener->GetNodeDataInterest();
+		if (dataInterest == NodeListener::DI_None)
+			continue;
+
+		if (messageCount > 0)
+			listener->HandleNodeDataBatch(m_deliveringCallbacks.data(), messageCount);
+		if (droppedCount > 0 && dataInterest == NodeListener::DI_All)
+			listener->HandleNodeDataDropped(droppedCount);
+	}
+}
+
+/**
+ * Helper method to discard the collected node callbacks that were not delivered yet.
+ */
+void ProcessingEngineNode::CallbackCollector::ClearCallbacks()
+{
+	const ScopedLock l(m_callbacksLock);
+	m_pendingCallbackCount = 0;
+	m_droppedCallbackCount = 0;
+	m_coalescingGeneration++;
+}
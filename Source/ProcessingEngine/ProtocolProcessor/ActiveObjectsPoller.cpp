@@ -0,0 +1,255 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "ActiveObjectsPoller.h"
+
+
+// **************************************************************************************
+//    class ActiveObjectsPoller
+// **************************************************************************************
+/**
+ * Constructor of class ActiveObjectsPoller.
+ */
+ActiveObjectsPoller::ActiveObjectsPoller()
+{
+}
+
+/**
+ * Destructor
+ */
+ActiveObjectsPoller::~ActiveObjectsPoller()
+{
+}
+
+/**
+ * Method to set the objects to poll and the configured base polling interval.
+ * Nothing is done if neither changed since the last call, so this can be called before every collection.
+ * Objects that were already polled before keep their adapted interval, new objects start
+ * at the base interval, staggered across it to not all become due at the same time.
+ *
+ * @param objects		The snapshot of active objects to poll.
+ * @param baseInterval	The configured polling interval in ms.
+ */
+void ActiveObjectsPoller::SetObjects(const std::shared_ptr<const RemoteObjectSet>& objects, int baseInterval)
+{
+	const ScopedLock l(m_pollerLock);
+
+	if (objects == m_objects && baseInterval == m_baseInterval)
+		return;
+
+	auto baseIntervalChanged = (baseInterval != m_baseInterval);
+	m_objects = objects;
+	m_baseInterval = jmax(1, baseInterval);
+
+	auto previousObjectStates = std::move(m_objectStates);
+	auto previousObjectStateIndices = std::move(m_objectStateIndices);
+	m_objectStates.clear();
+	m_objectStateIndices.clear();
+
+	auto objectCount = m_objects ? static_cast<int>(m_objects->GetObjects().size()) : 0;
+	auto now = Time::getMillisecondCounterHiRes();
+	for (auto i = 0; i < objectCount; i++)
+	{
+		auto const& object = m_objects->GetObjects().at(i);
+
+		auto previousIndexIter = previousObjectStateIndices.find(object);
+		if (previousIndexIter != previousObjectStateIndices.end() && !baseIntervalChanged)
+		{
+			m_objectStates.push_back(previousObjectStates.at(previousIndexIter->second));
+		}
+		else
+		{
+			ObjectState state;
+			state.object = object;
+			state.interval = m_baseInterval;
+			state.nextDueTime = now + (static_cast<double>(m_baseInterval) * i) / objectCount;
+			m_objectStates.push_back(state);
+		}
+		m_objectStateIndices[object] = i;
+	}
+
+	m_objectCount = objectCount;
+	m_budgetTokens = jmin(m_budgetTokens, static_cast<double>(objectCount));
+	m_lastCollectTime = now;
+	m_nextObjectIndex = 0;
+}
+
+/**
+ * Method to be called for every value that was received for an object, to adapt its polling interval.
+ * A changed value shortens the interval right away and pulls the next poll in accordingly,
+ * a series of unchanged values extends it.
+ *
+ * @param roi		The id of the object the value was received for.
+ * @param msgData	The received value.
+ */
+void ActiveObjectsPoller::OnValueReceived(const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData)
+{
+	if (m_objectCount == 0 || msgData._valType == ROVT_NONE)
+		return;
+
+	auto object = RemoteObject(roi, msgData._addrVal);
+
+	const ScopedLock l(m_pollerLock);
+
+	auto indexIter = m_objectStateIndices.find(object);
+	if (indexIter == m_objectStateIndices.end() || !IsAdaptive(object))
+		return;
+
+	auto& state = m_objectStates.at(indexIter->second);
+	auto valueHash = HashValue(msgData);
+	if (!state.hasValue)
+	{
+		state.valueHash = valueHash;
+		state.hasValue = true;
+		return;
+	}
+
+	if (valueHash != state.valueHash)
+	{
+		state.valueHash = valueHash;
+		state.unchangedCount = 0;
+		state.interval = jmax(GetMinInterval(), state.interval / s_speedUpFactor);
+		state.nextDueTime = jmin(state.nextDueTime, Time::getMillisecondCounterHiRes() + state.interval);
+	}
+	else if (++state.unchangedCount >= s_unchangedValuesBeforeBackOff)
+	{
+		state.unchangedCount = 0;
+		state.interval = jmin(GetMaxInterval(), state.interval * s_backOffFactor);
+	}
+}
+
+/**
+ * Method to collect the objects that are due to be polled now.
+ * Due objects that exceed the packet budget are held back and go first on the next collection.
+ *
+ * @param dueObjects	The list to append the due objects to.
+ */
+void ActiveObjectsPoller::CollectDueObjects(std::vector<RemoteObject>& dueObjects)
+{
+	const ScopedLock l(m_pollerLock);
+
+	auto objectCount = static_cast<int>(m_objectStates.size());
+	if (objectCount == 0)
+		return;
+
+	// refill the budget, limited to what polling all objects once costs
+	auto now = Time::getMillisecondCounterHiRes();
+	auto budgetPerMs = static_cast<double>(objectCount) / m_baseInterval;
+	m_budgetTokens = jmin(static_cast<double>(objectCount), m_budgetTokens + (now - m_lastCollectTime) * budgetPerMs);
+	m_lastCollectTime = now;
+
+	if (m_nextObjectIndex >= objectCount)
+		m_nextObjectIndex = 0;
+
+	for (auto i = 0; i < objectCount; i++)
+	{
+		auto objectIndex = (m_nextObjectIndex + i) % objectCount;
+		auto& state = m_objectStates.at(objectIndex);
+		if (state.nextDueTime > now)
+			continue;
+
+		if (m_budgetTokens < 1.0)
+		{
+			m_nextObjectIndex = objectIndex;
+			return;
+		}
+		m_budgetTokens -= 1.0;
+
+		dueObjects.push_back(state.object);
+
+		state.nextDueTime += state.interval;
+		if (state.nextDueTime <= now)
+			state.nextDueTime = now + state.interval;
+	}
+}
+
+/**
+ * Getter for the effective polling rates.
+ * @return	The budget, the current overall rate and the current rate per object.
+ */
+ActiveObjectsPoller::Statistics ActiveObjectsPoller::GetStatistics() const
+{
+	const ScopedLock l(m_pollerLock);
+
+	Statistics statistics;
+	if (m_objectStates.empty())
+		return statistics;
+
+	statistics.budgetRate = 1000.0f * static_cast<float>(m_objectStates.size()) / m_baseInterval;
+	for (auto const& state : m_objectStates)
+	{
+		auto objectRate = static_cast<float>(1000.0 / state.interval);
+		statistics.objectRates[state.object] = objectRate;
+		statistics.effectiveRate += objectRate;
+	}
+	statistics.effectiveRate = jmin(statistics.effectiveRate, statistics.budgetRate);
+
+	return statistics;
+}
+
+/**
+ * Helper to hash the value contained in a message, to detect value changes without keeping a copy of the value.
+ * @param msgData	The message to hash the value of.
+ * @return	The hash of value type, value count and payload.
+ */
+std::size_t ActiveObjectsPoller::HashValue(const RemoteObjectMessageData& msgData)
+{
+	// FNV-1a over the payload bytes
+	auto hash = static_cast<std::size_t>(14695981039346656037ULL);
+	auto hashByte = [&hash](std::uint8_t byte) {
+		hash ^= byte;
+		hash *= static_cast<std::size_t>(1099511628211ULL);
+	};
+
+	hashByte(static_cast<std::uint8_t>(msgData._valType));
+	hashByte(static_cast<std::uint8_t>(msgData._valCount));
+	if (msgData._payload != nullptr)
+		for (auto i = std::uint32_t(0); i < msgData._payloadSize; i++)
+			hashByte(static_cast<const std::uint8_t*>(msgData._payload)[i]);
+
+	return hash;
+}
+
+/**
+ * Helper to check if the polling interval of an object may be adapted.
+ * Heartbeats are used for online state detection and are therefore always polled at the base interval.
+ * @param object	The object to check.
+ * @return	True if the polling interval of the object may be adapted.
+ */
+bool ActiveObjectsPoller::IsAdaptive(const RemoteObject& object) const
+{
+	return object._Id != ROI_HeartbeatPing;
+}
+
+/**
+ * Getter for the shortest polling interval, never longer than the base interval.
+ * @return	The shortest polling interval in ms.
+ */
+double ActiveObjectsPoller::GetMinInterval() const
+{
+	return jmin(static_cast<double>(m_baseInterval), static_cast<double>(jmax(s_minInterval, m_baseInterval / s_speedUpFactor)));
+}
+
+/**
+ * Getter for the longest polling interval, defining the floor rate static objects are backed off to.
+ * @return	The longest polling interval in ms.
+ */
+double ActiveObjectsPoller::GetMaxInterval() const
+{
+	return static_cast<double>(m_baseInterval) * s_maxIntervalFactor;
+}
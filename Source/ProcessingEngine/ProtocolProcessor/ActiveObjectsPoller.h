@@ -0,0 +1,98 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include "../../RemoteProtocolBridgeCommon.h"
+#include "../RemoteObjectSet.h"
+
+#include <JuceHeader.h>
+
+
+/**
+ * Class ActiveObjectsPoller decides which active objects are due to be polled, with an individual
+ * polling interval per object that adapts to how often the object's value is observed to change.
+ * Objects whose responses keep reporting the same value are backed off exponentially down to a floor rate,
+ * objects whose value changes are sped up quickly. The sum of all polls is limited by a packet budget
+ * that equals what polling all objects at the configured base interval would cost, so adapting
+ * the rates only redistributes the polling traffic towards the objects that are in motion.
+ */
+class ActiveObjectsPoller
+{
+public:
+	/**
+	 * The effective polling rates, for diagnostic purposes.
+	 */
+	struct Statistics
+	{
+		float							budgetRate{ 0.0f };		/**< The packets per second all polls together may use at most. */
+		float							effectiveRate{ 0.0f };	/**< The packets per second all polls together currently use. */
+		std::map<RemoteObject, float>	objectRates;			/**< The current polling rate in Hz per active object. */
+	};
+
+public:
+	ActiveObjectsPoller();
+	~ActiveObjectsPoller();
+
+	//==============================================================================
+	void SetObjects(const std::shared_ptr<const RemoteObjectSet>& objects, int baseInterval);
+	void OnValueReceived(const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData);
+	void CollectDueObjects(std::vector<RemoteObject>& dueObjects);
+
+	//==============================================================================
+	Statistics GetStatistics() const;
+
+private:
+	/**
+	 * The polling state of a single active object.
+	 */
+	struct ObjectState
+	{
+		RemoteObject	object;						/**< The object to poll. */
+		double			interval{ 0.0 };			/**< The current polling interval in ms. */
+		double			nextDueTime{ 0.0 };			/**< The time in ms the next poll is due at. */
+		std::size_t		valueHash{ 0 };				/**< The hash of the last value received for the object. */
+		bool			hasValue{ false };			/**< Indication if a value was received for the object yet. */
+		int				unchangedCount{ 0 };		/**< The number of consecutive received values that did not change. */
+	};
+
+	//==============================================================================
+	static std::size_t HashValue(const RemoteObjectMessageData& msgData);
+	bool IsAdaptive(const RemoteObject& object) const;
+	double GetMinInterval() const;
+	double GetMaxInterval() const;
+
+	//==============================================================================
+	static constexpr int s_minInterval = 10;						/**< The shortest polling interval in ms an object is sped up to. */
+	static constexpr int s_speedUpFactor = 4;						/**< The factor the polling interval is shortened by when a value change is observed. */
+	static constexpr int s_backOffFactor = 2;						/**< The factor the polling interval is extended by when no value change is observed. */
+	static constexpr int s_unchangedValuesBeforeBackOff = 3;		/**< The number of consecutive unchanged values that are required to back off once. */
+	static constexpr int s_maxIntervalFactor = 16;					/**< The longest polling interval as a multiple of the base interval, defining the floor rate. */
+
+	CriticalSection										m_pollerLock;					/**< Lock to guard the polling states that are updated from the receiving and polling threads. */
+	std::shared_ptr<const RemoteObjectSet>				m_objects;						/**< The active objects the polling states were created for. */
+	std::vector<ObjectState>							m_objectStates;					/**< The polling state per active object. */
+	std::map<RemoteObject, int>							m_objectStateIndices;			/**< The index of the polling state per active object. */
+	std::atomic<int>									m_objectCount{ 0 };				/**< The number of active objects, to skip received values without taking the lock if nothing is polled. */
+	int													m_baseInterval{ 0 };			/**< The configured polling interval in ms, used as initial interval and for the packet budget. */
+	double												m_budgetTokens{ 0.0 };			/**< The number of polls that can be sent without exceeding the packet budget. */
+	double												m_lastCollectTime{ 0.0 };		/**< The time in ms due objects were last collected, to refill the budget from. */
+	int													m_nextObjectIndex{ 0 };			/**< The index of the object to start checking from, so objects held back by the budget go first next time. */
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ActiveObjectsPoller)
+};
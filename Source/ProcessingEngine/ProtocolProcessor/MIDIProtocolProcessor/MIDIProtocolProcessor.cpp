@@ -33,6 +33,17 @@ MIDIProtocolProcessor::MIDIProtocolProcessor(const NodeId& parentNodeId, bool us
 	m_type = ProtocolType::PT_MidiProtocol;
 
 	m_useMainMessageQueue = useMainMessageQueue;
+
+	m_outputObjectIndices.fill(-1);
+	for (int i = 0; i < static_cast<int>(m_supportedRemoteObjects.size()); i++)
+		m_outputObjectIndices[m_supportedRemoteObjects.at(i)] = i;
+
+	auto outputSlotCount = static_cast<std::size_t>(m_supportedRemoteObjects.size() * (s_maxOutputChannel + 1));
+	m_outputDeafStamps = std::vector<std::atomic<double>>(outputSlotCount);
+	m_pendingOutputMessages.resize(outputSlotCount);
+	m_pendingOutputFlags.resize(outputSlotCount, false);
+	m_queuedOutputFlags.resize(outputSlotCount, false);
+	m_pendingOutputQueue.resize(outputSlotCount, -1);
 }
 
 /**
@@ -71,6 +82,117 @@ void MIDIProtocolProcessor::handleMessage(const Message& msg)
 		processMidiMessage(callbackMessage->message, callbackMessage->source);
 }
 
+/**
+ * Helper method to list all configured assignments in order of precedence
+ * and build the lookup table of the candidate assignments per status and first data byte.
+ * The candidates are resolved here, when the assignments are configured, by testing every
+ * assignment against every key it can match, so incoming messages only have to be looked up
+ * and tested against the few assignments they actually can match.
+ * Only keys that any assignment can match are held in the table.
+ * Must be called with m_midiAssiLock held.
+ */
+void MIDIProtocolProcessor::RebuildAssignmentLookup()
+{
+	m_midiAssiLookupList.clear();
+	for (auto const& assignmentMapping : m_midiAssiMap)
+		m_midiAssiLookupList.push_back({ assignmentMapping.first, &assignmentMapping.second, nullptr });
+	for (auto const& valueAssignmentMapping : m_midiAssiWithValueMap)
+		for (auto const& commandToValueMapping : valueAssignmentMapping.second)
+			m_midiAssiLookupList.push_back({ valueAssignmentMapping.first, &commandToValueMapping.first, &commandToValueMapping.second });
+
+	m_midiAssiLookupAll.resize(m_midiAssiLookupList.size());
+	for (int i = 0; i < static_cast<int>(m_midiAssiLookupAll.size()); i++)
+		m_midiAssiLookupAll[i] = i;
+
+	m_midiAssiLookupTable.clear();
+	for (int i = 0; i < static_cast<int>(m_midiAssiLookupList.size()); i++)
+	{
+		auto const& assignment = *m_midiAssiLookupList.at(i).assignment;
+
+		// the second data byte only has to be tested in full for value range assignments,
+		// for the others it only makes a difference if it is zero (e.g. note on with zero velocity is note off)
+		auto isValueRangeAssignment = assignment.isValueRangeAssignment();
+
+		for (int statusByte = 0x80; statusByte < 0xF0; statusByte++)
+		{
+			if (!IsAssignmentCommandType(assignment, statusByte))
+				continue;
+
+			auto isTwoByteMessage = (statusByte & 0xF0) == 0xC0 || (statusByte & 0xF0) == 0xD0; // program change and channel pressure
+			for (int firstDataByte = 0; firstDataByte < 128; firstDataByte++)
+			{
+				auto isMatching = false;
+				if (isTwoByteMessage)
+					isMatching = IsMidiMessageMatchingCommandAssignment(assignment, juce::MidiMessage(statusByte, firstDataByte));
+				else if (isValueRangeAssignment)
+				{
+					for (int secondDataByte = 0; secondDataByte < 128 && !isMatching; secondDataByte++)
+						isMatching = IsMidiMessageMatchingCommandAssignment(assignment, juce::MidiMessage(statusByte, firstDataByte, secondDataByte));
+				}
+				else
+				{
+					isMatching = IsMidiMessageMatchingCommandAssignment(assignment, juce::MidiMessage(statusByte, firstDataByte, 127))
+						|| IsMidiMessageMatchingCommandAssignment(assignment, juce::MidiMessage(statusByte, firstDataByte, 0));
+				}
+
+				if (isMatching)
+					m_midiAssiLookupTable[GetAssignmentLookupKey(statusByte, firstDataByte)].push_back(i);
+			}
+		}
+	}
+}
+
+/**
+ * Helper method to check if a channel voice status byte is of a message type an assignment can match,
+ * to skip testing the assignment against the keys of all other message types.
+ * @param	assignment	The assignment to check.
+ * @param	statusByte	The channel voice status byte to check.
+ * @return	True if the assignment can match messages of the status byte type.
+ */
+bool MIDIProtocolProcessor::IsAssignmentCommandType(const JUCEAppBasics::MidiCommandRangeAssignment& assignment, int statusByte)
+{
+	switch (statusByte & 0xF0)
+	{
+	case 0x80:
+	case 0x90:
+		return assignment.isNoteOnCommand() || assignment.isNoteOffCommand();
+	case 0xA0:
+		return assignment.isAftertouchCommand();
+	case 0xB0:
+		return assignment.isControllerCommand();
+	case 0xC0:
+		return assignment.isProgramChangeCommand();
+	case 0xD0:
+		return assignment.isChannelPressureCommand();
+	case 0xE0:
+		return assignment.isPitchCommand();
+	default:
+		return false;
+	}
+}
+
+/**
+ * Helper method to get the assignments a midi message can match, by a lookup of its
+ * status byte (type and channel) and first data byte (e.g. note or controller number)
+ * in the table built by RebuildAssignmentLookup.
+ * Must be called with m_midiAssiLock held.
+ * @param	midiMessage		The midi message to get the candidate assignments for.
+ * @return	The indices of the candidate assignments in m_midiAssiLookupList.
+ */
+const std::vector<int>& MIDIProtocolProcessor::GetAssignmentCandidates(const juce::MidiMessage& midiMessage) const
+{
+	auto rawData = midiMessage.getRawData();
+	auto rawDataSize = midiMessage.getRawDataSize();
+	if (rawDataSize < 2 || rawData[0] < 0x80 || rawData[0] >= 0xF0)
+		return m_midiAssiLookupAll; // anything but channel voice messages is tested against all assignments
+
+	auto lookupIter = m_midiAssiLookupTable.find(GetAssignmentLookupKey(rawData[0], rawData[1] & 0x7F));
+	if (lookupIter == m_midiAssiLookupTable.end())
+		return m_midiAssiLookupNone;
+
+	return lookupIter->second;
+}
+
 /**
  * Method to verify if a given midi message matches a command assignment.
  * The matching is done against the different assignment types 
@@ -129,6 +251,8 @@ int MIDIProtocolProcessor::GetMidiValueFromCommand(const JUCEAppBasics::MidiComm
 
 /**
  * Method to do the actual processing of incoming midi data to internal remote objects.
+ * The messages to forward are derived with the assignments locked, but forwarded to the parent node
+ * only after releasing the lock, to not block the configuration and sending threads meanwhile.
  * @param midiMessage	The message to process.
  * @param sourceName	The string representation of the midi message source device.
  */
@@ -138,6 +262,24 @@ void MIDIProtocolProcessor::processMidiMessage(const juce::MidiMessage& midiMess
 
 	DBG(String(__FUNCTION__) + " MIDI received: " + midiMessage.getDescription());
 
+	ForwardMessages forwardMessages;
+	{
+		const ScopedLock l(m_midiAssiLock);
+		collectMidiMessageForwards(midiMessage, forwardMessages);
+	}
+
+	for (auto i = 0; i < forwardMessages.count; i++)
+		forwardAndDeafProofMessage(forwardMessages.rois[i], forwardMessages.msgData[i]);
+}
+
+/**
+ * Helper method to map an incoming midi message to the remote object messages to forward,
+ * according to the configured assignments. Must be called with m_midiAssiLock held.
+ * @param midiMessage		The message to process.
+ * @param forwardMessages	The messages to forward to add the mapped remote object messages to.
+ */
+void MIDIProtocolProcessor::collectMidiMessageForwards(const juce::MidiMessage& midiMessage, ForwardMessages& forwardMessages)
+{
 	RemoteObjectIdentifier newObjectId = ROI_Invalid;
 	RemoteObjectMessageData newMsgData;
 	newMsgData._addrVal._first = INVALID_ADDRESS_VALUE;
@@ -149,13 +291,20 @@ void MIDIProtocolProcessor::processMidiMessage(const juce::MidiMessage& midiMess
 
 	int value = -1;
 
-	// iterate through the available assignments to find a match for the midimessage
-	for (auto const& assignmentMapping : m_midiAssiMap)
+	// only the assignments that can match the status and first data byte of the midimessage are tested
+	auto const& assignmentCandidates = GetAssignmentCandidates(midiMessage);
+
+	// iterate through the candidate assignments to find a match for the midimessage
+	for (auto const& assignmentIndex : assignmentCandidates)
 	{
-		auto& assiCommandData = assignmentMapping.second;
+		auto const& assignmentReference = m_midiAssiLookupList.at(assignmentIndex);
+		if (assignmentReference.value != nullptr)
+			continue;
+
+		auto& assiCommandData = *assignmentReference.assignment;
 		if (IsMidiMessageMatchingCommandAssignment(assiCommandData, midiMessage))
 		{
-			newObjectId = assignmentMapping.first;
+			newObjectId = assignmentReference.roi;
 			newMsgData._addrVal._second = static_cast<RecordId>(ProcessingEngineConfig::IsRecordAddressingObject(newObjectId) ? m_mappingAreaId : INVALID_ADDRESS_VALUE);
 
 			// get the command value from midi message
@@ -201,7 +350,7 @@ void MIDIProtocolProcessor::processMidiMessage(const juce::MidiMessage& midiMess
 						value = 0;
 						newMsgData._addrVal._first = previousSelectedChannel;
 						newMsgData._payload = static_cast<void*>(&value);
-						forwardAndDeafProofMessage(newObjectId, newMsgData);
+						forwardMessages.add(newObjectId, newMsgData);
 					}
 
 					// send select for newly selected channel
@@ -211,7 +360,7 @@ void MIDIProtocolProcessor::processMidiMessage(const juce::MidiMessage& midiMess
 						value = 1;
 						newMsgData._addrVal._first = m_currentSelectedChannel;
 						newMsgData._payload = static_cast<void*>(&value);
-						forwardAndDeafProofMessage(newObjectId, newMsgData);
+						forwardMessages.add(newObjectId, newMsgData);
 					}
 					// or mark that currently none is selected (e.g. second press of a note to deselect current)
 					else
@@ -255,7 +404,7 @@ void MIDIProtocolProcessor::processMidiMessage(const juce::MidiMessage& midiMess
 					value = 1;
 					newMsgData._addrVal._first = m_currentSelectedChannel;
 					newMsgData._payload = static_cast<void*>(&value);
-					forwardAndDeafProofMessage(newObjectId, newMsgData);
+					forwardMessages.add(newObjectId, newMsgData);
 				}
 				// or mark that currently none is selected (e.g. second press of a note to deselect current)
 				else
@@ -411,75 +560,75 @@ void MIDIProtocolProcessor::processMidiMessage(const juce::MidiMessage& midiMess
 			GetValueCache().SetValue(RemoteObject(newObjectId, newMsgData._addrVal), newMsgData);
 
 			// finally send the collected data struct to parent node for further handling
-			forwardAndDeafProofMessage(newObjectId, newMsgData);
+			forwardMessages.add(newObjectId, newMsgData);
 
 			return;
 		}
 	}
 
-	// iterate through the available midi to value assignments to find a match for the midimessage
-	for (auto const& valueAssignmentMapping : m_midiAssiWithValueMap)
+	auto midiCommandData = JUCEAppBasics::MidiCommandRangeAssignment(midiMessage);
+
+	// iterate through the candidate midi to value assignments to find a match for the midimessage
+	for (auto const& assignmentIndex : assignmentCandidates)
 	{
-		auto& roi = valueAssignmentMapping.first;
-		for (auto const& commandToValueMapping : valueAssignmentMapping.second)
-		{
-			auto& assiCommandData = commandToValueMapping.first;
-			auto& assiValue = commandToValueMapping.second;
+		auto const& assignmentReference = m_midiAssiLookupList.at(assignmentIndex);
+		if (assignmentReference.value == nullptr)
+			continue;
 
-			auto midiCommandData = JUCEAppBasics::MidiCommandRangeAssignment(midiMessage);
+		auto& assiCommandData = *assignmentReference.assignment;
+		auto& assiValue = *assignmentReference.value;
 
-			if (IsMidiMessageMatchingCommandAssignment(assiCommandData, midiMessage))
-			{
-				newObjectId = roi;
-				newMsgData._addrVal._second = static_cast<RecordId>(ProcessingEngineConfig::IsRecordAddressingObject(newObjectId) ? m_mappingAreaId : INVALID_ADDRESS_VALUE);
+		if (IsMidiMessageMatchingCommandAssignment(assiCommandData, midiMessage))
+		{
+			newObjectId = assignmentReference.roi;
+			newMsgData._addrVal._second = static_cast<RecordId>(ProcessingEngineConfig::IsRecordAddressingObject(newObjectId) ? m_mappingAreaId : INVALID_ADDRESS_VALUE);
 
-				auto isMessageToBeBridged = false;
+			auto isMessageToBeBridged = false;
 
-				// map the incoming value to the correct remote object range. this varies between the different objects.
-				switch (newObjectId)
+			// map the incoming value to the correct remote object range. this varies between the different objects.
+			switch (newObjectId)
+			{
+			case ROI_Scene_Recall:
 				{
-				case ROI_Scene_Recall:
+					if (assiCommandData.getCommandRange().isEmpty() && assiCommandData.getValueRange().isEmpty())
 					{
-						if (assiCommandData.getCommandRange().isEmpty() && assiCommandData.getValueRange().isEmpty())
+						if (assiCommandData.getCommandValue() == midiCommandData.getCommandValue())
 						{
-							if (assiCommandData.getCommandValue() == midiCommandData.getCommandValue())
+							auto majorMinorString = StringArray();
+							majorMinorString.addTokens(String(assiValue), ".", "");
+							if (majorMinorString.size() == 2)
 							{
-								auto majorMinorString = StringArray();
-								majorMinorString.addTokens(String(assiValue), ".", "");
-								if (majorMinorString.size() == 2)
-								{
-									m_intValueBuffer[0] = majorMinorString[0].getIntValue();
-									m_intValueBuffer[1] = majorMinorString[1].getIntValue();
-
-									newMsgData._valType = ROVT_INT;
-									newMsgData._valCount = 2;
-									newMsgData._payload = &m_intValueBuffer;
-									newMsgData._payloadSize = 2 * sizeof(int);
-
-									isMessageToBeBridged = true;
-								}
+								m_intValueBuffer[0] = majorMinorString[0].getIntValue();
+								m_intValueBuffer[1] = majorMinorString[1].getIntValue();
+
+								newMsgData._valType = ROVT_INT;
+								newMsgData._valCount = 2;
+								newMsgData._payload = &m_intValueBuffer;
+								newMsgData._payloadSize = 2 * sizeof(int);
+
+								isMessageToBeBridged = true;
 							}
 						}
 					}
-					break;
-				default:
-					break;
 				}
+				break;
+			default:
+				break;
+			}
 
-				if (isMessageToBeBridged)
-				{
-					// If the received message targets a muted object, return without further processing
-					if (IsRemoteObjectMuted(RemoteObject(newObjectId, newMsgData._addrVal)))
-						return;
+			if (isMessageToBeBridged)
+			{
+				// If the received message targets a muted object, return without further processing
+				if (IsRemoteObjectMuted(RemoteObject(newObjectId, newMsgData._addrVal)))
+					return;
 
-					// Insert the new object and value to local cache
-					GetValueCache().SetValue(RemoteObject(newObjectId, newMsgData._addrVal), newMsgData);
+				// Insert the new object and value to local cache
+				GetValueCache().SetValue(RemoteObject(newObjectId, newMsgData._addrVal), newMsgData);
 
-					// finally send the collected data struct to parent node for further handling
-					forwardAndDeafProofMessage(newObjectId, newMsgData);
+				// finally send the collected data struct to parent node for further handling
+				forwardMessages.add(newObjectId, newMsgData);
 
-					return;
-				}
+				return;
 			}
 		}
 	}
@@ -518,6 +667,15 @@ bool MIDIProtocolProcessor::setStateXml(XmlElement* stateXml)
 		else
 			return false;
 
+		// read the optional output message budget from xml, defaults to sending every message immediately
+		auto outputRateXmlElement = stateXml->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::OUTPUTRATE));
+		if (outputRateXmlElement)
+			m_outputMessageBudget = jmax(0, outputRateXmlElement->getIntAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::VALUE)));
+		else
+			m_outputMessageBudget = 0;
+
+		const ScopedLock l(m_midiAssiLock);
+
 		// read all available midi assignment mappings from xml
 		for (auto const& roi : m_supportedRemoteObjects)
 		{
@@ -561,6 +719,8 @@ bool MIDIProtocolProcessor::setStateXml(XmlElement* stateXml)
 			}
 		}
 
+		RebuildAssignmentLookup();
+
 		return true;
 	}
 }
@@ -685,12 +845,120 @@ bool MIDIProtocolProcessor::activateMidiOutput(const String& midiOutputIdentifie
  */
 void MIDIProtocolProcessor::forwardAndDeafProofMessage(const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData)
 {
-	m_addressedObjectOutputDeafStampMap[roi][msgData._addrVal] = juce::Time::getMillisecondCounterHiRes();
+	auto outputSlot = GetOutputSlot(roi, msgData._addrVal);
+	if (outputSlot >= 0)
+	{
+		m_outputDeafStamps[outputSlot].store(juce::Time::getMillisecondCounterHiRes(), std::memory_order_relaxed);
+
+		// a pending output for the object would be outdated by the input and might fight against e.g. a moving motorfader
+		const ScopedLock l(m_pendingOutputLock);
+		m_pendingOutputFlags[outputSlot] = false;
+	}
+	else
+	{
+		// addressing beyond the output slots is not scheduled, but has to be deaf proofed all the same
+		const ScopedLock l(m_outputDeafStampsLock);
+		m_unslottedOutputDeafStamps[RemoteObject(roi, msgData._addrVal)] = juce::Time::getMillisecondCounterHiRes();
+	}
 
 	if (m_messageListener)
 		m_messageListener->OnProtocolMessageReceived(this, roi, msgData);
 }
 
+/**
+ * Helper method to get the flat index of the output bookkeeping for a remote object and its channel.
+ * The record is not part of the index, since only a single mapping area is handled by this processor.
+ * @param roi			The remote object id.
+ * @param addressing	The addressing of the remote object.
+ * @return	The output slot index or -1 if the object is not supported or the channel exceeds the handled range.
+ */
+int MIDIProtocolProcessor::GetOutputSlot(RemoteObjectIdentifier roi, const RemoteObjectAddressing& addressing) const
+{
+	if (roi < 0 || roi >= ROI_InvalidMAX || m_outputObjectIndices[roi] < 0)
+		return -1;
+
+	auto channel = (addressing._first == INVALID_ADDRESS_VALUE) ? 0 : static_cast<int>(addressing._first);
+	if (channel < 0 || channel > s_maxOutputChannel)
+		return -1;
+
+	return m_outputObjectIndices[roi] * (s_maxOutputChannel + 1) + channel;
+}
+
+/**
+ * Helper method to hand a message over to the output scheduler.
+ * Only the latest message per output slot is kept. A slot that becomes pending
+ * is queued behind all others, so every channel gets its turn when the budget is exceeded.
+ * @param outputSlot	The output slot the message refers to.
+ * @param midiMessage	The message to send.
+ */
+void MIDIProtocolProcessor::ScheduleOutputMessage(int outputSlot, const juce::MidiMessage& midiMessage)
+{
+	const ScopedLock l(m_pendingOutputLock);
+
+	m_pendingOutputMessages[outputSlot] = midiMessage;
+	if (m_pendingOutputFlags[outputSlot])
+		return; // already queued, the latest message wins
+
+	m_pendingOutputFlags[outputSlot] = true;
+
+	// a slot dropped by incoming deafness may still be queued, it then is served at its old position
+	if (m_queuedOutputFlags[outputSlot])
+		return;
+
+	m_queuedOutputFlags[outputSlot] = true;
+	m_pendingOutputQueue[(m_pendingOutputQueueHead + m_pendingOutputQueueCount) % m_pendingOutputQueue.size()] = outputSlot;
+	m_pendingOutputQueueCount++;
+}
+
+/**
+ * TimerThreadBase callback to send the pending output messages,
+ * round robin and limited to the configured message budget.
+ */
+void MIDIProtocolProcessor::timerThreadCallback()
+{
+	auto outputMessageBudget = m_outputMessageBudget.load();
+	if (outputMessageBudget <= 0)
+		return;
+
+	auto nowMs = Time::getMillisecondCounterHiRes();
+	auto elapsedMs = (m_outputMessageAllowanceTimeMs > 0.0) ? (nowMs - m_outputMessageAllowanceTimeMs) : 0.0;
+	m_outputMessageAllowanceTimeMs = nowMs;
+
+	// replenish the allowance, but do not let it grow beyond one interval worth of messages to avoid bursts
+	auto maxAllowance = jmax(1.0, outputMessageBudget * 0.001 * s_outputSchedulerIntervalMs);
+	m_outputMessageAllowance = jmin(maxAllowance, m_outputMessageAllowance + outputMessageBudget * 0.001 * elapsedMs);
+
+	const ScopedLock l(m_pendingOutputLock);
+	auto queueSize = static_cast<int>(m_pendingOutputQueue.size());
+	while (m_pendingOutputQueueCount > 0 && m_outputMessageAllowance >= 1.0)
+	{
+		auto outputSlot = m_pendingOutputQueue[m_pendingOutputQueueHead];
+		m_pendingOutputQueueHead = (m_pendingOutputQueueHead + 1) % queueSize;
+		m_pendingOutputQueueCount--;
+		m_queuedOutputFlags[outputSlot] = false;
+
+		if (!m_pendingOutputFlags[outputSlot])
+			continue; // dropped by incoming deafness in the meantime
+
+		m_pendingOutputFlags[outputSlot] = false;
+		if (m_midiOutput)
+		{
+			m_midiOutput->sendMessageNow(m_pendingOutputMessages[outputSlot]);
+			m_outputMessageAllowance -= 1.0;
+		}
+	}
+}
+
+/**
+ * Reimplemented from ProtocolProcessorBase to not use the active objects polling chunk interval,
+ * but the interval the held back output messages are sent at.
+ * @return	The timer thread interval in ms.
+ */
+int MIDIProtocolProcessor::GetTimerThreadInterval()
+{
+	return s_outputSchedulerIntervalMs;
+}
+
 /**
  * Overloaded method to start the protocol processing object.
  * Usually called after configuration has been set.
@@ -704,6 +972,14 @@ bool MIDIProtocolProcessor::Start()
 	if (m_midiOutputIdentifier.isNotEmpty() && !activateMidiOutput(m_midiOutputIdentifier))
 		retVal = false;
 
+	// the timer is used to send the output messages held back by the message budget
+	if (m_outputMessageBudget > 0)
+	{
+		m_outputMessageAllowance = 0.0;
+		m_outputMessageAllowanceTimeMs = 0.0;
+		startTimerThread(GetTimerThreadInterval());
+	}
+
 	return retVal;
 }
 
@@ -714,6 +990,15 @@ bool MIDIProtocolProcessor::Stop()
 {
 	bool retVal = true;
 
+	stopTimerThread();
+	{
+		const ScopedLock l(m_pendingOutputLock);
+		std::fill(m_pendingOutputFlags.begin(), m_pendingOutputFlags.end(), false);
+		std::fill(m_queuedOutputFlags.begin(), m_queuedOutputFlags.end(), false);
+		m_pendingOutputQueueHead = 0;
+		m_pendingOutputQueueCount = 0;
+	}
+
 	m_midiInputIdentifier.clear();
 	if (!activateMidiInput(String()))
 		retVal = false;
@@ -743,13 +1028,26 @@ bool MIDIProtocolProcessor::SendRemoteObjectMessage(const RemoteObjectIdentifier
 	if (!m_midiOutput)
 		return false;
 
+	const ScopedLock l(m_midiAssiLock);
+
 	// if we do not have a valid mapping for the remote object to be sent, we cannot send anything either
 	if (m_midiAssiMap.count(roi) <= 0)
 		return false;
 
 	// Verify that we have not received any input for the given addressing in the last deaf time period.
 	// This avoids race conditions with external MIDI hw, e.g. hardware motorfaders, that otherwise might end up in a freezing state.
-	if ((Time::getMillisecondCounterHiRes() - m_addressedObjectOutputDeafStampMap[roi][msgData._addrVal]) < m_outputDeafTimeMs)
+	auto outputSlot = GetOutputSlot(roi, msgData._addrVal);
+	auto lastInputStamp = 0.0;
+	if (outputSlot >= 0)
+		lastInputStamp = m_outputDeafStamps[outputSlot].load(std::memory_order_relaxed);
+	else
+	{
+		const ScopedLock deafStampsLock(m_outputDeafStampsLock);
+		auto deafStampIter = m_unslottedOutputDeafStamps.find(RemoteObject(roi, msgData._addrVal));
+		if (deafStampIter != m_unslottedOutputDeafStamps.end())
+			lastInputStamp = deafStampIter->second;
+	}
+	if ((Time::getMillisecondCounterHiRes() - lastInputStamp) < m_outputDeafTimeMs)
 		return false;
 
 	auto channel = static_cast<int>(msgData._addrVal._first);
@@ -860,9 +1158,15 @@ bool MIDIProtocolProcessor::SendRemoteObjectMessage(const RemoteObjectIdentifier
 		return false;
 	}
 
+#ifdef DEBUG
 	DBG(String(__FUNCTION__) + " sending MIDI: " + newMidiMessage.getDescription());
+#endif
 
-	m_midiOutput->sendMessageNow(newMidiMessage);
+	// with a message budget, the scheduler sends the latest message per object and channel, otherwise it is sent right away
+	if (m_outputMessageBudget > 0 && outputSlot >= 0)
+		ScheduleOutputMessage(outputSlot, newMidiMessage);
+	else
+		m_midiOutput->sendMessageNow(newMidiMessage);
 
 	return true;
 }
@@ -23,6 +23,9 @@
 
 #include <MidiCommandRangeAssignment.h>
 
+#include <atomic>
+#include <unordered_map>
+
 #include <JuceHeader.h>
 
 
@@ -69,14 +72,59 @@ private:
 		juce::String source;
 	};
 
+	/**
+	 * Reference to a configured assignment, as listed in the assignment lookup table.
+	 */
+	struct AssignmentReference
+	{
+		RemoteObjectIdentifier								roi{ ROI_Invalid };
+		const JUCEAppBasics::MidiCommandRangeAssignment*	assignment{ nullptr };
+		const std::string*									value{ nullptr };	/**< The assigned value for multivalue assignments, nullptr for single value assignments. */
+	};
+
+	/**
+	 * The messages derived from a single incoming midi message, with owned payload copies,
+	 * to forward them to the parent node once the assignment lock is released.
+	 * A channel select message results in at most two messages, a deselect and a select.
+	 */
+	struct ForwardMessages
+	{
+		int												count{ 0 };
+		std::array<RemoteObjectIdentifier, 2>			rois{ ROI_Invalid, ROI_Invalid };
+		std::array<RemoteObjectMessageData, 2>			msgData;
+
+		void add(RemoteObjectIdentifier roi, const RemoteObjectMessageData& data)
+		{
+			jassert(count < static_cast<int>(rois.size()));
+			rois[count] = roi;
+			msgData[count].payloadCopy(data);
+			count++;
+		}
+	};
+
+	/**
+	 * Helper to combine a channel voice status byte and first data byte to the key of the assignment lookup table.
+	 */
+	static constexpr int GetAssignmentLookupKey(int statusByte, int firstDataByte) { return ((statusByte - 0x80) << 7) | firstDataByte; }
+
+	void RebuildAssignmentLookup();
+	bool IsAssignmentCommandType(const JUCEAppBasics::MidiCommandRangeAssignment& assignment, int statusByte);
+	const std::vector<int>& GetAssignmentCandidates(const juce::MidiMessage& midiMessage) const;
+
 	bool IsMidiMessageMatchingCommandAssignment(const JUCEAppBasics::MidiCommandRangeAssignment& assiCommandData, const juce::MidiMessage& midiMessage);
 	int GetMidiValueFromCommand(const JUCEAppBasics::MidiCommandRangeAssignment& assiCommandData, const juce::MidiMessage& midiMessage);
 
 	void processMidiMessage(const juce::MidiMessage& midiMessage, const String& sourceName);
+	void collectMidiMessageForwards(const juce::MidiMessage& midiMessage, ForwardMessages& forwardMessages);
 	bool activateMidiInput(const String& midiInputIdentifier);
 	bool activateMidiOutput(const String& midiOutputIdentifier);
 	void forwardAndDeafProofMessage(RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData);
 
+	int GetOutputSlot(RemoteObjectIdentifier roi, const RemoteObjectAddressing& addressing) const;
+	void ScheduleOutputMessage(int outputSlot, const juce::MidiMessage& midiMessage);
+	void timerThreadCallback() override;
+	int GetTimerThreadInterval() override;
+
 	MappingAreaId								m_mappingAreaId{ MAI_Invalid };	/**< The DS100 mapping area to be used when converting incoming coords into relative messages. If this is MAI_Invalid, absolute messages will be generated. */
 
 	bool										m_useMainMessageQueue{ false };
@@ -105,12 +153,34 @@ private:
 
 	std::map<RemoteObjectIdentifier, JUCEAppBasics::MidiCommandRangeAssignment>							m_midiAssiMap;
 	std::map<RemoteObjectIdentifier, std::map<JUCEAppBasics::MidiCommandRangeAssignment, std::string>>	m_midiAssiWithValueMap;
+	CriticalSection																						m_midiAssiLock;				/**< Guards the assignments and their lookup table against concurrent configuration and incoming MIDI. */
+	std::vector<AssignmentReference>																	m_midiAssiLookupList;		/**< All configured assignments, single value ones first, in order of precedence. */
+	std::unordered_map<int, std::vector<int>>															m_midiAssiLookupTable;		/**< The indices of the candidate assignments in order of precedence, per status and first data byte key that any assignment can match. */
+	std::vector<int>																					m_midiAssiLookupAll;		/**< The indices of all assignments, for messages that are not channel voice messages. */
+	const std::vector<int>																				m_midiAssiLookupNone;		/**< No assignment indices, for keys that no assignment can match. */
 	String																								m_midiInputIdentifier;
 	String																								m_midiOutputIdentifier;
 
-	std::map<RemoteObjectIdentifier, std::map<RemoteObjectAddressing, double>>							m_addressedObjectOutputDeafStampMap;
+	static constexpr int																				s_maxOutputChannel = 128;			/**< The highest channel number output slots are held for. */
+	static constexpr int																				s_outputSchedulerIntervalMs = 10;	/**< The interval the output scheduler sends the pending messages at. */
+	std::array<int, ROI_InvalidMAX>																	m_outputObjectIndices;				/**< The index of each remote object in m_supportedRemoteObjects, -1 if not supported. Used to calculate the output slot. */
+
+	std::vector<std::atomic<double>>																	m_outputDeafStamps;					/**< The time the last input was received at, per output slot (object and channel). Written by the input thread, read by the sending threads. */
+	CriticalSection																						m_outputDeafStampsLock;				/**< Guards the deaf stamps of the objects beyond the output slots. */
+	std::map<RemoteObject, double>																		m_unslottedOutputDeafStamps;		/**< The time the last input was received at, for objects whose addressing is beyond the output slots. */
 	const double																						m_outputDeafTimeMs{ 300 };
 
+	std::atomic<int>																					m_outputMessageBudget{ 0 };			/**< The maximum number of messages per second sent to the output. 0 sends every message immediately. */
+	double																								m_outputMessageAllowance{ 0.0 };	/**< The number of messages the scheduler may still send, replenished by the budget over time. */
+	double																								m_outputMessageAllowanceTimeMs{ 0.0 };
+	CriticalSection																						m_pendingOutputLock;
+	std::vector<juce::MidiMessage>																		m_pendingOutputMessages;			/**< The latest message waiting to be sent, per output slot. */
+	std::vector<bool>																					m_pendingOutputFlags;				/**< Indicator if a message is waiting to be sent, per output slot. */
+	std::vector<bool>																					m_queuedOutputFlags;				/**< Indicator if the output slot is contained in the queue, per output slot. */
+	std::vector<int>																					m_pendingOutputQueue;				/**< Ring buffer of the output slots in the order they became pending, to serve them round robin. */
+	int																									m_pendingOutputQueueHead{ 0 };
+	int																									m_pendingOutputQueueCount{ 0 };
+
 	float																								m_floatValueBuffer[3] = { 0.0f, 0.0f, 0.0f };
 	int																									m_intValueBuffer[2] = { 0, 0 };
 	String																								m_stringValueBuffer;
@@ -96,7 +96,7 @@ bool NoProtocolProtocolProcessor::Start()
 {
 	m_IsRunning = true;
 
-	startTimerThread(GetCallbackRate(), 100); // used for 4s heartbeat triggering
+	startTimerThread(GetTimerThreadInterval(), 100); // used for 4s heartbeat triggering
 
     TriggerSendingObjectValueCache();
 
@@ -132,17 +132,18 @@ bool NoProtocolProtocolProcessor::SendRemoteObjectMessage(const RemoteObjectIden
         case ROI_Scene_Next:
             {
                 auto ro = RemoteObject(ROI_Scene_SceneIndex, RemoteObjectAddressing(INVALID_ADDRESS_VALUE, INVALID_ADDRESS_VALUE));
-                if (GetValueCache().Contains(ro))
+                auto sceneIndexMsgData = RemoteObjectMessageData();
+                if (GetValueCache().GetValue(ro, sceneIndexMsgData))
                 {
-                    auto sceneIndexMsgData = GetValueCache().GetValue(ro);
                     if (sceneIndexMsgData._payload != nullptr && sceneIndexMsgData._payloadSize != 0)
                     {
                         auto sceneIndex = juce::String(static_cast<char*>(sceneIndexMsgData._payload), sceneIndexMsgData._payloadSize).getFloatValue();
                         SetSceneIndexToCache(sceneIndex + (roi == ROI_Scene_Previous ? -1.0f : 1.0f));
 
-                        m_messageListener->OnProtocolMessageReceived(this, ROI_Scene_SceneIndex,
-                            GetValueCache().GetValue(ro),
-                            RemoteObjectMessageMetaInfo(RemoteObjectMessageMetaInfo::MessageCategory::MC_UnsolicitedMessage, -1));
+                        if (GetValueCache().GetValue(ro, sceneIndexMsgData))
+                            m_messageListener->OnProtocolMessageReceived(this, ROI_Scene_SceneIndex,
+                                sceneIndexMsgData,
+                                RemoteObjectMessageMetaInfo(RemoteObjectMessageMetaInfo::MessageCategory::MC_UnsolicitedMessage, -1));
                     }
                 }
             }
@@ -150,10 +151,11 @@ bool NoProtocolProtocolProcessor::SendRemoteObjectMessage(const RemoteObjectIden
         default:
             {
                 auto ro = RemoteObject(roi, msgData._addrVal);
-                if (GetValueCache().Contains(ro))
+                auto cachedMsgData = RemoteObjectMessageData();
+                if (GetValueCache().GetValue(ro, cachedMsgData))
                 {
                     m_messageListener->OnProtocolMessageReceived(this, roi,
-                        GetValueCache().GetValue(ro),
+                        cachedMsgData,
                         RemoteObjectMessageMetaInfo(RemoteObjectMessageMetaInfo::MessageCategory::MC_UnsolicitedMessage, externalId));
                 }
                 //else
@@ -164,7 +166,7 @@ bool NoProtocolProtocolProcessor::SendRemoteObjectMessage(const RemoteObjectIden
 	}
 	else
 	{
-        float zeroPayload[3] = { 0.0f, 0.0f, 0.0f };
+        float xyzPayload[3] = { 0.0f, 0.0f, 0.0f };
 		auto msgsToReflect = std::vector<std::pair<RemoteObjectIdentifier, RemoteObjectMessageData>>();
 
 		switch (roi)
@@ -185,22 +187,11 @@ bool NoProtocolProtocolProcessor::SendRemoteObjectMessage(const RemoteObjectIden
                     return false;
 
                 auto targetObj = RemoteObject(ROI_CoordinateMapping_SourcePosition, msgData._addrVal);
-                if (!GetValueCache().Contains(targetObj))
-                    GetValueCache().SetValue(targetObj, RemoteObjectMessageData(targetObj._Addr, ROVT_FLOAT, 3, &zeroPayload, 3 * sizeof(float)));
 
-                // get the xyz data from cache to insert the new xy data and send the xyz out
-                auto& refMsgData = GetValueCache().GetValue(targetObj);
-                if (refMsgData._valCount != 3 || refMsgData._payloadSize != 3 * sizeof(float))
+                // insert the new data into the xyz data from cache (zero if not yet known) to send the xyz out
+                if (!GetValueCache().UpdateFloatValues(targetObj, 3, 0, static_cast<float*>(msgData._payload), 2, xyzPayload))
                     return false;
-                reinterpret_cast<float*>(refMsgData._payload)[0] = reinterpret_cast<float*>(msgData._payload)[0];
-                reinterpret_cast<float*>(refMsgData._payload)[1] = reinterpret_cast<float*>(msgData._payload)[1];
-
-                //auto x = reinterpret_cast<float*>(refMsgData._payload)[0];
-                //auto y = reinterpret_cast<float*>(refMsgData._payload)[1];
-                //auto z = reinterpret_cast<float*>(refMsgData._payload)[2];
-                //DBG(juce::String(__FUNCTION__) << " ROI:" << id << " data from cache combined with incoming -> x:" << x << " y:" << y << " z:" << z);
-
-                GetValueCache().SetValue(targetObj, refMsgData);
+                auto refMsgData = RemoteObjectMessageData(targetObj._Addr, ROVT_FLOAT, 3, xyzPayload, 3 * sizeof(float));
 
                 msgsToReflect.push_back(std::make_pair(roi, msgData));
                 msgsToReflect.push_back(std::make_pair(targetObj._Id, refMsgData));
@@ -214,21 +205,11 @@ bool NoProtocolProtocolProcessor::SendRemoteObjectMessage(const RemoteObjectIden
                     return false;
 
                 auto targetObj = RemoteObject(ROI_CoordinateMapping_SourcePosition, msgData._addrVal);
-                if (!GetValueCache().Contains(targetObj))
-                    GetValueCache().SetValue(targetObj, RemoteObjectMessageData(targetObj._Addr, ROVT_FLOAT, 3, &zeroPayload, 3 * sizeof(float)));
 
-                // get the xyz data from cache to insert the new xy data and send the xyz out
-                auto& refMsgData = GetValueCache().GetValue(targetObj);
-                if (refMsgData._valCount != 3 || refMsgData._payloadSize != 3 * sizeof(float))
+                // insert the new data into the xyz data from cache (zero if not yet known) to send the xyz out
+                if (!GetValueCache().UpdateFloatValues(targetObj, 3, 0, static_cast<float*>(msgData._payload), 1, xyzPayload))
                     return false;
-                reinterpret_cast<float*>(refMsgData._payload)[0] = reinterpret_cast<float*>(msgData._payload)[0];
-
-                //auto x = reinterpret_cast<float*>(refMsgData._payload)[0];
-                //auto y = reinterpret_cast<float*>(refMsgData._payload)[1];
-                //auto z = reinterpret_cast<float*>(refMsgData._payload)[2];
-                //DBG(juce::String(__FUNCTION__) << " ROI:" << id << " data from cache combined with incoming -> x:" << x << " y:" << y << " z:" << z);
-
-                GetValueCache().SetValue(targetObj, refMsgData);
+                auto refMsgData = RemoteObjectMessageData(targetObj._Addr, ROVT_FLOAT, 3, xyzPayload, 3 * sizeof(float));
 
                 msgsToReflect.push_back(std::make_pair(roi, msgData));
                 msgsToReflect.push_back(std::make_pair(targetObj._Id, refMsgData));
@@ -241,21 +222,11 @@ bool NoProtocolProtocolProcessor::SendRemoteObjectMessage(const RemoteObjectIden
                     return false;
 
                 auto targetObj = RemoteObject(ROI_CoordinateMapping_SourcePosition, msgData._addrVal);
-                if (!GetValueCache().Contains(targetObj))
-                    GetValueCache().SetValue(targetObj, RemoteObjectMessageData(targetObj._Addr, ROVT_FLOAT, 3, &zeroPayload, 3 * sizeof(float)));
 
-                // get the xyz data from cache to insert the new xy data and send the xyz out
-                auto& refMsgData = GetValueCache().GetValue(targetObj);
-                if (refMsgData._valCount != 3 || refMsgData._payloadSize != 3 * sizeof(float))
+                // insert the new data into the xyz data from cache (zero if not yet known) to send the xyz out
+                if (!GetValueCache().UpdateFloatValues(targetObj, 3, 1, static_cast<float*>(msgData._payload), 1, xyzPayload))
                     return false;
-                reinterpret_cast<float*>(refMsgData._payload)[1] = reinterpret_cast<float*>(msgData._payload)[0];
-
-                //auto x = reinterpret_cast<float*>(refMsgData._payload)[0];
-                //auto y = reinterpret_cast<float*>(refMsgData._payload)[1];
-                //auto z = reinterpret_cast<float*>(refMsgData._payload)[2];
-                //DBG(juce::String(__FUNCTION__) << " ROI:" << id << " data from cache combined with incoming -> x:" << x << " y:" << y << " z:" << z);
-
-                GetValueCache().SetValue(targetObj, refMsgData);
+                auto refMsgData = RemoteObjectMessageData(targetObj._Addr, ROVT_FLOAT, 3, xyzPayload, 3 * sizeof(float));
 
                 msgsToReflect.push_back(std::make_pair(roi, msgData));
                 msgsToReflect.push_back(std::make_pair(targetObj._Id, refMsgData));
@@ -278,22 +249,11 @@ bool NoProtocolProtocolProcessor::SendRemoteObjectMessage(const RemoteObjectIden
                     return false;
 
                 auto targetObj = RemoteObject(ROI_Positioning_SourcePosition, msgData._addrVal);
-                if (!GetValueCache().Contains(targetObj))
-                    GetValueCache().SetValue(targetObj, RemoteObjectMessageData(targetObj._Addr, ROVT_FLOAT, 3, &zeroPayload, 3 * sizeof(float)));
 
-                // get the xyz data from cache to insert the new xy data and send the xyz out
-                auto& refMsgData = GetValueCache().GetValue(targetObj);
-                if (refMsgData._valCount != 3 || refMsgData._payloadSize != 3 * sizeof(float))
+                // insert the new data into the xyz data from cache (zero if not yet known) to send the xyz out
+                if (!GetValueCache().UpdateFloatValues(targetObj, 3, 0, static_cast<float*>(msgData._payload), 2, xyzPayload))
                     return false;
-                reinterpret_cast<float*>(refMsgData._payload)[0] = reinterpret_cast<float*>(msgData._payload)[0];
-                reinterpret_cast<float*>(refMsgData._payload)[1] = reinterpret_cast<float*>(msgData._payload)[1];
-
-                //auto x = reinterpret_cast<float*>(refMsgData._payload)[0];
-                //auto y = reinterpret_cast<float*>(refMsgData._payload)[1];
-                //auto z = reinterpret_cast<float*>(refMsgData._payload)[2];
-                //DBG(juce::String(__FUNCTION__) << " ROI:" << id << " data from cache combined with incoming -> x:" << x << " y:" << y << " z:" << z);
-
-                GetValueCache().SetValue(targetObj, refMsgData);
+                auto refMsgData = RemoteObjectMessageData(targetObj._Addr, ROVT_FLOAT, 3, xyzPayload, 3 * sizeof(float));
 
                 msgsToReflect.push_back(std::make_pair(roi, msgData));
                 msgsToReflect.push_back(std::make_pair(targetObj._Id, refMsgData));
@@ -307,21 +267,11 @@ bool NoProtocolProtocolProcessor::SendRemoteObjectMessage(const RemoteObjectIden
                     return false;
 
                 auto targetObj = RemoteObject(ROI_Positioning_SourcePosition, msgData._addrVal);
-                if (!GetValueCache().Contains(targetObj))
-                    GetValueCache().SetValue(targetObj, RemoteObjectMessageData(targetObj._Addr, ROVT_FLOAT, 3, &zeroPayload, 3 * sizeof(float)));
 
-                // get the xyz data from cache to insert the new xy data and send the xyz out
-                auto& refMsgData = GetValueCache().GetValue(targetObj);
-                if (refMsgData._valCount != 3 || refMsgData._payloadSize != 3 * sizeof(float))
+                // insert the new data into the xyz data from cache (zero if not yet known) to send the xyz out
+                if (!GetValueCache().UpdateFloatValues(targetObj, 3, 0, static_cast<float*>(msgData._payload), 1, xyzPayload))
                     return false;
-                reinterpret_cast<float*>(refMsgData._payload)[0] = reinterpret_cast<float*>(msgData._payload)[0];
-
-                //auto x = reinterpret_cast<float*>(refMsgData._payload)[0];
-                //auto y = reinterpret_cast<float*>(refMsgData._payload)[1];
-                //auto z = reinterpret_cast<float*>(refMsgData._payload)[2];
-                //DBG(juce::String(__FUNCTION__) << " ROI:" << id << " data from cache combined with incoming -> x:" << x << " y:" << y << " z:" << z);
-
-                GetValueCache().SetValue(targetObj, refMsgData);
+                auto refMsgData = RemoteObjectMessageData(targetObj._Addr, ROVT_FLOAT, 3, xyzPayload, 3 * sizeof(float));
 
                 msgsToReflect.push_back(std::make_pair(roi, msgData));
                 msgsToReflect.push_back(std::make_pair(targetObj._Id, refMsgData));
@@ -334,21 +284,11 @@ bool NoProtocolProtocolProcessor::SendRemoteObjectMessage(const RemoteObjectIden
                     return false;
 
                 auto targetObj = RemoteObject(ROI_Positioning_SourcePosition, msgData._addrVal);
-                if (!GetValueCache().Contains(targetObj))
-                    GetValueCache().SetValue(targetObj, RemoteObjectMessageData(targetObj._Addr, ROVT_FLOAT, 3, &zeroPayload, 3 * sizeof(float)));
 
-                // get the xyz data from cache to insert the new xy data and send the xyz out
-                auto& refMsgData = GetValueCache().GetValue(targetObj);
-                if (refMsgData._valCount != 3 || refMsgData._payloadSize != 3 * sizeof(float))
+                // insert the new data into the xyz data from cache (zero if not yet known) to send the xyz out
+                if (!GetValueCache().UpdateFloatValues(targetObj, 3, 1, static_cast<float*>(msgData._payload), 1, xyzPayload))
                     return false;
-                reinterpret_cast<float*>(refMsgData._payload)[1] = reinterpret_cast<float*>(msgData._payload)[0];
-
-                //auto x = reinterpret_cast<float*>(refMsgData._payload)[0];
-                //auto y = reinterpret_cast<float*>(refMsgData._payload)[1];
-                //auto z = reinterpret_cast<float*>(refMsgData._payload)[2];
-                //DBG(juce::String(__FUNCTION__) << " ROI:" << id << " data from cache combined with incoming -> x:" << x << " y:" << y << " z:" << z);
-
-                GetValueCache().SetValue(targetObj, refMsgData);
+                auto refMsgData = RemoteObjectMessageData(targetObj._Addr, ROVT_FLOAT, 3, xyzPayload, 3 * sizeof(float));
 
                 msgsToReflect.push_back(std::make_pair(roi, msgData));
                 msgsToReflect.push_back(std::make_pair(targetObj._Id, refMsgData));
@@ -410,6 +350,16 @@ void NoProtocolProtocolProcessor::timerThreadCallback()
     BumpCallbackCount();
 }
 
+/**
+ * Reimplemented from ProtocolProcessorBase to not use the active objects polling chunk interval,
+ * but the interval the heartbeat and animation are updated at.
+ * @return	The timer thread interval in ms.
+ */
+int NoProtocolProtocolProcessor::GetTimerThreadInterval()
+{
+    return GetCallbackRate();
+}
+
 /**
  * Initializes internal cache with somewhat feasible dummy values.
  */
@@ -607,12 +557,13 @@ void NoProtocolProtocolProcessor::InitializeObjectValueCache(const ProjectData&
  */
 void NoProtocolProtocolProcessor::TriggerSendingObjectValueCache()
 {
-    for (auto const& value : GetValueCache().GetCachedValues())
+    auto cachedValues = GetValueCache().GetCachedValues();
+    auto aro = GetActiveRemoteObjects();
+    for (auto const& value : *cachedValues)
     {
-        auto& aro = GetActiveRemoteObjects();
-        if (std::find(aro.begin(), aro.end(), value.first) != aro.end())
+        if (aro->Contains(value.first))
         {
-            m_messageListener->OnProtocolMessageReceived(this, value.first._Id, value.second,
+            m_messageListener->OnProtocolMessageReceived(this, value.first._Id, *value.second,
                 RemoteObjectMessageMetaInfo(RemoteObjectMessageMetaInfo::MessageCategory::MC_UnsolicitedMessage, INVALID_EXTID));
         }
     }
@@ -932,15 +883,14 @@ void NoProtocolProtocolProcessor::SetMappingSettingsToCache(ChannelId mapping, c
  */
 void NoProtocolProtocolProcessor::StepAnimation()
 {
-    for (auto const& valueKV : GetValueCache().GetCachedValues())
-    {
-        auto& objInfo = valueKV.first;
-        auto& objData = valueKV.second;
-
+    // the values are stepped in place in the cache as one batch, so the cache snapshot is not invalidated per object
+    // and not rebuilt on every step. The stepped values are copied to be reflected without holding the cache lock.
+    m_animationSteppedObjects.clear();
+    GetValueCache().UpdateValues([this](const RemoteObject& objInfo, RemoteObjectMessageData& objData) {
         auto& roi = objInfo._Id;
 
         if (!IsAnimatedObject(roi))
-            continue;
+            return false;
 
         auto& channel = objInfo._Addr._first;
         auto& record = objInfo._Addr._second;
@@ -973,6 +923,18 @@ void NoProtocolProtocolProcessor::StepAnimation()
             break;
         }
 
+        m_animationSteppedValues[objInfo].payloadCopy(objData);
+        m_animationSteppedObjects.push_back(objInfo);
+
+        return true;
+    });
+
+    auto aro = GetActiveRemoteObjects();
+    for (auto const& objInfo : m_animationSteppedObjects)
+    {
+        auto& roi = objInfo._Id;
+        auto& objData = m_animationSteppedValues[objInfo];
+
         auto msgsToReflect = std::vector<std::pair<RemoteObjectIdentifier, RemoteObjectMessageData>>();
         msgsToReflect.push_back(std::make_pair(roi, objData));
 
@@ -989,8 +951,7 @@ void NoProtocolProtocolProcessor::StepAnimation()
 
         for (auto const& msgIdNData : msgsToReflect)
         {
-            auto& aro = GetActiveRemoteObjects();
-            if (std::find(aro.begin(), aro.end(), RemoteObject(msgIdNData.first, msgIdNData.second._addrVal)) != aro.end())
+            if (aro->Contains(RemoteObject(msgIdNData.first, msgIdNData.second._addrVal)))
             {
                 m_messageListener->OnProtocolMessageReceived(this, msgIdNData.first, msgIdNData.second,
                     RemoteObjectMessageMetaInfo(RemoteObjectMessageMetaInfo::MessageCategory::MC_SetMessageAcknowledgement, -1));
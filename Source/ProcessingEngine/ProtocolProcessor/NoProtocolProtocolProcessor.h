@@ -55,6 +55,7 @@ public:
 private:
 	//==============================================================================
 	void timerThreadCallback() override;
+	int GetTimerThreadInterval() override;
 
 	int GetCallbackRate() { return m_callbackRate; };
 	int m_callbackRate{ 100 };
@@ -84,6 +85,8 @@ private:
 	std::map<ChannelId, float>	m_channelRandomizedFactors;
 	std::map<ChannelId, float>	m_channelRandomizedScaleFactors;
 	std::map<int, float>	m_valueIdRandomizedFactors;
+	std::map<RemoteObject, RemoteObjectMessageData>	m_animationSteppedValues;	/**< Copies of the values stepped by the animation, kept to reuse their payload memory. */
+	std::vector<RemoteObject>	m_animationSteppedObjects;	/**< The objects stepped by the last animation step. */
 
 	//==============================================================================
 	static constexpr int sc_chCnt{ 64 };
@@ -0,0 +1,400 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "OCP1ConnectionPool.h"
+
+#include <NanoOcp1.h>
+
+
+// **************************************************************************************
+//    class OCP1SharedConnection
+// **************************************************************************************
+/**
+ * Constructor that creates the NanoOcp1 client for the given device address.
+ * The client is not started before the first listener is added.
+ * @param ipAddress	The ip address of the device to connect to.
+ * @param port		The port of the device to connect to.
+ */
+OCP1SharedConnection::OCP1SharedConnection(const juce::String& ipAddress, int port)
+{
+    m_nanoOcp = std::make_unique<NanoOcp1::NanoOcp1Client>(ipAddress, port, false); // do not use async msg queue for ocp1 msg forwarding to not interlink RPBC processing with UI but keep it in separte bridging thread ecosystem
+
+    m_nanoOcp->onConnectionEstablished = [=]() {
+        ConnectionEstablished();
+    };
+    m_nanoOcp->onConnectionLost = [=]() {
+        ConnectionLost();
+    };
+    m_nanoOcp->onDataReceived = [=](const juce::MemoryBlock& data) {
+        return DataReceived(data);
+    };
+}
+
+/**
+ * Destructor
+ */
+OCP1SharedConnection::~OCP1SharedConnection()
+{
+    // the keepalive timer must not use the client any more when it is destroyed
+    stopTimerThread();
+
+    m_nanoOcp->onDataReceived = std::function<bool(const juce::MemoryBlock & data)>();
+    m_nanoOcp->onConnectionEstablished = std::function<void()>();
+    m_nanoOcp->onConnectionLost = std::function<void()>();
+
+    m_nanoOcp->stop();
+}
+
+/**
+ * Registers a listener for received data and connection state changes.
+ * The first listener starts the connection, later ones are notified
+ * right away if the connection is already established.
+ * @param listener	The listener to add.
+ */
+void OCP1SharedConnection::AddListener(Listener* listener)
+{
+    if (nullptr == listener)
+        return;
+
+    auto isFirstListener = false;
+    {
+        std::lock_guard<std::mutex> l(m_listenersMutex);
+        if (std::find(m_listeners.begin(), m_listeners.end(), listener) != m_listeners.end())
+            return;
+
+        m_listeners.push_back(listener);
+        isFirstListener = (m_listeners.size() == 1);
+    }
+
+    if (isFirstListener)
+        m_nanoOcp->start();
+    else if (IsConnected())
+        listener->OnSharedConnectionEstablished();
+}
+
+/**
+ * Unregisters a listener. When the last listener is removed, the connection is stopped.
+ * Since a distribution that is in progress is waited for, it is ensured that
+ * the listener is not called any more after this returns.
+ * @param listener	The listener to remove.
+ */
+void OCP1SharedConnection::RemoveListener(Listener* listener)
+{
+    auto isLastListener = false;
+    {
+        std::lock_guard<std::mutex> l(m_listenersMutex);
+        auto listenerIter = std::find(m_listeners.begin(), m_listeners.end(), listener);
+        if (listenerIter == m_listeners.end())
+            return;
+
+        m_listeners.erase(listenerIter);
+        isLastListener = m_listeners.empty();
+    }
+
+    // wait for a distribution that might currently be calling the listener
+    {
+        std::lock_guard<std::recursive_mutex> l(m_distributionMutex);
+    }
+
+    {
+        std::lock_guard<std::mutex> l(m_handlesMutex);
+        for (auto handleIter = m_pendingResponseHandles.begin(); handleIter != m_pendingResponseHandles.end();)
+        {
+            if (handleIter->second == listener)
+                handleIter = m_pendingResponseHandles.erase(handleIter);
+            else
+                handleIter++;
+        }
+        for (auto subscribersIter = m_subscribers.begin(); subscribersIter != m_subscribers.end();)
+        {
+            auto& subscribers = subscribersIter->second;
+            subscribers.erase(std::remove(subscribers.begin(), subscribers.end(), listener), subscribers.end());
+            if (subscribers.empty())
+                subscribersIter = m_subscribers.erase(subscribersIter);
+            else
+                subscribersIter++;
+        }
+    }
+
+    if (isLastListener)
+    {
+        stopTimerThread();
+        m_nanoOcp->stop();
+        m_isConnected = false;
+    }
+}
+
+/**
+ * Sends the given data through the shared connection.
+ * @param data	The data to send.
+ * @return	True if sending succeeded.
+ */
+bool OCP1SharedConnection::SendData(const juce::MemoryBlock& data)
+{
+    return m_nanoOcp->sendData(data);
+}
+
+/**
+ * Getter for the connection state.
+ * @return	True if the connection to the device is established.
+ */
+bool OCP1SharedConnection::IsConnected()
+{
+    return m_isConnected;
+}
+
+/**
+ * Registers the listener that awaits the response to a sent command.
+ * @param listener	The listener that sent the command.
+ * @param handle	The handle of the sent command.
+ */
+void OCP1SharedConnection::AddPendingResponseHandle(Listener* listener, const std::uint32_t handle)
+{
+    std::lock_guard<std::mutex> l(m_handlesMutex);
+    m_pendingResponseHandles[handle] = listener;
+}
+
+/**
+ * Unregisters the listener awaiting the response to a command, e.g. because sending the command failed.
+ * @param handle	The handle of the command.
+ */
+void OCP1SharedConnection::RemovePendingResponseHandle(const std::uint32_t handle)
+{
+    std::lock_guard<std::mutex> l(m_handlesMutex);
+    m_pendingResponseHandles.erase(handle);
+}
+
+/**
+ * Registers the requirement of a listener for a subscription of the given object.
+ * A listener holds at most one requirement per object, acquiring it again has no effect.
+ * @param listener	The listener that requires the notifications.
+ * @param ONo		The object number a subscription is required for.
+ * @return	True if this is the first requirement of any listener, meaning the caller has to actually send the subscription.
+ */
+bool OCP1SharedConnection::AcquireSubscription(Listener* listener, const std::uint32_t ONo)
+{
+    std::lock_guard<std::mutex> l(m_handlesMutex);
+    auto& subscribers = m_subscribers[ONo];
+    if (std::find(subscribers.begin(), subscribers.end(), listener) != subscribers.end())
+        return false;
+
+    subscribers.push_back(listener);
+    return (subscribers.size() == 1);
+}
+
+/**
+ * Releases the requirement of a listener for a subscription of the given object.
+ * Releasing a requirement the listener does not hold has no effect.
+ * @param listener	The listener that no longer requires the notifications.
+ * @param ONo		The object number the subscription is no longer required for.
+ * @return	True if this was the last requirement of any listener, meaning the caller has to actually remove the subscription.
+ */
+bool OCP1SharedConnection::ReleaseSubscription(Listener* listener, const std::uint32_t ONo)
+{
+    std::lock_guard<std::mutex> l(m_handlesMutex);
+    auto subscribersIter = m_subscribers.find(ONo);
+    if (subscribersIter == m_subscribers.end())
+        return false;
+
+    auto& subscribers = subscribersIter->second;
+    auto listenerIter = std::find(subscribers.begin(), subscribers.end(), listener);
+    if (listenerIter == subscribers.end())
+        return false;
+
+    subscribers.erase(listenerIter);
+    if (!subscribers.empty())
+        return false;
+
+    m_subscribers.erase(subscribersIter);
+    return true;
+}
+
+/**
+ * Reimplemented from TimerThreadBase to send the keepalive to the device.
+ * The keepalive response is distributed to all listeners, so each of them still gets the heartbeat.
+ */
+void OCP1SharedConnection::timerThreadCallback()
+{
+    if (!m_isConnected)
+        return;
+
+    if (!m_nanoOcp->sendData(NanoOcp1::Ocp1KeepAlive(static_cast<std::uint16_t>(s_keepAliveInterval / 1000)).GetMemoryBlock())) // Ocp1KeepAlive 16bit value refers to seconds
+        DBG(juce::String(__FUNCTION__) + " sending Ocp1 keepalive failed.");
+}
+
+/**
+ * Unmarshals received data once and distributes the message to the listeners it concerns.
+ * @param data	The received data.
+ * @return	True if any of the listeners handled the message.
+ */
+bool OCP1SharedConnection::DataReceived(const juce::MemoryBlock& data)
+{
+    auto msgObj = NanoOcp1::Ocp1Message::UnmarshalOcp1Message(data);
+    if (!msgObj)
+        return false;
+
+    auto receivers = std::vector<Listener*>();
+    switch (msgObj->GetMessageType())
+    {
+    case NanoOcp1::Ocp1Message::Notification:
+        {
+            auto ONo = static_cast<NanoOcp1::Ocp1Notification*>(msgObj.get())->GetEmitterOno();
+            std::lock_guard<std::mutex> l(m_handlesMutex);
+            auto subscribersIter = m_subscribers.find(ONo);
+            if (subscribersIter != m_subscribers.end())
+                receivers = subscribersIter->second;
+        }
+        break;
+    case NanoOcp1::Ocp1Message::Response:
+        {
+            auto handle = static_cast<NanoOcp1::Ocp1Response*>(msgObj.get())->GetResponseHandle();
+            std::lock_guard<std::mutex> l(m_handlesMutex);
+            auto handleIter = m_pendingResponseHandles.find(handle);
+            if (handleIter != m_pendingResponseHandles.end())
+            {
+                receivers.push_back(handleIter->second);
+                m_pendingResponseHandles.erase(handleIter);
+            }
+        }
+        break;
+    default:
+        receivers = GetListeners();
+        break;
+    }
+
+    auto handled = false;
+
+    std::lock_guard<std::recursive_mutex> l(m_distributionMutex);
+    for (auto const& receiver : receivers)
+    {
+        if (IsListener(receiver))
+            handled = receiver->OnSharedConnectionMessageReceived(msgObj.get()) || handled;
+    }
+
+    return handled;
+}
+
+/**
+ * Distributes the established connection state to all listeners.
+ */
+void OCP1SharedConnection::ConnectionEstablished()
+{
+    m_isConnected = true;
+    startTimerThread(s_keepAliveInterval, 100);
+
+    std::lock_guard<std::recursive_mutex> l(m_distributionMutex);
+    for (auto const& listener : GetListeners())
+    {
+        if (IsListener(listener))
+            listener->OnSharedConnectionEstablished();
+    }
+}
+
+/**
+ * Distributes the lost connection state to all listeners.
+ * The device has dropped all subscriptions with the connection, so the registry is reset as well.
+ */
+void OCP1SharedConnection::ConnectionLost()
+{
+    m_isConnected = false;
+    stopTimerThread();
+
+    {
+        std::lock_guard<std::mutex> l(m_handlesMutex);
+        m_pendingResponseHandles.clear();
+        m_subscribers.clear();
+    }
+
+    std::lock_guard<std::recursive_mutex> l(m_distributionMutex);
+    for (auto const& listener : GetListeners())
+    {
+        if (IsListener(listener))
+            listener->OnSharedConnectionLost();
+    }
+}
+
+/**
+ * Getter for a copy of the current listeners, to call them without holding the list lock.
+ * @return	The currently registered listeners.
+ */
+std::vector<OCP1SharedConnection::Listener*> OCP1SharedConnection::GetListeners()
+{
+    std::lock_guard<std::mutex> l(m_listenersMutex);
+    return m_listeners;
+}
+
+/**
+ * Helper to check if a listener still is registered, since it might have been removed
+ * after the receivers of a distribution were collected.
+ * @param listener	The listener to check.
+ * @return	True if the listener is registered.
+ */
+bool OCP1SharedConnection::IsListener(Listener* listener)
+{
+    std::lock_guard<std::mutex> l(m_listenersMutex);
+    return std::find(m_listeners.begin(), m_listeners.end(), listener) != m_listeners.end();
+}
+
+
+// **************************************************************************************
+//    class OCP1ConnectionPool
+// **************************************************************************************
+/**
+ * Constructor
+ */
+OCP1ConnectionPool::OCP1ConnectionPool()
+{
+}
+
+/**
+ * Destructor
+ */
+OCP1ConnectionPool::~OCP1ConnectionPool()
+{
+}
+
+/**
+ * Getter for the shared connection to a given device.
+ * If no processor currently uses a connection to the device, a new one is created.
+ * @param ipAddress	The ip address of the device.
+ * @param port		The port of the device.
+ * @return	The shared connection object.
+ */
+std::shared_ptr<OCP1SharedConnection> OCP1ConnectionPool::GetConnection(const juce::String& ipAddress, int port)
+{
+    std::lock_guard<std::mutex> l(m_connectionsMutex);
+
+    auto key = std::make_pair(ipAddress, port);
+    auto connection = m_connections[key].lock();
+    if (!connection)
+    {
+        connection = std::make_shared<OCP1SharedConnection>(ipAddress, port);
+        m_connections[key] = connection;
+    }
+
+    // drop entries of connections that are no longer in use
+    for (auto connectionIter = m_connections.begin(); connectionIter != m_connections.end();)
+    {
+        if (connectionIter->second.expired())
+            connectionIter = m_connections.erase(connectionIter);
+        else
+            connectionIter++;
+    }
+
+    return connection;
+}
@@ -0,0 +1,134 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include "../../../RemoteProtocolBridgeCommon.h"
+#include "../../TimerThreadBase.h"
+
+#include <JuceHeader.h>
+
+
+/**
+ * Fwd. decl.
+ */
+namespace NanoOcp1
+{
+	class NanoOcp1Client;
+	class Ocp1Message;
+};
+
+/**
+ * Class OCP1SharedConnection wraps a single NanoOcp1 client connection to a device
+ * that is used by all OCP1 protocol processors targeting the same ip and port.
+ * Received messages are unmarshalled once and multiplexed to the listeners:
+ * notifications go to the listeners subscribed to the emitting object, responses to the
+ * listener that sent the command and keepalives as well as connection state changes to all.
+ * Device subscriptions are reference counted, to only be added once and
+ * only be removed when no listener requires them any longer.
+ * The keepalive is sent once per connection while it is established, not by every listener.
+ */
+class OCP1SharedConnection : public TimerThreadBase
+{
+public:
+	/**
+	 * Abstract embedded interface class for shared connection data and state handling
+	 */
+	class Listener
+	{
+	public:
+		Listener() {};
+		virtual ~Listener() {};
+
+		virtual bool OnSharedConnectionMessageReceived(NanoOcp1::Ocp1Message* msgObj) = 0;
+		virtual void OnSharedConnectionEstablished() = 0;
+		virtual void OnSharedConnectionLost() = 0;
+	};
+
+public:
+	OCP1SharedConnection(const juce::String& ipAddress, int port);
+	~OCP1SharedConnection();
+
+	//==============================================================================
+	void AddListener(Listener* listener);
+	void RemoveListener(Listener* listener);
+
+	//==============================================================================
+	bool SendData(const juce::MemoryBlock& data);
+	bool IsConnected();
+
+	//==============================================================================
+	void AddPendingResponseHandle(Listener* listener, const std::uint32_t handle);
+	void RemovePendingResponseHandle(const std::uint32_t handle);
+
+	//==============================================================================
+	bool AcquireSubscription(Listener* listener, const std::uint32_t ONo);
+	bool ReleaseSubscription(Listener* listener, const std::uint32_t ONo);
+
+protected:
+	//==============================================================================
+	void timerThreadCallback() override;
+
+private:
+	//==============================================================================
+	bool DataReceived(const juce::MemoryBlock& data);
+	void ConnectionEstablished();
+	void ConnectionLost();
+
+	//==============================================================================
+	std::vector<Listener*> GetListeners();
+	bool IsListener(Listener* listener);
+
+	//==============================================================================
+	std::unique_ptr<NanoOcp1::NanoOcp1Client>	m_nanoOcp;
+	std::atomic<bool>							m_isConnected{ false };
+
+	std::mutex									m_listenersMutex;
+	std::vector<Listener*>						m_listeners;			/**< The processors that use this connection. */
+	std::recursive_mutex						m_distributionMutex;	/**< Held while listeners are called, without blocking the listener list, so that removing a listener can wait for a running distribution. */
+
+	std::mutex									m_handlesMutex;
+	std::map<std::uint32_t, Listener*>			m_pendingResponseHandles;	/**< The listener that awaits the response, per command handle. */
+	std::map<std::uint32_t, std::vector<Listener*>>	m_subscribers;			/**< The listeners that require a subscription on the device, per object ONo. */
+
+	static constexpr int s_keepAliveInterval = 1000;	/**< The interval in ms the keepalive is sent at, matching the 1s keepalive heartbeat time announced to the device. */
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OCP1SharedConnection)
+};
+
+/**
+ * Class OCP1ConnectionPool provides the OCP1SharedConnection instances, keyed by ip and port.
+ * It is owned by the processing engine, so connections are only shared between the processors of one engine.
+ * A connection lives as long as any protocol processor holds a reference to it.
+ */
+class OCP1ConnectionPool
+{
+public:
+	OCP1ConnectionPool();
+	~OCP1ConnectionPool();
+
+	//==============================================================================
+	std::shared_ptr<OCP1SharedConnection> GetConnection(const juce::String& ipAddress, int port);
+
+private:
+	//==============================================================================
+	std::mutex																		m_connectionsMutex;
+	std::map<std::pair<juce::String, int>, std::weak_ptr<OCP1SharedConnection>>	m_connections;	/**< The connections currently in use, keyed by ip and port. */
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OCP1ConnectionPool)
+};
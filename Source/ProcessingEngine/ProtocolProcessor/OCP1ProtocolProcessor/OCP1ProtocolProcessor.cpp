@@ -28,9 +28,12 @@
 // **************************************************************************************
 /**
  * Derived OCP1 remote protocol processing class
+ * @param parentNodeId		The id of the node the processor belongs to.
+ * @param connectionPool	The engine owned pool to get the connection from in 'sharedclient' connection mode, if any.
  */
-OCP1ProtocolProcessor::OCP1ProtocolProcessor(const NodeId& parentNodeId)
-    : NetworkProtocolProcessorBase(parentNodeId)
+OCP1ProtocolProcessor::OCP1ProtocolProcessor(const NodeId& parentNodeId, OCP1ConnectionPool* connectionPool)
+    : NetworkProtocolProcessorBase(parentNodeId),
+    m_connectionPool(connectionPool)
 {
     m_type = ProtocolType::PT_OCP1Protocol;
 
@@ -52,21 +55,21 @@ OCP1ProtocolProcessor::~OCP1ProtocolProcessor()
  */
 bool OCP1ProtocolProcessor::Start()
 {
-    if (m_nanoOcp)
+    if (m_sharedConnection)
+    {
+        // the pooled connection notifies right away if it already is established
+        m_sharedConnection->AddListener(this);
+
+        return true;
+    }
+    else if (m_nanoOcp)
     {
         // assign lambdas for connection status tracking first
         m_nanoOcp->onConnectionEstablished = [=]() {
-            startTimerThread(GetActiveRemoteObjectsInterval(), 100);
-            m_IsRunning = true;
-            CreateObjectSubscriptions();
-            QueryObjectValues();
+            ConnectionEstablished();
         };
         m_nanoOcp->onConnectionLost = [=]() {
-            stopTimerThread();
-            m_IsRunning = false;
-            DeleteObjectSubscriptions();
-            ClearPendingHandles();
-            GetValueCache().Clear();
+            ConnectionLost();
         };
 
         // then fire up nanoocp
@@ -95,17 +98,124 @@ bool OCP1ProtocolProcessor::Stop()
         m_nanoOcp->onConnectionLost = std::function<void()>();
     }
 
+    // remove the subscriptions while still running, to not leave the device notifying objects noone is interested in
+    DeleteObjectSubscriptions();
+
     m_IsRunning = false;
 
     // stop the send timer thread
     stopTimerThread();
 
-    if (m_nanoOcp)
+    if (m_sharedConnection)
+    {
+        // the pooled connection is only closed when the last processor using it is removed
+        m_sharedConnection->RemoveListener(this);
+        return true;
+    }
+    else if (m_nanoOcp)
         return m_nanoOcp->stop();
     else
         return false;
 }
 
+/**
+ * Helper to set up the processing once the connection to the device is established.
+ */
+void OCP1ProtocolProcessor::ConnectionEstablished()
+{
+    startTimerThread(GetTimerThreadInterval(), 100);
+    m_IsRunning = true;
+    CreateObjectSubscriptions();
+    QueryObjectValues();
+}
+
+/**
+ * Helper to reset the processing once the connection to the device is lost.
+ */
+void OCP1ProtocolProcessor::ConnectionLost()
+{
+    stopTimerThread();
+    m_IsRunning = false;
+    DeleteObjectSubscriptions();
+    ClearPendingHandles();
+    GetValueCache().Clear();
+}
+
+/**
+ * Reimplemented from OCP1SharedConnection::Listener to handle
+ * the messages the pooled connection routes to this processor.
+ * @param msgObj	The already unmarshalled message.
+ * @return	True if the message was handled.
+ */
+bool OCP1ProtocolProcessor::OnSharedConnectionMessageReceived(NanoOcp1::Ocp1Message* msgObj)
+{
+    return ocp1MessageReceived(msgObj);
+}
+
+/**
+ * Reimplemented from OCP1SharedConnection::Listener to start processing when the pooled connection is established.
+ */
+void OCP1ProtocolProcessor::OnSharedConnectionEstablished()
+{
+    ConnectionEstablished();
+}
+
+/**
+ * Reimplemented from OCP1SharedConnection::Listener to reset processing when the pooled connection is lost.
+ */
+void OCP1ProtocolProcessor::OnSharedConnectionLost()
+{
+    ConnectionLost();
+}
+
+/**
+ * Helper to check if a connection object, either pooled or private, is available.
+ * @return	True if a connection object is available.
+ */
+bool OCP1ProtocolProcessor::HasConnection()
+{
+    return m_sharedConnection || m_nanoOcp;
+}
+
+/**
+ * Helper to send data through the pooled or the private connection, whichever is in use.
+ * @param data	The data to send.
+ * @return	True if sending succeeded.
+ */
+bool OCP1ProtocolProcessor::SendOcp1Data(const juce::MemoryBlock& data)
+{
+    if (m_sharedConnection)
+        return m_sharedConnection->SendData(data);
+    else if (m_nanoOcp)
+        return m_nanoOcp->sendData(data);
+    else
+        return false;
+}
+
+/**
+ * Helper to send a command whose response handle was registered as pending before.
+ * The handle is registered before sending, since the response may be received before sending returns.
+ * If sending fails, no response will arrive, so the handle is unregistered again.
+ * @param data		The marshalled command to send.
+ * @param handle	The handle of the command.
+ * @return	True if sending succeeded.
+ */
+bool OCP1ProtocolProcessor::SendOcp1Command(const juce::MemoryBlock& data, const std::uint32_t handle)
+{
+    if (SendOcp1Data(data))
+        return true;
+
+    auto externalId = -1;
+    PopPendingSubscriptionHandle(handle);
+    PopPendingGetValueHandle(handle);
+    PopPendingSetValueHandle(handle, externalId);
+
+    if (m_sharedConnection)
+        m_sharedConnection->RemovePendingResponseHandle(handle);
+
+    return false;
+}
+
 /**
  * Sets the xml configuration for the protocol processor object.
  *
@@ -123,12 +233,53 @@ bool OCP1ProtocolProcessor::setStateXml(XmlElement* stateXml)
         {
             auto modeString = ocp1ConnectionModeXmlElement->getAllSubText();
             if (modeString == "server")
+            {
+                m_sharedConnection.reset();
                 m_nanoOcp = std::make_unique<NanoOcp1::NanoOcp1Server>(GetIpAddress(), GetClientPort(), false); // do not use async msg queue for ocp1 msg forwarding to not interlink RPBC processing with UI but keep it in separte bridging thread ecosystem
-            else if (modeString == "client")
+            }
+            else if (modeString == "client" || (modeString == "sharedclient" && !m_connectionPool))
+            {
+                m_sharedConnection.reset();
                 m_nanoOcp = std::make_unique<NanoOcp1::NanoOcp1Client>(GetIpAddress(), GetClientPort(), false); // do not use async msg queue for ocp1 msg forwarding to not interlink RPBC processing with UI but keep it in separte bridging thread ecosystem
+            }
+            else if (modeString == "sharedclient")
+            {
+                // all processors of the engine connecting to the same device share one connection and its subscriptions
+                m_nanoOcp.reset();
+                m_sharedConnection = m_connectionPool->GetConnection(GetIpAddress(), GetClientPort());
+            }
             else
                 return false;
 
+            // optional subscription mode, defaults to subscribing all active objects on connect
+            auto ocp1SubscriptionModeXmlElement = stateXml->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::OCP1SUBSCRIPTIONMODE));
+            if (ocp1SubscriptionModeXmlElement)
+                m_subscribeOnDemand = (ocp1SubscriptionModeXmlElement->getAllSubText() == "ondemand");
+            else
+                m_subscribeOnDemand = false;
+
+            // the configured active objects are the base the on demand objects are added to.
+            // They are read from the configuration itself, since the current active objects may already include on demand objects.
+            auto configuredActiveObjects = std::vector<RemoteObject>();
+            if (stateXml->getIntAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::USESACTIVEOBJ)) == 1)
+            {
+                ProcessingEngineConfig::ReadActiveObjects(stateXml->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::ACTIVEOBJECTS)), configuredActiveObjects);
+                auto heartbeatObject = RemoteObject(ROI_HeartbeatPing, RemoteObjectAddressing());
+                if (std::find(configuredActiveObjects.begin(), configuredActiveObjects.end(), heartbeatObject) == configuredActiveObjects.end())
+                    configuredActiveObjects.push_back(heartbeatObject);
+            }
+            {
+                const ScopedLock l(m_onDemandObjectsLock);
+                m_configuredActiveObjects = std::move(configuredActiveObjects);
+                m_onDemandDerivedObjects.clear();
+                m_onDemandRequestedObjects.clear();
+                m_onDemandRequestedCount = 0;
+                m_onDemandObjectsVersion++;
+                UpdateOnDemandKeptObjects();
+            }
+            if (m_subscribeOnDemand)
+                ApplyOnDemandActiveObjects();
+
             return true;
         }
         else
@@ -136,6 +287,176 @@ bool OCP1ProtocolProcessor::setStateXml(XmlElement* stateXml)
     }
 }
 
+/**
+ * Getter for the subscription mode.
+ * If subscribing on demand, the parent node derives the active objects 
+ * from what its other protocols are handling and subscriptions are 
+ * added or removed incrementally when the active objects change.
+ * @return  True if subscriptions are maintained on demand, false if all active objects are subscribed on connect.
+ */
+bool OCP1ProtocolProcessor::IsSubscribingOnDemand()
+{
+    return m_subscribeOnDemand;
+}
+
+/**
+ * Setter for the objects the parent node derived from the protocols of the opposite role.
+ * They replace the previously derived ones and are kept active, in addition to the configured
+ * objects and the ones requested at runtime, as long as the node configuration does not change.
+ * @param objects   The objects handled by the protocols of the opposite role.
+ */
+void OCP1ProtocolProcessor::SetOnDemandObjects(const std::vector<RemoteObject>& objects)
+{
+    {
+        const ScopedLock l(m_onDemandObjectsLock);
+
+        m_onDemandDerivedObjects = objects;
+        m_onDemandObjectsVersion++;
+        UpdateOnDemandKeptObjects();
+    }
+
+    ApplyOnDemandActiveObjects();
+}
+
+/**
+ * Helper to mark an object as requested when a message is sent for it in on demand subscription mode.
+ * Objects that are not active yet are added and thereby subscribed. Objects requested this way
+ * expire if they are not requested again within s_onDemandRequestTimeout, and their count is
+ * limited to s_maxOnDemandRequestedObjects by dropping the least recently requested one.
+ * @param object    The object a message is sent for.
+ */
+void OCP1ProtocolProcessor::RequestObjectOnDemand(const RemoteObject& object)
+{
+    // configured and derived objects are active anyway, only objects requested at runtime have to be tracked under the lock
+    auto keptObjects = std::atomic_load(&m_onDemandKeptObjects);
+    if (keptObjects && keptObjects->Contains(object))
+        return;
+    if (m_onDemandRequestedCount == 0 && GetActiveRemoteObjects()->Contains(object))
+        return;
+
+    {
+        const ScopedLock l(m_onDemandObjectsLock);
+
+        auto now = Time::getMillisecondCounter();
+        auto requestedObjectIter = m_onDemandRequestedObjects.find(object);
+        if (requestedObjectIter != m_onDemandRequestedObjects.end())
+        {
+            requestedObjectIter->second = now;
+            return;
+        }
+
+        if (GetActiveRemoteObjects()->Contains(object))
+            return;
+
+        if (static_cast<int>(m_onDemandRequestedObjects.size()) >= s_maxOnDemandRequestedObjects)
+        {
+            auto leastRecentlyRequestedIter = std::min_element(m_onDemandRequestedObjects.begin(), m_onDemandRequestedObjects.end(),
+                [now](const auto& a, const auto& b) { return (now - a.second) > (now - b.second); });
+            m_onDemandRequestedObjects.erase(leastRecentlyRequestedIter);
+        }
+
+        m_onDemandRequestedObjects[object] = now;
+        m_onDemandRequestedCount = static_cast<int>(m_onDemandRequestedObjects.size());
+        m_onDemandObjectsVersion++;
+    }
+
+    ApplyOnDemandActiveObjects();
+}
+
+/**
+ * Helper to remove the objects requested at runtime that were not requested again within s_onDemandRequestTimeout.
+ */
+void OCP1ProtocolProcessor::ExpireOnDemandObjects()
+{
+    if (m_onDemandRequestedCount == 0)
+        return;
+
+    auto expired = false;
+    {
+        const ScopedLock l(m_onDemandObjectsLock);
+
+        auto now = Time::getMillisecondCounter();
+        for (auto requestedObjectIter = m_onDemandRequestedObjects.begin(); requestedObjectIter != m_onDemandRequestedObjects.end();)
+        {
+            if (now - requestedObjectIter->second > s_onDemandRequestTimeout)
+            {
+                requestedObjectIter = m_onDemandRequestedObjects.erase(requestedObjectIter);
+                expired = true;
+            }
+            else
+                requestedObjectIter++;
+        }
+
+        if (expired)
+        {
+            m_onDemandRequestedCount = static_cast<int>(m_onDemandRequestedObjects.size());
+            m_onDemandObjectsVersion++;
+        }
+    }
+
+    if (expired)
+        ApplyOnDemandActiveObjects();
+}
+
+/**
+ * Helper to set the active objects to the configured, derived and requested on demand objects,
+ * which incrementally updates the device subscriptions.
+ * Must be called without m_onDemandObjectsLock held, since updating the subscriptions sends to the device.
+ * Concurrent calls are serialized and each applies the latest on demand objects, so an outdated set is never applied last.
+ */
+void OCP1ProtocolProcessor::ApplyOnDemandActiveObjects()
+{
+    const ScopedLock applyLock(m_onDemandApplyLock);
+
+    auto activeObjects = std::vector<RemoteObject>();
+    {
+        const ScopedLock l(m_onDemandObjectsLock);
+
+        if (m_onDemandAppliedVersion == m_onDemandObjectsVersion)
+            return;
+        m_onDemandAppliedVersion = m_onDemandObjectsVersion;
+
+        activeObjects = m_configuredActiveObjects;
+        auto addActiveObject = [&activeObjects](const RemoteObject& object) {
+            if (std::find(activeObjects.begin(), activeObjects.end(), object) == activeObjects.end())
+                activeObjects.push_back(object);
+        };
+
+        for (auto const& object : m_onDemandDerivedObjects)
+            addActiveObject(object);
+        for (auto const& requestedObject : m_onDemandRequestedObjects)
+            addActiveObject(requestedObject.first);
+    }
+
+    SetRemoteObjectsActive(activeObjects);
+}
+
+/**
+ * Helper to update the set of configured and derived objects, that sent objects are checked against without locking.
+ * Must be called with m_onDemandObjectsLock held.
+ */
+void OCP1ProtocolProcessor::UpdateOnDemandKeptObjects()
+{
+    auto keptObjects = m_configuredActiveObjects;
+    for (auto const& object : m_onDemandDerivedObjects)
+    {
+        if (std::find(keptObjects.begin(), keptObjects.end(), object) == keptObjects.end())
+            keptObjects.push_back(object);
+    }
+
+    std::atomic_store(&m_onDemandKeptObjects, std::shared_ptr<const RemoteObjectSet>(std::make_shared<const RemoteObjectSet>(keptObjects)));
+}
+
+/**
+ * Reimplemented from ProtocolProcessorBase to incrementally update
+ * the device subscriptions when running in on demand subscription mode.
+ */
+void OCP1ProtocolProcessor::OnRemoteObjectsActiveChanged()
+{
+    if (m_subscribeOnDemand)
+        UpdateObjectSubscriptions();
+}
+
 /**
  *  @brief  Get and eventually initialize RemoteObject position data
  *  @param[in]  targetObj    Object to check and possibly initialize the cache
@@ -144,12 +465,12 @@ bool OCP1ProtocolProcessor::setStateXml(XmlElement* stateXml)
  */
 bool OCP1ProtocolProcessor::PreparePositionMessageData(const RemoteObject& targetObj, RemoteObjectMessageData& msgDataToSet)
 {
-    float zeroPayload[3] = { 0.0f, 0.0f, 0.0f };
-    if (!GetValueCache().Contains(targetObj))
-        GetValueCache().SetValue(targetObj, RemoteObjectMessageData(targetObj._Addr, ROVT_FLOAT, 3, &zeroPayload, 3 * sizeof(float)));
-
-    // get the xyz data from cache to insert the new x data and send the xyz out
-    msgDataToSet = GetValueCache().GetValue(targetObj);
+    // get a copy of the xyz data from cache (zero if not yet known) to insert the new x data and send the xyz out
+    if (!GetValueCache().GetValue(targetObj, msgDataToSet))
+    {
+        float zeroPayload[3] = { 0.0f, 0.0f, 0.0f };
+        msgDataToSet.payloadCopy(RemoteObjectMessageData(targetObj._Addr, ROVT_FLOAT, 3, &zeroPayload, 3 * sizeof(float)));
+    }
     return (msgDataToSet._valCount == 3 && msgDataToSet._payloadSize == 3 * sizeof(float));
 }
 
@@ -167,16 +488,20 @@ bool OCP1ProtocolProcessor::PreparePositionMessageData(const RemoteObject& targe
  */
 bool OCP1ProtocolProcessor::SendRemoteObjectMessage(const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, const int externalId)
 {
-    // if NanoOcp does not exist or the processor is not running, give up immediately
-    if (!m_nanoOcp || !m_IsRunning)
+    // if no connection exists or the processor is not running, give up immediately
+    if (!HasConnection() || !m_IsRunning)
         return false;
 
     // if we are dealing with the special ROI for heartbeat (Ocp1 Keepalive), send it right away
     if (roi == ROI_HeartbeatPing)
-        return m_nanoOcp->sendData(NanoOcp1::Ocp1KeepAlive(static_cast<std::uint16_t>(1)).GetMemoryBlock()); // Ocp1KeepAlive 32bit integer value refers to milliseconds, 16bit to seconds
+        return SendOcp1Data(NanoOcp1::Ocp1KeepAlive(static_cast<std::uint16_t>(1)).GetMemoryBlock()); // Ocp1KeepAlive 32bit integer value refers to milliseconds, 16bit to seconds
     if (roi == ROI_HeartbeatPong)
         return false;
 
+    // in on demand subscription mode, objects other protocols send messages for are subscribed while they are in use
+    if (m_subscribeOnDemand && roi < ROI_BridgingMAX)
+        RequestObjectOnDemand(RemoteObject(roi, msgData._addrVal));
+
     // if the ROI data is empty, it is a value request message that must be handled as such
     if (msgData.isDataEmpty() && !(roi == ROI_Scene_Next || roi == ROI_Scene_Previous))
         return QueryObjectValue(roi, msgData._addrVal);
@@ -562,9 +887,9 @@ bool OCP1ProtocolProcessor::SendRemoteObjectMessage(const RemoteObjectIdentifier
                 return false;
 
             // Very special handling in contrast to the other ROIs: use "ApplyCommand" on SceneAgent instead of "SetValueCommand"
-            bool success = m_nanoOcp->sendData(NanoOcp1::Ocp1CommandResponseRequired(sceneAgentObjDef->ApplyCommand(sceneIndex[0], sceneIndex[1]), handle).GetMemoryBlock());
+            auto applyCommand = NanoOcp1::Ocp1CommandResponseRequired(sceneAgentObjDef->ApplyCommand(sceneIndex[0], sceneIndex[1]), handle);
             AddPendingSetValueHandle(handle, sceneAgentObjDef->m_targetOno, externalId);
-            return success;
+            return SendOcp1Command(applyCommand.GetMemoryBlock(), handle);
         }
     case ROI_Scene_Next:
         {
@@ -574,9 +899,9 @@ bool OCP1ProtocolProcessor::SendRemoteObjectMessage(const RemoteObjectIdentifier
                 return false;
 
             // Very special handling in contrast to the other ROIs: use "NextCommand" on SceneAgent instead of "SetValueCommand"
-            bool success = m_nanoOcp->sendData(NanoOcp1::Ocp1CommandResponseRequired(sceneAgentObjDef->NextCommand(), handle).GetMemoryBlock());
+            auto nextCommand = NanoOcp1::Ocp1CommandResponseRequired(sceneAgentObjDef->NextCommand(), handle);
             AddPendingSetValueHandle(handle, objDef->m_targetOno, externalId);
-            return success;
+            return SendOcp1Command(nextCommand.GetMemoryBlock(), handle);
         }
         break;
     case ROI_Scene_Previous:
@@ -589,9 +914,9 @@ bool OCP1ProtocolProcessor::SendRemoteObjectMessage(const RemoteObjectIdentifier
             // Set object definition
             auto sceneAgent = NanoOcp1::DS100::dbOcaObjectDef_SceneAgent();
             // Very special handling in contrast to the other ROIs: use "PreviousCommand" on SceneAgent instead of "SetValueCommand"
-            bool success = m_nanoOcp->sendData(NanoOcp1::Ocp1CommandResponseRequired(sceneAgentObjDef->PreviousCommand(), handle).GetMemoryBlock());
+            auto previousCommand = NanoOcp1::Ocp1CommandResponseRequired(sceneAgentObjDef->PreviousCommand(), handle);
             AddPendingSetValueHandle(handle, objDef->m_targetOno, externalId);
-            return success;
+            return SendOcp1Command(previousCommand.GetMemoryBlock(), handle);
         }
         break;
     case ROI_SoundObjectRouting_Mute:
@@ -614,11 +939,11 @@ bool OCP1ProtocolProcessor::SendRemoteObjectMessage(const RemoteObjectIdentifier
     // Set the value to the cache (use the msgDataToSet if it contains data)
     GetValueCache().SetValue(targetObj, msgDataToSet.isDataEmpty() ? msgData : msgDataToSet);
 
-    // Send SetValue command
-    bool success = m_nanoOcp->sendData( NanoOcp1::Ocp1CommandResponseRequired(objDef->SetValueCommand(objValue), handle).GetMemoryBlock());
+    // Send SetValue command, with the handle registered before, since the response may arrive before sending returns
+    auto setValueCommand = NanoOcp1::Ocp1CommandResponseRequired(objDef->SetValueCommand(objValue), handle);
     AddPendingSetValueHandle(handle, objDef->m_targetOno, externalId);
     //DBG(juce::String(__FUNCTION__) + " " + ProcessingEngineConfig::GetObjectTagName(roi) + "(handle: " + NanoOcp1::HandleToString(handle) + ")");
-    return success;
+    return SendOcp1Command(setValueCommand.GetMemoryBlock(), handle);
 }
 
 /**
@@ -742,26 +1067,59 @@ void OCP1ProtocolProcessor::CreateKnownONosMap()
 
 /**
  * TimerThreadBase callback to send keepalive queries cyclically
+ * and to expire the objects requested on demand that are no longer in use.
  */
 void OCP1ProtocolProcessor::timerThreadCallback()
 {
     if (m_IsRunning)
     {
-        if (!SendRemoteObjectMessage(ROI_HeartbeatPing, RemoteObjectMessageData()))
+        // the pooled connection sends the keepalive itself, once for all processors using it
+        if (!m_sharedConnection && !SendRemoteObjectMessage(ROI_HeartbeatPing, RemoteObjectMessageData()))
             DBG(juce::String(__FUNCTION__) + " sending Ocp1 heartbeat failed.");
+
+        if (m_subscribeOnDemand)
+            ExpireOnDemandObjects();
     }
 }
 
+/**
+ * Reimplemented from ProtocolProcessorBase to not use the active objects polling chunk interval,
+ * but the interval the keepalive queries are sent at.
+ * @return	The timer thread interval in ms.
+ */
+int OCP1ProtocolProcessor::GetTimerThreadInterval()
+{
+    return GetActiveRemoteObjectsInterval();
+}
+
+/**
+ * Callback for data received on the private connection, that is unmarshalled and handled.
+ * @param data	The received data.
+ * @return	True if the data was handled.
+ */
 bool OCP1ProtocolProcessor::ocp1MessageReceived(const juce::MemoryBlock& data)
 {
     std::unique_ptr<NanoOcp1::Ocp1Message> msgObj = NanoOcp1::Ocp1Message::UnmarshalOcp1Message(data);
+    if (msgObj)
+        return ocp1MessageReceived(msgObj.get());
+
+    return false;
+}
+
+/**
+ * Handles a received, already unmarshalled message.
+ * @param msgObj	The received message.
+ * @return	True if the message was handled.
+ */
+bool OCP1ProtocolProcessor::ocp1MessageReceived(NanoOcp1::Ocp1Message* msgObj)
+{
     if (msgObj)
     {
         switch (msgObj->GetMessageType())
         {
         case NanoOcp1::Ocp1Message::Notification:
         {
-            NanoOcp1::Ocp1Notification* notifObj = static_cast<NanoOcp1::Ocp1Notification*>(msgObj.get());
+            NanoOcp1::Ocp1Notification* notifObj = static_cast<NanoOcp1::Ocp1Notification*>(msgObj);
 
             if (UpdateObjectValue(notifObj))
                 return true;
@@ -772,7 +1130,7 @@ bool OCP1ProtocolProcessor::ocp1MessageReceived(const juce::MemoryBlock& data)
         }
         case NanoOcp1::Ocp1Message::Response:
         {
-            NanoOcp1::Ocp1Response* responseObj = static_cast<NanoOcp1::Ocp1Response*>(msgObj.get());
+            NanoOcp1::Ocp1Response* responseObj = static_cast<NanoOcp1::Ocp1Response*>(msgObj);
 
             auto handle = responseObj->GetResponseHandle();
             if (responseObj->GetResponseStatus() != 0)
@@ -1029,45 +1387,184 @@ std::optional<std::unique_ptr<NanoOcp1::Ocp1CommandDefinition>> OCP1ProtocolProc
  */
 bool OCP1ProtocolProcessor::CreateObjectSubscriptions()
 {
-    if (!m_nanoOcp || !m_IsRunning)
+    if (!HasConnection() || !m_IsRunning)
         return false;
 
-    auto handle = std::uint32_t(0);
     auto success = true;
 
-    for (auto const& activeObj : GetOcp1SupportedActiveRemoteObjects())
+    for (auto const& activeObj : GetOcp1SubscriptionRemoteObjects())
+        success = SubscribeObject(activeObj) && success;
+
+    return success;
+}
+
+/**
+ * @brief  Remove all subscriptions
+ * @details If the connection is already lost, only the internal bookkeeping is cleared.
+ * @returns True if all subscriptions were sucessfully removed
+ */
+bool OCP1ProtocolProcessor::DeleteObjectSubscriptions()
+{
+    auto subscribedObjects = std::vector<RemoteObject>();
     {
-        // Get the object definition
-        auto objDefOpt = GetObjectDefinition(activeObj._Id, activeObj._Addr);
+        std::lock_guard<std::mutex> l(m_subscribedObjectsMutex);
+        subscribedObjects = m_subscribedObjects;
+    }
 
-        // Sanity checks
-        jassert(objDefOpt); // Missing implementation!
-        if (!objDefOpt)
-            return false;
-        auto& objDef = objDefOpt.value();
-        if (!objDef)
-            return false;
+    auto success = true;
+    if (HasConnection() && m_IsRunning)
+    {
+        for (auto const& subscribedObj : subscribedObjects)
+            success = UnsubscribeObject(subscribedObj) && success;
+    }
+
+    std::lock_guard<std::mutex> l(m_subscribedObjectsMutex);
+    m_subscribedObjects.clear();
+    m_subscribedONoCounts.clear();
+
+    return success;
+}
+
+/**
+ * @brief  Incrementally update the device subscriptions to match the current active remote objects
+ * @details Objects no longer active are unsubscribed, newly active objects are subscribed and their value queried.
+ * @returns True if all subscription changes were sucessfully sent
+ */
+bool OCP1ProtocolProcessor::UpdateObjectSubscriptions()
+{
+    if (!HasConnection() || !m_IsRunning)
+        return false;
+
+    auto subscriptionObjects = GetOcp1SubscriptionRemoteObjects();
+    auto subscribedObjects = std::vector<RemoteObject>();
+    {
+        std::lock_guard<std::mutex> l(m_subscribedObjectsMutex);
+        subscribedObjects = m_subscribedObjects;
+    }
+
+    auto success = true;
 
-        success = success && m_nanoOcp->sendData(NanoOcp1::Ocp1CommandResponseRequired(objDef->AddSubscriptionCommand(), handle).GetMemoryBlock());
-        //DBG(juce::String(__FUNCTION__) << " " << ProcessingEngineConfig::GetObjectTagName(activeObj._Id) << "("
-        //    << (first >= 0 ? (" first:" + juce::String(first)) : "")
-        //    << (second >= 0 ? (" second:" + juce::String(second)) : "")
-        //    << " handle:" << NanoOcp1::HandleToString(handle) << ")");
+    for (auto const& subscribedObj : subscribedObjects)
+    {
+        if (std::find(subscriptionObjects.begin(), subscriptionObjects.end(), subscribedObj) == subscriptionObjects.end())
+            success = UnsubscribeObject(subscribedObj) && success;
+    }
 
-        AddPendingSubscriptionHandle(handle);
+    for (auto const& subscriptionObj : subscriptionObjects)
+    {
+        if (std::find(subscribedObjects.begin(), subscribedObjects.end(), subscriptionObj) == subscribedObjects.end())
+        {
+            success = SubscribeObject(subscriptionObj) && success;
+            success = QueryObjectValue(subscriptionObj._Id, subscriptionObj._Addr) && success;
+        }
     }
 
     return success;
 }
 
 /**
- * @brief  Remove all subscriptions
- * @note	not implemented yet.
- * @returns True
+ * @brief  Send the subscribe command for a single remote object and track it as subscribed
+ * @details The command is only sent for the first subscribed object of a device object number,
+ *          and on a pooled connection only if no other processor already holds the subscription.
+ * @param[in]	object	The remote object to subscribe
+ * @returns				True if the subscribe command was sent sucessfully or was not required
  */
-bool OCP1ProtocolProcessor::DeleteObjectSubscriptions()
+bool OCP1ProtocolProcessor::SubscribeObject(const RemoteObject& object)
 {
-    return false;
+    auto handle = std::uint32_t(0);
+
+    // Get the object definition
+    auto objDefOpt = GetObjectDefinition(object._Id, object._Addr);
+
+    // Sanity checks
+    jassert(objDefOpt); // Missing implementation!
+    if (!objDefOpt)
+        return false;
+    auto& objDef = objDefOpt.value();
+    if (!objDef)
+        return false;
+
+    auto ONo = objDef->m_targetOno;
+    {
+        std::lock_guard<std::mutex> l(m_subscribedObjectsMutex);
+        if (std::find(m_subscribedObjects.begin(), m_subscribedObjects.end(), object) != m_subscribedObjects.end())
+            return true;
+
+        m_subscribedObjects.push_back(object);
+        if (++m_subscribedONoCounts[ONo] > 1)
+            return true;
+    }
+
+    // on a pooled connection, the subscription only is sent if no other processor already holds it
+    if (m_sharedConnection && !m_sharedConnection->AcquireSubscription(this, ONo))
+        return true;
+
+    auto addSubscriptionCommand = NanoOcp1::Ocp1CommandResponseRequired(objDef->AddSubscriptionCommand(), handle);
+    AddPendingSubscriptionHandle(handle);
+    auto success = SendOcp1Command(addSubscriptionCommand.GetMemoryBlock(), handle);
+    //DBG(juce::String(__FUNCTION__) << " " << ProcessingEngineConfig::GetObjectTagName(object._Id) << "("
+    //    << " addr:" << object._Addr.toString()
+    //    << " handle:" << NanoOcp1::HandleToString(handle) << ")");
+
+    if (!success)
+    {
+        // untrack the object again, to have the subscription retried on the next update
+        if (m_sharedConnection)
+            m_sharedConnection->ReleaseSubscription(this, ONo);
+
+        std::lock_guard<std::mutex> l(m_subscribedObjectsMutex);
+        m_subscribedObjects.erase(std::remove(m_subscribedObjects.begin(), m_subscribedObjects.end(), object), m_subscribedObjects.end());
+        if (--m_subscribedONoCounts[ONo] <= 0)
+            m_subscribedONoCounts.erase(ONo);
+    }
+
+    return success;
+}
+
+/**
+ * @brief  Send the remove subscription command for a single remote object and untrack it
+ * @details The command is only sent when the last subscribed object of a device object number is removed,
+ *          and on a pooled connection only if no other processor still requires the subscription.
+ * @param[in]	object	The remote object to unsubscribe
+ * @returns				True if the remove subscription command was sent sucessfully or was not required
+ */
+bool OCP1ProtocolProcessor::UnsubscribeObject(const RemoteObject& object)
+{
+    auto handle = std::uint32_t(0);
+
+    // Get the object definition
+    auto objDefOpt = GetObjectDefinition(object._Id, object._Addr);
+
+    // Sanity checks
+    jassert(objDefOpt); // Missing implementation!
+    if (!objDefOpt)
+        return false;
+    auto& objDef = objDefOpt.value();
+    if (!objDef)
+        return false;
+
+    auto ONo = objDef->m_targetOno;
+    {
+        std::lock_guard<std::mutex> l(m_subscribedObjectsMutex);
+        auto subscribedObjIter = std::find(m_subscribedObjects.begin(), m_subscribedObjects.end(), object);
+        if (subscribedObjIter == m_subscribedObjects.end())
+            return true;
+
+        m_subscribedObjects.erase(subscribedObjIter);
+        if (--m_subscribedONoCounts[ONo] > 0)
+            return true;
+        m_subscribedONoCounts.erase(ONo);
+    }
+
+    // on a pooled connection, the subscription only is removed if no other processor still requires it
+    if (m_sharedConnection && !m_sharedConnection->ReleaseSubscription(this, ONo))
+        return true;
+
+    // the reply to removing a subscription is handled the same way as the one to adding it
+    auto removeSubscriptionCommand = NanoOcp1::Ocp1CommandResponseRequired(objDef->RemoveSubscriptionCommand(), handle);
+    AddPendingSubscriptionHandle(handle);
+
+    return SendOcp1Command(removeSubscriptionCommand.GetMemoryBlock(), handle);
 }
 
 /**
@@ -1076,7 +1573,7 @@ bool OCP1ProtocolProcessor::DeleteObjectSubscriptions()
  */
 bool OCP1ProtocolProcessor::QueryObjectValues()
 {
-    if (!m_nanoOcp || !m_IsRunning)
+    if (!HasConnection() || !m_IsRunning)
         return false;
 
     auto success = true;
@@ -1111,11 +1608,11 @@ bool OCP1ProtocolProcessor::QueryObjectValue(const RemoteObjectIdentifier roi, c
     if (!objDef)
         return false;
 
-    // Send GetValue command
-    bool success = m_nanoOcp->sendData( NanoOcp1::Ocp1CommandResponseRequired(objDef->GetValueCommand(), handle).GetMemoryBlock());
+    // Send GetValue command, with the handle registered before, since the response may arrive before sending returns
+    auto getValueCommand = NanoOcp1::Ocp1CommandResponseRequired(objDef->GetValueCommand(), handle);
     AddPendingGetValueHandle(handle, objDef->m_targetOno);
     //DBG(juce::String(__FUNCTION__) + " " + ProcessingEngineConfig::GetObjectTagName(roi) + "(handle: " + NanoOcp1::HandleToString(handle) + ")");
-    return success;
+    return SendOcp1Command(getValueCommand.GetMemoryBlock(), handle);
 }
 
 void OCP1ProtocolProcessor::AddPendingSubscriptionHandle(const std::uint32_t handle)
@@ -1125,6 +1622,10 @@ void OCP1ProtocolProcessor::AddPendingSubscriptionHandle(const std::uint32_t han
     //DBG(juce::String(__FUNCTION__)
     //    << " (handle:" << NanoOcp1::HandleToString(handle) << ")");
     m_pendingSubscriptionHandles.push_back(handle);
+
+    // the pooled connection routes the response only to the processor that sent the command
+    if (m_sharedConnection)
+        m_sharedConnection->AddPendingResponseHandle(this, handle);
 }
 
 bool OCP1ProtocolProcessor::PopPendingSubscriptionHandle(const std::uint32_t handle)
@@ -1156,6 +1657,10 @@ void OCP1ProtocolProcessor::AddPendingGetValueHandle(const std::uint32_t handle,
     //    << " (handle:" << NanoOcp1::HandleToString(handle)
     //    << ", targetONo:0x" << juce::String::toHexString(ONo) << ")");
     m_pendingGetValueHandlesWithONo.insert(std::make_pair(handle, ONo));
+
+    // the pooled connection routes the response only to the processor that sent the command
+    if (m_sharedConnection)
+        m_sharedConnection->AddPendingResponseHandle(this, handle);
 }
 
 const std::uint32_t OCP1ProtocolProcessor::PopPendingGetValueHandle(const std::uint32_t handle)
@@ -1191,6 +1696,10 @@ void OCP1ProtocolProcessor::AddPendingSetValueHandle(const std::uint32_t handle,
     //    << " (handle:" << NanoOcp1::HandleToString(handle)
     //    << ", targetONo:0x" << juce::String::toHexString(ONo) << ")");
     m_pendingSetValueHandlesWithONo.insert(std::make_pair(handle, std::make_pair(ONo, externalId)));
+
+    // the pooled connection routes the response only to the processor that sent the command
+    if (m_sharedConnection)
+        m_sharedConnection->AddPendingResponseHandle(this, handle);
 }
 
 const std::uint32_t OCP1ProtocolProcessor::PopPendingSetValueHandle(const std::uint32_t handle, int& externalId)
@@ -1279,8 +1788,8 @@ bool OCP1ProtocolProcessor::UpdateObjectValue(const std::uint32_t ONo, NanoOcp1:
 
 bool OCP1ProtocolProcessor::UpdateObjectValue(const RemoteObjectIdentifier roi, NanoOcp1::Ocp1Message* msgObj, const std::pair<std::pair<std::int32_t, std::int32_t>, NanoOcp1::Ocp1CommandDefinition>& objectDetails)
 {
-    auto objAddr = objectDetails.first;
-    auto cmdDef = objectDetails.second;
+    auto const& objAddr = objectDetails.first;
+    auto const& cmdDef = objectDetails.second;
 
     //DBG(juce::String(__FUNCTION__)
     //    << " (targetONo:0x" << juce::String::toHexString(cmdDef.m_targetOno) << ")");
@@ -1288,7 +1797,11 @@ bool OCP1ProtocolProcessor::UpdateObjectValue(const RemoteObjectIdentifier roi,
     auto remObjMsgData = RemoteObjectMessageData();
     remObjMsgData._addrVal = RemoteObjectAddressing(objAddr.first, objAddr.second);
 
-    auto objectsDataToForward = std::map<RemoteObjectIdentifier, RemoteObjectMessageData>();
+    // The objects to forward refer to the stack value buffers below instead of owning payload copies,
+    // to not require a forwarding map or payload allocations per notification. Four entries are needed at most (position xyz, xy, x, y).
+    // Decoding the parameter data with NanoOcp (e.g. Variant::ToPosition) still allocates, as does the NanoOcp message unmarshalling before.
+    std::array<std::pair<RemoteObjectIdentifier, RemoteObjectMessageData>, 4> objectsDataToForward;
+    auto objectsDataToForwardCount = std::size_t(0);
     
     int newIntValue[3];
     float newFloatValue[6];
@@ -1315,11 +1828,11 @@ bool OCP1ProtocolProcessor::UpdateObjectValue(const RemoteObjectIdentifier roi,
             //    << " (" << static_cast<int>(objAddr.first) << "," << static_cast<int>(objAddr.second) << ") " 
             //    << newFloatValue[0] << "," << newFloatValue[1] << "," << newFloatValue[2] << ";");
 
-            objectsDataToForward[ROI_CoordinateMapping_SourcePosition].payloadCopy(RemoteObjectMessageData(remObjMsgData._addrVal, ROVT_FLOAT, 3, &newFloatValue, 3 * sizeof(float)));
-            objectsDataToForward[ROI_CoordinateMapping_SourcePosition_XY].payloadCopy(RemoteObjectMessageData(remObjMsgData._addrVal, ROVT_FLOAT, 2, &newFloatValue, 2 * sizeof(float)));
-            objectsDataToForward[ROI_CoordinateMapping_SourcePosition_X].payloadCopy(RemoteObjectMessageData(remObjMsgData._addrVal, ROVT_FLOAT, 1, &newFloatValue, sizeof(float)));
-            newFloatValue[0] = newFloatValue[1]; // hacky bit - move the y value to the first (x) position to be able to reuse the newFloatValue array for Y forwarding
-            objectsDataToForward[ROI_CoordinateMapping_SourcePosition_Y] = RemoteObjectMessageData(remObjMsgData._addrVal, ROVT_FLOAT, 1, &newFloatValue, sizeof(float));
+            // forwarding order follows the ROI enum order, as previously given by the ordered map
+            objectsDataToForward[objectsDataToForwardCount++] = std::make_pair(ROI_CoordinateMapping_SourcePosition_XY, RemoteObjectMessageData(remObjMsgData._addrVal, ROVT_FLOAT, 2, &newFloatValue[0], 2 * sizeof(float)));
+            objectsDataToForward[objectsDataToForwardCount++] = std::make_pair(ROI_CoordinateMapping_SourcePosition_X, RemoteObjectMessageData(remObjMsgData._addrVal, ROVT_FLOAT, 1, &newFloatValue[0], sizeof(float)));
+            objectsDataToForward[objectsDataToForwardCount++] = std::make_pair(ROI_CoordinateMapping_SourcePosition_Y, RemoteObjectMessageData(remObjMsgData._addrVal, ROVT_FLOAT, 1, &newFloatValue[1], sizeof(float)));
+            objectsDataToForward[objectsDataToForwardCount++] = std::make_pair(ROI_CoordinateMapping_SourcePosition, remObjMsgData);
         }
         break;
     case ROI_Positioning_SpeakerPosition:
@@ -1345,7 +1858,7 @@ bool OCP1ProtocolProcessor::UpdateObjectValue(const RemoteObjectIdentifier roi,
             //    << newFloatValue[0] << "," << newFloatValue[1] << "," << newFloatValue[2] << ","
             //    << newFloatValue[3] << "," << newFloatValue[4] << "," << newFloatValue[5] << ";");
 
-            objectsDataToForward.insert(std::make_pair(roi, remObjMsgData));
+            objectsDataToForward[objectsDataToForwardCount++] = std::make_pair(roi, remObjMsgData);
         }
         break;
     case ROI_Positioning_SourcePosition:
@@ -1367,11 +1880,11 @@ bool OCP1ProtocolProcessor::UpdateObjectValue(const RemoteObjectIdentifier roi,
             //    << " (" << static_cast<int>(objAddr.first) << "," << static_cast<int>(objAddr.second) << ") "
             //    << newFloatValue[0] << "," << newFloatValue[1] << "," << newFloatValue[2] << ";");
 
-            objectsDataToForward[ROI_Positioning_SourcePosition].payloadCopy(RemoteObjectMessageData(remObjMsgData._addrVal, ROVT_FLOAT, 3, &newFloatValue, 3 * sizeof(float)));
-            objectsDataToForward[ROI_Positioning_SourcePosition_XY].payloadCopy(RemoteObjectMessageData(remObjMsgData._addrVal, ROVT_FLOAT, 2, &newFloatValue, 2 * sizeof(float)));
-            objectsDataToForward[ROI_Positioning_SourcePosition_X].payloadCopy(RemoteObjectMessageData(remObjMsgData._addrVal, ROVT_FLOAT, 1, &newFloatValue, sizeof(float)));
-            newFloatValue[0] = newFloatValue[1]; // hacky bit - move the y value to the first (x) position to be able to reuse the newFloatValue array for Y forwarding
-            objectsDataToForward[ROI_Positioning_SourcePosition_Y] = RemoteObjectMessageData(remObjMsgData._addrVal, ROVT_FLOAT, 1, &newFloatValue, sizeof(float));
+            // forwarding order follows the ROI enum order, as previously given by the ordered map
+            objectsDataToForward[objectsDataToForwardCount++] = std::make_pair(ROI_Positioning_SourcePosition_XY, RemoteObjectMessageData(remObjMsgData._addrVal, ROVT_FLOAT, 2, &newFloatValue[0], 2 * sizeof(float)));
+            objectsDataToForward[objectsDataToForwardCount++] = std::make_pair(ROI_Positioning_SourcePosition_X, RemoteObjectMessageData(remObjMsgData._addrVal, ROVT_FLOAT, 1, &newFloatValue[0], sizeof(float)));
+            objectsDataToForward[objectsDataToForwardCount++] = std::make_pair(ROI_Positioning_SourcePosition_Y, RemoteObjectMessageData(remObjMsgData._addrVal, ROVT_FLOAT, 1, &newFloatValue[1], sizeof(float)));
+            objectsDataToForward[objectsDataToForwardCount++] = std::make_pair(ROI_Positioning_SourcePosition, remObjMsgData);
         }
         break;
     // OcaInt32Sensor / OcaInt32Actuator
@@ -1384,7 +1897,7 @@ bool OCP1ProtocolProcessor::UpdateObjectValue(const RemoteObjectIdentifier roi,
             remObjMsgData._valType = ROVT_INT;
             remObjMsgData._payload = &newIntValue;
 
-            objectsDataToForward.insert(std::make_pair(roi, remObjMsgData));
+            objectsDataToForward[objectsDataToForwardCount++] = std::make_pair(roi, remObjMsgData);
         }
         break;
     // OcaBoolean
@@ -1397,7 +1910,7 @@ bool OCP1ProtocolProcessor::UpdateObjectValue(const RemoteObjectIdentifier roi,
             remObjMsgData._valType = ROVT_INT;
             remObjMsgData._payload = &newIntValue;
 
-            objectsDataToForward.insert(std::make_pair(roi, remObjMsgData));
+            objectsDataToForward[objectsDataToForwardCount++] = std::make_pair(roi, remObjMsgData);
         }
         break;
     // OcaPolarity
@@ -1412,7 +1925,7 @@ bool OCP1ProtocolProcessor::UpdateObjectValue(const RemoteObjectIdentifier roi,
             remObjMsgData._valType = ROVT_INT;
             remObjMsgData._payload = &newIntValue;
 
-            objectsDataToForward.insert(std::make_pair(roi, remObjMsgData));
+            objectsDataToForward[objectsDataToForwardCount++] = std::make_pair(roi, remObjMsgData);
         }
         break;
     // OcaSwitch
@@ -1434,7 +1947,7 @@ bool OCP1ProtocolProcessor::UpdateObjectValue(const RemoteObjectIdentifier roi,
             remObjMsgData._valType = ROVT_INT;
             remObjMsgData._payload = &newIntValue;
 
-            objectsDataToForward.insert(std::make_pair(roi, remObjMsgData));
+            objectsDataToForward[objectsDataToForwardCount++] = std::make_pair(roi, remObjMsgData);
         }
         break;
     // OcaMute
@@ -1462,7 +1975,7 @@ bool OCP1ProtocolProcessor::UpdateObjectValue(const RemoteObjectIdentifier roi,
             remObjMsgData._valType = ROVT_INT;
             remObjMsgData._payload = &newIntValue;
 
-            objectsDataToForward.insert(std::make_pair(roi, remObjMsgData));
+            objectsDataToForward[objectsDataToForwardCount++] = std::make_pair(roi, remObjMsgData);
         }
         break;
     // OcaFloat32Sensor / OcaFloat32Actuator
@@ -1478,7 +1991,7 @@ bool OCP1ProtocolProcessor::UpdateObjectValue(const RemoteObjectIdentifier roi,
             remObjMsgData._valType = ROVT_FLOAT;
             remObjMsgData._payload = &newFloatValue;
 
-            objectsDataToForward.insert(std::make_pair(roi, remObjMsgData));
+            objectsDataToForward[objectsDataToForwardCount++] = std::make_pair(roi, remObjMsgData);
         }
         break;
     case ROI_MatrixNode_Gain:
@@ -1505,7 +2018,7 @@ bool OCP1ProtocolProcessor::UpdateObjectValue(const RemoteObjectIdentifier roi,
             remObjMsgData._valType = ROVT_FLOAT;
             remObjMsgData._payload = &newFloatValue;
 
-            objectsDataToForward.insert(std::make_pair(roi, remObjMsgData));
+            objectsDataToForward[objectsDataToForwardCount++] = std::make_pair(roi, remObjMsgData);
         }
         break;
     // OcaStringSensor / OcaStringActuator
@@ -1527,7 +2040,7 @@ bool OCP1ProtocolProcessor::UpdateObjectValue(const RemoteObjectIdentifier roi,
             remObjMsgData._valType = ROVT_STRING;
             remObjMsgData._payload = newStringValue.getCharPointer().getAddress();
 
-            objectsDataToForward.insert(std::make_pair(roi, remObjMsgData));
+            objectsDataToForward[objectsDataToForwardCount++] = std::make_pair(roi, remObjMsgData);
         }
         break;
     // dbOcaPositionAgentDeprecated
@@ -1554,7 +2067,7 @@ bool OCP1ProtocolProcessor::UpdateObjectValue(const RemoteObjectIdentifier roi,
             //    << " (" << static_cast<int>(objAddr.first) << "," << static_cast<int>(objAddr.second) << ") " 
             //    << newFloatValue[0] << "," << newFloatValue[1] << "," << newFloatValue[2] << ";");
 
-            objectsDataToForward.insert(std::make_pair(roi, remObjMsgData));
+            objectsDataToForward[objectsDataToForwardCount++] = std::make_pair(roi, remObjMsgData);
         }
         break;
     default:
@@ -1563,15 +2076,16 @@ bool OCP1ProtocolProcessor::UpdateObjectValue(const RemoteObjectIdentifier roi,
         return false;
     }
 
-    for (auto const& objData : objectsDataToForward)
-        GetValueCache().SetValue(RemoteObject(objData.first, objData.second._addrVal), objData.second);
+    for (auto i = std::size_t(0); i < objectsDataToForwardCount; i++)
+        GetValueCache().SetValue(RemoteObject(objectsDataToForward[i].first, objectsDataToForward[i].second._addrVal), objectsDataToForward[i].second);
 
     if (m_messageListener)
     {
         auto SetValueReplyInfo = HasPendingSetValue(cmdDef.m_targetOno);
 
-        for (auto const& objData : objectsDataToForward)
+        for (auto i = std::size_t(0); i < objectsDataToForwardCount; i++)
         {
+            auto const& objData = objectsDataToForward[i];
 #ifdef DEBUG
             auto msgMetaInfo = RemoteObjectMessageMetaInfo();
             if (SetValueReplyInfo)
@@ -1598,11 +2112,58 @@ bool OCP1ProtocolProcessor::UpdateObjectValue(const RemoteObjectIdentifier roi,
         return false;
 }
 
+/**
+ * @brief  Helper to get the list of remote objects that shall be subscribed on the device
+ * @details In default mode this equals the supported active objects. In on demand mode,
+ *          separate x and y position objects that are handled by other protocols
+ *          are mapped to the combined position object, since that is the one the device notifies.
+ * @returns The list of remote objects to subscribe, without duplicates
+ */
+const std::vector<RemoteObject> OCP1ProtocolProcessor::GetOcp1SubscriptionRemoteObjects()
+{
+    if (!m_subscribeOnDemand)
+        return GetOcp1SupportedActiveRemoteObjects();
+
+    auto subscriptionObjects = std::vector<RemoteObject>();
+
+    for (auto activeObj : GetRemoteObjectsActive())
+    {
+        switch (activeObj._Id)
+        {
+        case ROI_CoordinateMapping_SourcePosition_XY:
+        case ROI_CoordinateMapping_SourcePosition_X:
+        case ROI_CoordinateMapping_SourcePosition_Y:
+            activeObj._Id = ROI_CoordinateMapping_SourcePosition;
+            break;
+        case ROI_Positioning_SourcePosition_XY:
+        case ROI_Positioning_SourcePosition_X:
+        case ROI_Positioning_SourcePosition_Y:
+            activeObj._Id = ROI_Positioning_SourcePosition;
+            break;
+        case ROI_HeartbeatPing:
+        case ROI_HeartbeatPong:
+            continue;
+        default:
+            break;
+        }
+
+        // skip objects that are muted or cannot be resolved to an ocp1 object definition
+        if (IsRemoteObjectMuted(activeObj) || !GetObjectDefinition(activeObj._Id, activeObj._Addr))
+            continue;
+
+        if (std::find(subscriptionObjects.begin(), subscriptionObjects.end(), activeObj) == subscriptionObjects.end())
+            subscriptionObjects.push_back(activeObj);
+    }
+
+    return subscriptionObjects;
+}
+
 const std::vector<RemoteObject> OCP1ProtocolProcessor::GetOcp1SupportedActiveRemoteObjects()
 {
     auto ocp1SupportedActiveObjects = std::vector<RemoteObject>();
 
-    for (auto const& activeObj : GetActiveRemoteObjects())
+    auto activeObjects = GetActiveRemoteObjects();
+    for (auto const& activeObj : activeObjects->GetObjects())
     {
         //auto& second = activeObj._Addr._first;
         //auto& first = activeObj._Addr._second;
@@ -20,6 +20,7 @@
 
 #include "../../../RemoteProtocolBridgeCommon.h"
 #include "../NetworkProtocolProcessorBase.h"
+#include "OCP1ConnectionPool.h"
 
 #include <Variant.h>
 
@@ -44,10 +45,11 @@ namespace NanoOcp1
  * This currently is only a dummy for potential future functionality.
  * Feel free to implement something yourself here.
  */
-class OCP1ProtocolProcessor : public NetworkProtocolProcessorBase
+class OCP1ProtocolProcessor : public NetworkProtocolProcessorBase,
+	public OCP1SharedConnection::Listener
 {
 public:
-	OCP1ProtocolProcessor(const NodeId& parentNodeId);
+	OCP1ProtocolProcessor(const NodeId& parentNodeId, OCP1ConnectionPool* connectionPool = nullptr);
 	~OCP1ProtocolProcessor();
 
 	//==============================================================================
@@ -61,23 +63,55 @@ public:
 	bool PreparePositionMessageData(const RemoteObject& targetObj, RemoteObjectMessageData& msgDataToSet);
 	bool SendRemoteObjectMessage(const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, const int externalId = -1) override;
 
+	//==============================================================================
+	bool IsSubscribingOnDemand();
+	void SetOnDemandObjects(const std::vector<RemoteObject>& objects);
+
+	//==============================================================================
+	bool OnSharedConnectionMessageReceived(NanoOcp1::Ocp1Message* msgObj) override;
+	void OnSharedConnectionEstablished() override;
+	void OnSharedConnectionLost() override;
+
+protected:
+	//==============================================================================
+	void OnRemoteObjectsActiveChanged() override;
+
 private:
 	//==============================================================================
 	void timerThreadCallback() override;
+	int GetTimerThreadInterval() override;
 
 	//==============================================================================
 	void CreateKnownONosMap();
 
+	//==============================================================================
+	void ConnectionEstablished();
+	void ConnectionLost();
+	bool HasConnection();
+	bool SendOcp1Data(const juce::MemoryBlock& data);
+	bool SendOcp1Command(const juce::MemoryBlock& data, const std::uint32_t handle);
+
 	//==============================================================================
 	bool ocp1MessageReceived(const juce::MemoryBlock& data);
+	bool ocp1MessageReceived(NanoOcp1::Ocp1Message* msgObj);
 	std::optional<std::unique_ptr<NanoOcp1::Ocp1CommandDefinition>> GetObjectDefinition(const RemoteObjectIdentifier& roi, const RemoteObjectAddressing& addr, bool useDefinitionRemapping = false);
 	bool CreateObjectSubscriptions();
 	bool DeleteObjectSubscriptions();
+	bool UpdateObjectSubscriptions();
+	bool SubscribeObject(const RemoteObject& object);
+	bool UnsubscribeObject(const RemoteObject& object);
 	bool QueryObjectValues();
 	bool QueryObjectValue(const RemoteObjectIdentifier roi, const RemoteObjectAddressing& addr);
 
+	//==============================================================================
+	void RequestObjectOnDemand(const RemoteObject& object);
+	void ExpireOnDemandObjects();
+	void ApplyOnDemandActiveObjects();
+	void UpdateOnDemandKeptObjects();
+
 	//==============================================================================
 	const std::vector<RemoteObject> GetOcp1SupportedActiveRemoteObjects();
+	const std::vector<RemoteObject> GetOcp1SubscriptionRemoteObjects();
 
 	//==============================================================================
 	void AddPendingSubscriptionHandle(const std::uint32_t handle);
@@ -105,12 +139,33 @@ private:
 		const std::pair<std::pair<RecordId, ChannelId>, NanoOcp1::Ocp1CommandDefinition>& objectDetails);
 
 	//==============================================================================
-	std::unique_ptr<NanoOcp1::NanoOcp1Base>					m_nanoOcp;
+	std::unique_ptr<NanoOcp1::NanoOcp1Base>					m_nanoOcp;				/**< The private connection, used in server and client connection mode. */
+	OCP1ConnectionPool*										m_connectionPool;		/**< The engine owned pool of connections, if any. */
+	std::shared_ptr<OCP1SharedConnection>					m_sharedConnection;		/**< The pooled connection to the device, used in sharedclient connection mode. */
     std::mutex                                              m_pendingHandlesMutex;
 	std::vector<std::uint32_t>								m_pendingSubscriptionHandles;
 	std::map<std::uint32_t, std::uint32_t>					m_pendingGetValueHandlesWithONo;
 	std::map<std::uint32_t, std::pair<std::uint32_t, int>>	m_pendingSetValueHandlesWithONo;
 
+	//==============================================================================
+	bool													m_subscribeOnDemand{ false };	/**< Indicator if subscriptions are maintained incrementally from the current active objects instead of all at once on connect. */
+	std::mutex												m_subscribedObjectsMutex;
+	std::vector<RemoteObject>								m_subscribedObjects;			/**< The objects that currently are subscribed on the device. */
+	std::map<std::uint32_t, int>							m_subscribedONoCounts;			/**< The number of subscribed objects per device object number, since several objects can share one (e.g. x and y position). */
+
+	static constexpr std::uint32_t s_onDemandRequestTimeout = 30000;	/**< The time in ms after which an object that was requested on demand is unsubscribed if it was not requested again. */
+	static constexpr int s_maxOnDemandRequestedObjects = 1024;			/**< The maximum number of objects requested on demand, the least recently requested one is dropped for a new one beyond. */
+
+	CriticalSection											m_onDemandObjectsLock;			/**< Lock to guard the on demand objects, that are requested from the sending threads and expired from the timer thread. */
+	CriticalSection											m_onDemandApplyLock;			/**< Lock to serialize applying the on demand objects, which sends the subscription changes and therefor is done without holding m_onDemandObjectsLock. */
+	int														m_onDemandObjectsVersion{ 0 };	/**< The version of the on demand objects, increased with every change of them. */
+	int														m_onDemandAppliedVersion{ 0 };	/**< The version of the on demand objects that was last applied as active objects. */
+	std::shared_ptr<const RemoteObjectSet>					m_onDemandKeptObjects;			/**< The configured and derived objects, that are active regardless of being requested, to check sent objects against without locking. */
+	std::vector<RemoteObject>								m_configuredActiveObjects;		/**< The active objects configured for this protocol itself. */
+	std::vector<RemoteObject>								m_onDemandDerivedObjects;		/**< The active objects derived from the protocols of the opposite role by the parent node. */
+	std::map<RemoteObject, std::uint32_t>					m_onDemandRequestedObjects;		/**< The objects requested through messages to this protocol at runtime, with the time in ms they were last requested at. */
+	std::atomic<int>										m_onDemandRequestedCount{ 0 };	/**< The number of objects requested at runtime, to skip taking the lock for objects that are active anyway if there are none. */
+
 	//==============================================================================
 	std::map<RemoteObjectIdentifier, std::map<std::pair<RecordId, ChannelId>, NanoOcp1::Ocp1CommandDefinition>>	m_ROIsToDefsMap;
 
@@ -81,7 +81,7 @@ bool OSCProtocolProcessor::Start()
 	jassert(successR);
 
 	// start the send timer thread
-	startTimerThread(GetActiveRemoteObjectsInterval(), 100);
+	startTimerThread(GetTimerThreadInterval(), 100);
 
 	m_IsRunning = (successS && successR);
 
@@ -191,6 +191,56 @@ bool OSCProtocolProcessor::SendRemoteObjectMessage(const RemoteObjectIdentifier
 	return SendAddressedMessage(addressString, msgData);
 }
 
+/**
+ * Reimplemented to send several messages that belong together as one OSC bundle.
+ * The messages are assembled through SendRemoteObjectMessage as usual, so derived protocol
+ * addressing is applied, but collected into the bundle instead of being sent right away.
+ *
+ * @param rois			The ids of the objects to send a message for
+ * @param msgData		The message payloads and metadata, one per object id
+ * @param messageCount	The number of messages to send
+ * @param externalId	An optional external id for identification of replies, etc.
+ * @return	True if all messages were assembled and the bundle was sent successfully, false if not
+ */
+bool OSCProtocolProcessor::SendRemoteObjectMessages(const RemoteObjectIdentifier* rois, const RemoteObjectMessageData* msgData, int messageCount, const int externalId)
+{
+	if (messageCount <= 1)
+		return ProtocolProcessorBase::SendRemoteObjectMessages(rois, msgData, messageCount, externalId);
+
+	const ScopedLock l(m_bundleCollectionLock);
+
+	// only messages assembled by this thread are collected, others are sent as usual
+	OSCBundle bundle;
+	m_collectingBundle = &bundle;
+	m_collectingBundleThreadId.store(Thread::getCurrentThreadId());
+
+	auto collectSuccess = ProtocolProcessorBase::SendRemoteObjectMessages(rois, msgData, messageCount, externalId);
+
+	m_collectingBundleThreadId.store(nullptr);
+	m_collectingBundle = nullptr;
+
+	if (bundle.size() == 0)
+		return collectSuccess;
+
+	return m_oscSender.send(bundle) && collectSuccess;
+}
+
+/**
+ * Helper method to send a message, or to add it to the bundle currently being collected by the calling thread.
+ * @param message	The message to send
+ * @return	True on success, false on failure
+ */
+bool OSCProtocolProcessor::SendOrCollectMessage(const OSCMessage& message)
+{
+	if (m_collectingBundleThreadId.load() == Thread::getCurrentThreadId() && nullptr != m_collectingBundle)
+	{
+		m_collectingBundle->addElement(OSCBundle::Element(message));
+		return true;
+	}
+
+	return m_oscSender.send(message);
+}
+
 /**
  * Method to create and send a message with a given address string and data value(s) based on the
  * contents of given msg data struct.
@@ -256,13 +306,13 @@ bool OSCProtocolProcessor::SendAddressedMessage(const String& addressString, con
 			multivalues[i] = ((int*)msgData._payload)[i];
 
 		if (msgData._valCount == 1)
-			sendSuccess = m_oscSender.send(OSCMessage(addressString, multivalues[0]));
+			sendSuccess = SendOrCollectMessage(OSCMessage(addressString, multivalues[0]));
 		else if (msgData._valCount == 2)
-			sendSuccess = m_oscSender.send(OSCMessage(addressString, multivalues[0], multivalues[1]));
+			sendSuccess = SendOrCollectMessage(OSCMessage(addressString, multivalues[0], multivalues[1]));
 		else if (msgData._valCount == 3)
-			sendSuccess = m_oscSender.send(OSCMessage(addressString, multivalues[0], multivalues[1], multivalues[2]));
+			sendSuccess = SendOrCollectMessage(OSCMessage(addressString, multivalues[0], multivalues[1], multivalues[2]));
 		else
-			sendSuccess = m_oscSender.send(OSCMessage(addressString));
+			sendSuccess = SendOrCollectMessage(OSCMessage(addressString));
 		}
 		break;
 	case ROVT_FLOAT:
@@ -274,22 +324,22 @@ bool OSCProtocolProcessor::SendAddressedMessage(const String& addressString, con
 			multivalues[i] = ((float*)msgData._payload)[i];
 
 		if (msgData._valCount == 1)
-			sendSuccess = m_oscSender.send(OSCMessage(addressString, multivalues[0]));
+			sendSuccess = SendOrCollectMessage(OSCMessage(addressString, multivalues[0]));
 		else if (msgData._valCount == 2)
-			sendSuccess = m_oscSender.send(OSCMessage(addressString, multivalues[0], multivalues[1]));
+			sendSuccess = SendOrCollectMessage(OSCMessage(addressString, multivalues[0], multivalues[1]));
 		else if (msgData._valCount == 3)
-			sendSuccess = m_oscSender.send(OSCMessage(addressString, multivalues[0], multivalues[1], multivalues[2]));
+			sendSuccess = SendOrCollectMessage(OSCMessage(addressString, multivalues[0], multivalues[1], multivalues[2]));
 		else if (msgData._valCount == 6)
-			sendSuccess = m_oscSender.send(OSCMessage(addressString, multivalues[0], multivalues[1], multivalues[2], multivalues[3], multivalues[4], multivalues[5]));
+			sendSuccess = SendOrCollectMessage(OSCMessage(addressString, multivalues[0], multivalues[1], multivalues[2], multivalues[3], multivalues[4], multivalues[5]));
 		else
-			sendSuccess = m_oscSender.send(OSCMessage(addressString));
+			sendSuccess = SendOrCollectMessage(OSCMessage(addressString));
 		}
 		break;
 	case ROVT_STRING:
-		sendSuccess = m_oscSender.send(OSCMessage(addressString, String(static_cast<char*>(msgData._payload), msgData._payloadSize)));
+		sendSuccess = SendOrCollectMessage(OSCMessage(addressString, String(static_cast<char*>(msgData._payload), msgData._payloadSize)));
 		break;
 	case ROVT_NONE:
-		sendSuccess = m_oscSender.send(OSCMessage(addressString));
+		sendSuccess = SendOrCollectMessage(OSCMessage(addressString));
 		break;
 	default:
 		break;
@@ -388,6 +438,10 @@ void OSCProtocolProcessor::oscMessageReceived(const OSCMessage &message, const S
 			}
 		}
 
+		// The cached values query is no bridging object, but handled by the object data handling of the parent node.
+		if (ROI_Invalid == newObjectId && addressString.containsWholeWord(GetRemoteObjectString(ROI_RemoteProtocolBridge_GetAllKnownValues)))
+			newObjectId = ROI_RemoteProtocolBridge_GetAllKnownValues;
+
 		if (ProcessingEngineConfig::IsChannelAddressingObject(newObjectId))
 		{
 			// Parse the Channel ID
@@ -725,7 +779,8 @@ bool OSCProtocolProcessor::createMessageData(const OSCMessage& messageInput, con
 		case ROI_Scene_Next:
 			return true;
 		case ROI_RemoteProtocolBridge_GetAllKnownValues:
-			break;
+			// the query optionally carries the version replied to the last query, to only get the values changed since
+			return messageInput.size() == 0 || createIntMessageData(messageInput, newMessageData);
 		default:
 			jassertfalse;
 			break;
@@ -59,6 +59,7 @@ public:
 	bool Stop() override;
 
 	bool SendRemoteObjectMessage(const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, const int externalId = -1) override;
+	bool SendRemoteObjectMessages(const RemoteObjectIdentifier* rois, const RemoteObjectMessageData* msgData, int messageCount, const int externalId = -1) override;
 
 	bool SendAddressedMessage(const String& addressString, const RemoteObjectMessageData& msgData);
 
@@ -80,6 +81,7 @@ protected:
 	bool createStringMessageData(const OSCMessage& messageInput, RemoteObjectMessageData& newMessageData);
     
     bool connectSenderIfRequired();
+	bool SendOrCollectMessage(const OSCMessage& message);
 
 	OSCSender								m_oscSender;					/**< An OSCSender object can connect to a network port. It then can send OSC
 																			 * messages and bundles to a specified host over an UDP socket. */
@@ -97,5 +99,9 @@ private:
     bool            m_clientConnectionParamsChanged{ false };
 	bool			m_dataSendindDisabled{ false };	/**< Bool flag to indicate if incoming message send requests from bridging node shall be ignored. */
 
+	CriticalSection						m_bundleCollectionLock;					/**< Lock to only collect one bundle at a time. */
+	OSCBundle*							m_collectingBundle{ nullptr };			/**< The bundle messages are currently collected into instead of being sent. */
+	std::atomic<Thread::ThreadID>		m_collectingBundleThreadId{ nullptr };	/**< The thread that collects messages into the bundle, messages from other threads are sent as usual. */
+
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OSCProtocolProcessor)
 };
@@ -122,7 +122,8 @@ bool RemapOSCProtocolProcessor::SendRemoteObjectMessage(RemoteObjectIdentifier r
 	if (!remapRange.isEmpty())
 	{
 		RemoteObjectMessageData remappedData;
-		if (!MapMessageDataToTargetRangeAndType(msgData, ProcessingEngineConfig::GetRemoteObjectRange(roid), remapRange, RemoteObjectValueType::ROVT_NONE, remappedData))
+		MappedPayloadBuffer remappedPayload;
+		if (!MapMessageDataToTargetRangeAndType(msgData, ProcessingEngineConfig::GetRemoteObjectRange(roid), remapRange, msgData._valType, remappedData, remappedPayload))
 			return false;
 		else
 			return SendAddressedMessage(addressString, remappedData);
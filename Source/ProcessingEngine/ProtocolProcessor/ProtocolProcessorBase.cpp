@@ -66,8 +66,12 @@ ProtocolProcessorBase::ProtocolProcessorBase(const NodeId& parentNodeId)
 	  m_protocolProcessorId(0),
 	  m_protocolProcessorRole(ProtocolRole::PR_Invalid),
       m_IsRunning(false),
+      m_mutedRemoteObjects(std::make_shared<const RemoteObjectSet>()),
+      m_activeRemoteObjects(std::make_shared<const RemoteObjectSet>()),
       m_activeRemoteObjectsInterval(ET_DefaultPollingRate)
 {
+	m_pollingRois.reserve(s_maxPollingBatchSize);
+	m_pollingMsgData.reserve(s_maxPollingBatchSize);
 }
 
 /**
@@ -87,6 +91,26 @@ RemoteObjectValueCache& ProtocolProcessorBase::GetValueCache()
 	return m_valueCache;
 }
 
+/**
+ * Method to trigger sending of several messages that belong together.
+ * This default implementation sends them one by one, protocols that are able to
+ * transport several messages in one packet can reimplement this to do so.
+ *
+ * @param rois			The ids of the objects to send a message for
+ * @param msgData		The message payloads and metadata, one per object id
+ * @param messageCount	The number of messages to send
+ * @param externalId	An optional external id for identification of replies, etc.
+ * @return	True if all messages were sent successfully, false if not
+ */
+bool ProtocolProcessorBase::SendRemoteObjectMessages(const RemoteObjectIdentifier* rois, const RemoteObjectMessageData* msgData, int messageCount, const int externalId)
+{
+	auto sendSuccess = true;
+	for (auto i = 0; i < messageCount; i++)
+		sendSuccess = SendRemoteObjectMessage(rois[i], msgData[i], externalId) && sendSuccess;
+
+	return sendSuccess;
+}
+
 /**
  * Sets the message listener object to be used for callback on message received.
  *
@@ -133,10 +157,20 @@ bool ProtocolProcessorBase::setStateXml(XmlElement* stateXml)
 		else
 			return false;
 
-		// special handling for heartbeats - this shall always be activated if active object usage is set to true
-		m_activeRemoteObjects.push_back(RemoteObject(ROI_HeartbeatPing, RemoteObjectAddressing()));
+		// special handling for heartbeats - this shall always be activated if active object usage is set to true.
+		// The set is exchanged only if it was not replaced meanwhile, e.g. by the parent node, otherwise the heartbeat is added to the new one.
+		auto heartbeatObject = RemoteObject(ROI_HeartbeatPing, RemoteObjectAddressing());
+		auto currentActiveObjects = GetActiveRemoteObjects();
+		while (!currentActiveObjects->Contains(heartbeatObject))
+		{
+			auto activeObjects = currentActiveObjects->GetObjects();
+			activeObjects.push_back(heartbeatObject);
+			auto newActiveObjects = std::shared_ptr<const RemoteObjectSet>(std::make_shared<const RemoteObjectSet>(activeObjects));
+			if (std::atomic_compare_exchange_strong(&m_activeRemoteObjects, &currentActiveObjects, newActiveObjects))
+				break;
+		}
 		if (!isTimerThreadRunning() && m_activeRemoteObjectsInterval > 0)
-			startTimerThread(m_activeRemoteObjectsInterval);
+			startTimerThread(GetTimerThreadInterval());
 	}
 
 	auto mutedObjsXmlElement = stateXml->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::MUTEDOBJECTS));
@@ -164,6 +198,26 @@ int ProtocolProcessorBase::GetActiveRemoteObjectsInterval()
 	return m_activeRemoteObjectsInterval;
 }
 
+/**
+ * Method to be called for every message received by the processor, to let the
+ * polling intervals of active objects adapt to how often their values change.
+ * @param	roi		The id of the object the message was received for.
+ * @param	msgData	The received message data.
+ */
+void ProtocolProcessorBase::OnRemoteObjectValueReceived(const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData)
+{
+	m_activeObjectsPoller.OnValueReceived(roi, msgData);
+}
+
+/**
+ * Getter for the effective polling rates of the active objects.
+ * @return	The polling budget, the current overall polling rate and the current polling rate per active object.
+ */
+ActiveObjectsPoller::Statistics ProtocolProcessorBase::GetPollingStatistics() const
+{
+	return m_activeObjectsPoller.GetStatistics();
+}
+
 /**
  * Setter for remote object to specifically activate.
  * For OSC processing this is used to activate internal polling
@@ -175,21 +229,34 @@ int ProtocolProcessorBase::GetActiveRemoteObjectsInterval()
  */
 void ProtocolProcessorBase::SetRemoteObjectsActive(XmlElement* activeObjsXmlElement)
 {
-	{
-		// Intentional local scope to ensure the lock is freed for the rest of the method exec.
-		// This is important, since stopping the thread later on depends on that the timer thread 
-		// callback method can run freely to be able to gracefully terminate,
-		// which cannot happen when the lock is held here until the end of the method!
-		ScopedLock l(m_activeRemoteObjectsLock);
-		ProcessingEngineConfig::ReadActiveObjects(activeObjsXmlElement, m_activeRemoteObjects);
-	}
+	auto activeObjects = GetRemoteObjectsActive();
+	ProcessingEngineConfig::ReadActiveObjects(activeObjsXmlElement, activeObjects);
+
+	SetRemoteObjectsActive(activeObjects);
+}
+
+/**
+ * Setter for remote object to specifically activate.
+ * This overload is used when the list of objects is not taken from 
+ * the protocols' own configuration but derived from elsewhere,
+ * e.g. the objects other protocols of the parent node are handling.
+ * Derived implementations are notified through OnRemoteObjectsActiveChanged.
+ *
+ * @param activeObjs	The list of remote objects to activly handle
+ */
+void ProtocolProcessorBase::SetRemoteObjectsActive(const std::vector<RemoteObject>& activeObjs)
+{
+	// The set is replaced as a whole, readers that hold a snapshot of the previous set continue with it
+	std::atomic_store(&m_activeRemoteObjects, std::shared_ptr<const RemoteObjectSet>(std::make_shared<const RemoteObjectSet>(activeObjs)));
+
+	OnRemoteObjectsActiveChanged();
 
 	// Start timer callback if objects are to be polled
 	if (m_IsRunning)
 	{
-		if (GetActiveRemoteObjects().size() > 0 && m_activeRemoteObjectsInterval > 0)
+		if (!GetActiveRemoteObjects()->IsEmpty() && m_activeRemoteObjectsInterval > 0)
 		{
-			startTimerThread(m_activeRemoteObjectsInterval);
+			startTimerThread(GetTimerThreadInterval());
 		}
 		else
 		{
@@ -198,6 +265,17 @@ void ProtocolProcessorBase::SetRemoteObjectsActive(XmlElement* activeObjsXmlElem
 	}
 }
 
+/**
+ * Getter for a copy of the internal list of remote objects to actively handle.
+ * In contrast to GetActiveRemoteObjects, this returns a plain copy of the list
+ * for callers outside the processor that want to modify it.
+ * @return	The copy of the internal list of active remote objects.
+ */
+const std::vector<RemoteObject> ProtocolProcessorBase::GetRemoteObjectsActive()
+{
+	return GetActiveRemoteObjects()->GetObjects();
+}
+
 /**
  * Setter for remote object channels to not forward for further processing.
  * This uses a helper method from engine config to get a list of
@@ -207,7 +285,10 @@ void ProtocolProcessorBase::SetRemoteObjectsActive(XmlElement* activeObjsXmlElem
  */
 void ProtocolProcessorBase::SetRemoteObjectsMuted(XmlElement* mutedObjChsXmlElement)
 {
-	ProcessingEngineConfig::ReadMutedObjects(mutedObjChsXmlElement, m_mutedRemoteObjects);
+	auto mutedObjects = std::vector<RemoteObject>();
+	ProcessingEngineConfig::ReadMutedObjects(mutedObjChsXmlElement, mutedObjects);
+
+	std::atomic_store(&m_mutedRemoteObjects, std::shared_ptr<const RemoteObjectSet>(std::make_shared<const RemoteObjectSet>(mutedObjects)));
 }
 
 /**
@@ -217,7 +298,7 @@ void ProtocolProcessorBase::SetRemoteObjectsMuted(XmlElement* mutedObjChsXmlElem
  */
 bool ProtocolProcessorBase::IsRemoteObjectMuted(RemoteObject roi)
 {
-	return std::find(m_mutedRemoteObjects.begin(), m_mutedRemoteObjects.end(), roi) != m_mutedRemoteObjects.end();
+	return std::atomic_load(&m_mutedRemoteObjects)->Contains(roi);
 }
 
 /**
@@ -253,19 +334,48 @@ ProtocolRole ProtocolProcessorBase::GetRole()
 /**
  * Timer callback function, which will be called at regular intervals to
  * send out OSC poll messages.
+ * Instead of polling all active objects in one burst per polling interval, the callback
+ * runs at a short fixed interval and polls the objects that are due, with the polling
+ * intervals per object adapted to the observed value changes by the active objects poller.
+ * The due objects are sent in batches, which e.g. OSC sends as one bundle each.
  */
 void ProtocolProcessorBase::timerThreadCallback()
 {
-	RemoteObjectMessageData msgData;
+	m_activeObjectsPoller.SetObjects(GetActiveRemoteObjects(), m_activeRemoteObjectsInterval);
 
-	ScopedLock l(m_activeRemoteObjectsLock);
-	for (auto const& obj : m_activeRemoteObjects)
+	m_pollingDueObjects.clear();
+	m_activeObjectsPoller.CollectDueObjects(m_pollingDueObjects);
+
+	auto dueCount = static_cast<int>(m_pollingDueObjects.size());
+	for (auto batchStart = 0; batchStart < dueCount; batchStart += s_maxPollingBatchSize)
 	{
-		msgData._addrVal = obj._Addr;
-		SendRemoteObjectMessage(obj._Id, msgData);
+		auto batchEnd = jmin(batchStart + s_maxPollingBatchSize, dueCount);
+
+		m_pollingRois.clear();
+		m_pollingMsgData.clear();
+		for (auto i = batchStart; i < batchEnd; i++)
+		{
+			auto const& obj = m_pollingDueObjects.at(i);
+			m_pollingRois.push_back(obj._Id);
+			m_pollingMsgData.push_back(RemoteObjectMessageData(obj._Addr, ROVT_NONE, 0, nullptr, 0));
+		}
+
+		SendRemoteObjectMessages(m_pollingRois.data(), m_pollingMsgData.data(), static_cast<int>(m_pollingRois.size()));
 	}
 }
 
+/**
+ * Getter for the interval the timer thread is to be started with.
+ * For the polling of active objects this is the short interval due objects are checked at.
+ * Derived processors that reimplement the timer callback for other purposes
+ * reimplement this to return their own interval.
+ * @return	The timer thread interval in ms.
+ */
+int ProtocolProcessorBase::GetTimerThreadInterval()
+{
+	return jmax(1, jmin(m_activeRemoteObjectsInterval, s_pollingTickInterval));
+}
+
 
 /**
  * Helper method to normalize a given value to a given range without clipping
@@ -309,6 +419,8 @@ float ProtocolProcessorBase::MapNormalizedValueToRange(float normalizedValue, co
 
 /**
  * Helper to map a given MessageData struct with a given incoming range to another MessageData struct and range.
+ * The payload of the outgoing MessageData struct is allocated and owned by it.
+ * Prefer the variants that map into caller-provided storage on message hot paths.
  * @param	sourceData		The incoming MessageData struct
  * @param	sourceRange		The value range the incoming message data values refer to
  * @param	targetRange		The value range the outgoing message data values shall be mapped to
@@ -318,25 +430,20 @@ float ProtocolProcessorBase::MapNormalizedValueToRange(float normalizedValue, co
  */
 bool ProtocolProcessorBase::MapMessageDataToTargetRangeAndType(const RemoteObjectMessageData& sourceData, const juce::Range<float>& sourceRange, const juce::Range<float>& targetRange, const RemoteObjectValueType targetType, RemoteObjectMessageData& targetData)
 {
-	// Normalize the incoming message data values against the incoming source range
-	auto normalizedObjValues = std::vector<float>();
-	switch (sourceData._valType)
+	// only numeric source values are mapped, other sources result in empty target data that needs no payload
+	auto mappedValueCount = (sourceData._valType == ROVT_FLOAT || sourceData._valType == ROVT_INT) ? sourceData._valCount : std::uint16_t(0);
+
+	void* targetPayload = nullptr;
+	auto targetPayloadCapacity = std::uint32_t(0);
+	switch (mappedValueCount > 0 ? targetType : ROVT_NONE)
 	{
 	case ROVT_FLOAT:
-		jassert(sizeof(float) * sourceData._valCount == sourceData._payloadSize);
-		for (auto i = 0; i < sourceData._valCount; i++)
-		{
-			auto objectValue = static_cast<float*>(sourceData._payload)[i];
-			normalizedObjValues.push_back(NormalizeValueByRange(objectValue, sourceRange));
-		}
+		targetPayload = new float[mappedValueCount];
+		targetPayloadCapacity = static_cast<std::uint32_t>(sizeof(float) * mappedValueCount);
 		break;
 	case ROVT_INT:
-		jassert(sizeof(int) * sourceData._valCount == sourceData._payloadSize);
-		for (auto i = 0; i < sourceData._valCount; i++)
-		{
-			auto objectValue = static_cast<int*>(sourceData._payload)[i];
-			normalizedObjValues.push_back(NormalizeValueByRange(static_cast<float>(objectValue), sourceRange));
-		}
+		targetPayload = new int[mappedValueCount];
+		targetPayloadCapacity = static_cast<std::uint32_t>(sizeof(int) * mappedValueCount);
 		break;
 	case ROVT_NONE:
 	case ROVT_STRING:
@@ -344,49 +451,179 @@ bool ProtocolProcessorBase::MapMessageDataToTargetRangeAndType(const RemoteObjec
 		break;
 	}
 
-	// map the normalized message data on the incoming target range
-	auto targetRangeMappedObjValues = std::vector<float>();
-	for (auto const& normalizedValue : normalizedObjValues)
-		targetRangeMappedObjValues.push_back(MapNormalizedValueToRange(normalizedValue, targetRange));
+	auto mappingSuccess = MapMessageDataToTargetRangeAndType(sourceData, sourceRange, targetRange, targetType, targetData, targetPayload, targetPayloadCapacity);
+	if (mappingSuccess)
+	{
+		targetData._payloadOwned = (nullptr != targetPayload);
+	}
+	else
+	{
+		if (targetType == ROVT_FLOAT)
+			delete[] static_cast<float*>(targetPayload);
+		else if (targetType == ROVT_INT)
+			delete[] static_cast<int*>(targetPayload);
+	}
+
+	return mappingSuccess;
+}
 
-	// dump the mapped data into outgoing message data struct
+/**
+ * Helper to map a given MessageData struct with a given incoming range to another MessageData struct and range,
+ * writing the mapped values to the given caller-provided storage instead of allocating a payload.
+ * The outgoing MessageData struct does not own its payload, so the storage has to outlive it.
+ * @param	sourceData				The incoming MessageData struct
+ * @param	sourceRange				The value range the incoming message data values refer to
+ * @param	targetRange				The value range the outgoing message data values shall be mapped to
+ * @param	targetType				The dataType the outgoing message data values shall be of
+ * @param	targetData				The outgoing MessageData struct
+ * @param	targetPayload			The storage to write the mapped values to
+ * @param	targetPayloadCapacity	The size of the storage in bytes
+ * @return	True if mapping was successful. False if the target datatype was not supported for range-mapping or the storage is too small. In the latter case, the targetData output will be empty.
+ */
+bool ProtocolProcessorBase::MapMessageDataToTargetRangeAndType(const RemoteObjectMessageData& sourceData, const juce::Range<float>& sourceRange, const juce::Range<float>& targetRange, const RemoteObjectValueType targetType, RemoteObjectMessageData& targetData, void* targetPayload, std::uint32_t targetPayloadCapacity)
+{
 	targetData = sourceData;
-	switch (targetType)
+	targetData._valType = ROVT_NONE;
+	targetData._valCount = 0;
+	targetData._payload = nullptr;
+	targetData._payloadSize = 0;
+
+	auto sourceIsFloat = (sourceData._valType == ROVT_FLOAT);
+	auto sourceIsInt = (sourceData._valType == ROVT_INT);
+	auto targetValueSize = std::uint32_t(0);
+	if (targetType == ROVT_FLOAT)
+		targetValueSize = sizeof(float);
+	else if (targetType == ROVT_INT)
+		targetValueSize = sizeof(int);
+
+	if (targetValueSize == 0)
+		return false;
+
+	// sources without numeric values have nothing to map and result in empty target data of the target type, as they always did
+	if (!sourceIsFloat && !sourceIsInt)
 	{
-	case ROVT_FLOAT:
 		targetData._valType = targetType;
-		targetData._valCount = static_cast<std::uint16_t>(targetRangeMappedObjValues.size());
-		targetData._payload = new float[targetData._valCount];
-		targetData._payloadSize = sizeof(float) * targetData._valCount;
-		for (auto i = 0; i < targetData._valCount; i++)
-			static_cast<float*>(targetData._payload)[i] = targetRangeMappedObjValues.at(i);
 		return true;
-	case ROVT_INT:
-		targetData._valType = targetType;
-		targetData._valCount = static_cast<std::uint16_t>(targetRangeMappedObjValues.size());
-		targetData._payload = new int[targetData._valCount];
-		targetData._payloadSize = sizeof(int) * targetData._valCount;
-		for (auto i = 0; i < targetData._valCount; i++)
-			static_cast<int*>(targetData._payload)[i] = static_cast<int>(targetRangeMappedObjValues.at(i));
-		return true;
-	case ROVT_NONE:
-	case ROVT_STRING:
+	}
+
+	jassert((sourceIsFloat ? sizeof(float) : sizeof(int)) * sourceData._valCount == sourceData._payloadSize);
+	auto targetPayloadSize = targetValueSize * sourceData._valCount;
+	if (targetPayloadSize > targetPayloadCapacity || (sourceData._valCount > 0 && (sourceData._payload == nullptr || targetPayload == nullptr)))
+		return false;
+
+	// an empty source range cannot be normalized, which maps all values to the start of the target range, same as NormalizeValueByRange does
+	jassert(!sourceRange.isEmpty());
+	auto sourceStart = sourceRange.getStart();
+	auto sourceLength = sourceRange.isEmpty() ? 0.0f : sourceRange.getLength();
+	auto targetStart = targetRange.getStart();
+	auto targetLength = targetRange.getEnd() - targetRange.getStart();
+	auto valueCount = static_cast<int>(sourceData._valCount);
+
+	if (sourceIsFloat && targetType == ROVT_FLOAT)
+		MapValuesToTargetRange(static_cast<const float*>(sourceData._payload), static_cast<float*>(targetPayload), valueCount, sourceStart, sourceLength, targetStart, targetLength);
+	else if (sourceIsFloat && targetType == ROVT_INT)
+		MapValuesToTargetRange(static_cast<const float*>(sourceData._payload), static_cast<int*>(targetPayload), valueCount, sourceStart, sourceLength, targetStart, targetLength);
+	else if (sourceIsInt && targetType == ROVT_FLOAT)
+		MapValuesToTargetRange(static_cast<const int*>(sourceData._payload), static_cast<float*>(targetPayload), valueCount, sourceStart, sourceLength, targetStart, targetLength);
+	else
+		MapValuesToTargetRange(static_cast<const int*>(sourceData._payload), static_cast<int*>(targetPayload), valueCount, sourceStart, sourceLength, targetStart, targetLength);
+
+	targetData._valType = targetType;
+	targetData._valCount = sourceData._valCount;
+	targetData._payload = targetPayload;
+	targetData._payloadSize = targetPayloadSize;
+
+	return true;
+}
+
+/**
+ * Helper to map a given MessageData struct with a given incoming range to another MessageData struct and range,
+ * writing the mapped values to the given inline payload buffer instead of allocating a payload.
+ * The outgoing MessageData struct does not own its payload, so the buffer has to outlive it.
+ * @param	sourceData			The incoming MessageData struct
+ * @param	sourceRange			The value range the incoming message data values refer to
+ * @param	targetRange			The value range the outgoing message data values shall be mapped to
+ * @param	targetType			The dataType the outgoing message data values shall be of
+ * @param	targetData			The outgoing MessageData struct
+ * @param	targetPayloadBuffer	The buffer to write the mapped values to
+ * @return	True if mapping was successful. False if the target datatype was not supported for range-mapping or the value count exceeds the buffer. In the latter case, the targetData output will be empty.
+ */
+bool ProtocolProcessorBase::MapMessageDataToTargetRangeAndType(const RemoteObjectMessageData& sourceData, const juce::Range<float>& sourceRange, const juce::Range<float>& targetRange, const RemoteObjectValueType targetType, RemoteObjectMessageData& targetData, MappedPayloadBuffer& targetPayloadBuffer)
+{
+	return MapMessageDataToTargetRangeAndType(sourceData, sourceRange, targetRange, targetType, targetData, &targetPayloadBuffer, sizeof(MappedPayloadBuffer));
+}
+
+/**
+ * Kernel to normalize a fixed number of values by the source range and map them to the target range.
+ * With the value count known at compile time, the loop is unrolled and the values of
+ * multi-value objects (XY, XYZ) are mapped together in vector registers.
+ * @param	sourceValues	The values to map.
+ * @param	targetValues	The storage to write the mapped values to.
+ * @param	valueCount		Unused, the number of values is given by ValueCount.
+ * @param	sourceStart		The start of the range the source values refer to.
+ * @param	sourceLength	The length of the range the source values refer to, zero if the range is empty.
+ * @param	targetStart		The start of the range to map the values to.
+ * @param	targetLength	The length of the range to map the values to.
+ */
+template<typename SourceType, typename TargetType, int ValueCount>
+void ProtocolProcessorBase::MapValuesToTargetRange(const SourceType* sourceValues, TargetType* targetValues, int valueCount, float sourceStart, float sourceLength, float targetStart, float targetLength)
+{
+	ignoreUnused(valueCount);
+
+	float mappedValues[ValueCount];
+	for (auto i = 0; i < ValueCount; i++)
+	{
+		auto normalizedValue = sourceLength != 0.0f ? (static_cast<float>(sourceValues[i]) - sourceStart) / sourceLength : 0.0f;
+		mappedValues[i] = targetStart + normalizedValue * targetLength;
+	}
+	for (auto i = 0; i < ValueCount; i++)
+		targetValues[i] = static_cast<TargetType>(mappedValues[i]);
+}
+
+/**
+ * Kernel to normalize any number of values by the source range and map them to the target range.
+ * Single values and the multi-value objects (XY, XYZ) are dispatched to the fixed count kernels.
+ * @param	sourceValues	The values to map.
+ * @param	targetValues	The storage to write the mapped values to.
+ * @param	valueCount		The number of values to map.
+ * @param	sourceStart		The start of the range the source values refer to.
+ * @param	sourceLength	The length of the range the source values refer to, zero if the range is empty.
+ * @param	targetStart		The start of the range to map the values to.
+ * @param	targetLength	The length of the range to map the values to.
+ */
+template<typename SourceType, typename TargetType>
+void ProtocolProcessorBase::MapValuesToTargetRange(const SourceType* sourceValues, TargetType* targetValues, int valueCount, float sourceStart, float sourceLength, float targetStart, float targetLength)
+{
+	switch (valueCount)
+	{
+	case 0:
+		break;
+	case 1:
+		MapValuesToTargetRange<SourceType, TargetType, 1>(sourceValues, targetValues, valueCount, sourceStart, sourceLength, targetStart, targetLength);
+		break;
+	case 2:
+		MapValuesToTargetRange<SourceType, TargetType, 2>(sourceValues, targetValues, valueCount, sourceStart, sourceLength, targetStart, targetLength);
+		break;
+	case 3:
+		MapValuesToTargetRange<SourceType, TargetType, 3>(sourceValues, targetValues, valueCount, sourceStart, sourceLength, targetStart, targetLength);
+		break;
 	default:
-		targetData._valType = ROVT_NONE;
-		targetData._valCount = 0;
-		targetData._payload = nullptr;
-		targetData._payloadSize = 0;
+		for (auto i = 0; i < valueCount; i++)
+		{
+			auto normalizedValue = sourceLength != 0.0f ? (static_cast<float>(sourceValues[i]) - sourceStart) / sourceLength : 0.0f;
+			targetValues[i] = static_cast<TargetType>(targetStart + normalizedValue * targetLength);
+		}
 		break;
 	}
-
-	return false;
 }
 
 /**
  * Getter for the internal list of remote objects to actively handle.
- * @return		The requested reference to internal list.
+ * The list is never modified in place, so the returned snapshot stays valid
+ * and unchanged even if the active objects are replaced meanwhile.
+ * @return		The requested snapshot of the internal list.
  */
-const std::vector<RemoteObject>& ProtocolProcessorBase::GetActiveRemoteObjects()
+std::shared_ptr<const RemoteObjectSet> ProtocolProcessorBase::GetActiveRemoteObjects()
 {
-	return m_activeRemoteObjects;
+	return std::atomic_load(&m_activeRemoteObjects);
 }
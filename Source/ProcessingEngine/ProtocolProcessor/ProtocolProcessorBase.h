@@ -37,7 +37,9 @@ ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "../../RemoteProtocolBridgeCommon.h"
 #include "../ProcessingEngineConfig.h"
 #include "../RemoteObjectValueCache.h"
+#include "../RemoteObjectSet.h"
 #include "../TimerThreadBase.h"
+#include "ActiveObjectsPoller.h"
 
 #include <JuceHeader.h>
 
@@ -71,6 +73,18 @@ public:
 			const RemoteObjectMessageMetaInfo& msgMeta = RemoteObjectMessageMetaInfo(RemoteObjectMessageMetaInfo::MC_None, -1)) = 0;
 	};
 
+	static constexpr int s_maxMappedValueCount = 6;	/**< The maximum number of values a MappedPayloadBuffer can hold, enough for all multi-value objects (XY, XYZ, ...). */
+
+	/**
+	 * Inline storage for the payload of range and type mapped message data,
+	 * to be used with MapMessageDataToTargetRangeAndType without any heap allocation.
+	 */
+	union MappedPayloadBuffer
+	{
+		float	floatValues[s_maxMappedValueCount];
+		int		intValues[s_maxMappedValueCount];
+	};
+
 public:
 	ProtocolProcessorBase(const NodeId& parentNodeId);
 	virtual ~ProtocolProcessorBase();
@@ -84,6 +98,7 @@ public:
 
 	//==============================================================================
 	virtual bool SendRemoteObjectMessage(const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, const int externalId = -1) = 0;
+	virtual bool SendRemoteObjectMessages(const RemoteObjectIdentifier* rois, const RemoteObjectMessageData* msgData, int messageCount, const int externalId = -1);
 
 	virtual bool Start() = 0;
 	virtual bool Stop() = 0;
@@ -91,9 +106,13 @@ public:
 	//==============================================================================
 	void SetActiveRemoteObjectsInterval(int interval);
 	int GetActiveRemoteObjectsInterval();
+	void OnRemoteObjectValueReceived(const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData);
+	ActiveObjectsPoller::Statistics GetPollingStatistics() const;
 	
 	//==============================================================================
 	void SetRemoteObjectsActive(XmlElement* activeObjsXmlElement);	/**< Objects that are to be handled actively (OSC polling, OCA subscribing). */
+	void SetRemoteObjectsActive(const std::vector<RemoteObject>& activeObjs);
+	const std::vector<RemoteObject> GetRemoteObjectsActive();
 
 	//==============================================================================
 	void SetRemoteObjectsMuted(XmlElement* mutedObjChsXmlElement);
@@ -103,6 +122,8 @@ public:
 	static float NormalizeValueByRange(float value, const juce::Range<float>& normalizationRange);
 	static float MapNormalizedValueToRange(float normalizedValue, const juce::Range<float>& range, bool invert = false);
 	static bool MapMessageDataToTargetRangeAndType(const RemoteObjectMessageData& sourceData, const juce::Range<float>& sourceRange, const juce::Range<float>& targetRange, const RemoteObjectValueType targetType, RemoteObjectMessageData& targetData);
+	static bool MapMessageDataToTargetRangeAndType(const RemoteObjectMessageData& sourceData, const juce::Range<float>& sourceRange, const juce::Range<float>& targetRange, const RemoteObjectValueType targetType, RemoteObjectMessageData& targetData, void* targetPayload, std::uint32_t targetPayloadCapacity);
+	static bool MapMessageDataToTargetRangeAndType(const RemoteObjectMessageData& sourceData, const juce::Range<float>& sourceRange, const juce::Range<float>& targetRange, const RemoteObjectValueType targetType, RemoteObjectMessageData& targetData, MappedPayloadBuffer& targetPayloadBuffer);
 
 	//==============================================================================
 	std::unique_ptr<XmlElement> createStateXml() override { return nullptr; };
@@ -110,7 +131,11 @@ public:
 
 protected:
 	//==============================================================================
-	const std::vector<RemoteObject>& GetActiveRemoteObjects();
+	std::shared_ptr<const RemoteObjectSet> GetActiveRemoteObjects();
+	virtual void OnRemoteObjectsActiveChanged() {};
+
+	//==============================================================================
+	virtual int GetTimerThreadInterval();
 
 	//==============================================================================
 	Listener				*m_messageListener;				/**< The parent node object. Needed for e.g. triggering receive notifications. */
@@ -123,10 +148,24 @@ protected:
 private:
 	virtual void timerThreadCallback() override;
 
-	std::vector<RemoteObject>	m_mutedRemoteObjects;			/**< List of remote objects to be muted. */
-	std::vector<RemoteObject>	m_activeRemoteObjects;			/**< List of remote objects to be activly handled. */
-	int							m_activeRemoteObjectsInterval;	/**< Interval at which data is polled/requested from protocol peer. */
-	CriticalSection				m_activeRemoteObjectsLock;
+	//==============================================================================
+	template<typename SourceType, typename TargetType, int ValueCount>
+	static void MapValuesToTargetRange(const SourceType* sourceValues, TargetType* targetValues, int valueCount, float sourceStart, float sourceLength, float targetStart, float targetLength);
+	template<typename SourceType, typename TargetType>
+	static void MapValuesToTargetRange(const SourceType* sourceValues, TargetType* targetValues, int valueCount, float sourceStart, float sourceLength, float targetStart, float targetLength);
+
+	//==============================================================================
+	static constexpr int s_pollingTickInterval = 10;	/**< The interval in ms at which the objects that are due are polled, to spread the polling over the polling interval. */
+	static constexpr int s_maxPollingBatchSize = 32;	/**< The maximum number of poll messages that are sent together, e.g. in one OSC bundle. */
+
+	std::shared_ptr<const RemoteObjectSet>				m_mutedRemoteObjects;			/**< Set of remote objects to be muted. Only accessed through atomic load and store, since it is replaced as a whole on change. */
+	std::shared_ptr<const RemoteObjectSet>				m_activeRemoteObjects;			/**< Set of remote objects to be activly handled. Only accessed through atomic load and store, since it is replaced as a whole on change. */
+	int													m_activeRemoteObjectsInterval;	/**< Interval at which data is polled/requested from protocol peer. */
+
+	ActiveObjectsPoller									m_activeObjectsPoller;			/**< The poller deciding which active objects are due, with polling intervals adapted to value changes. */
+	std::vector<RemoteObject>							m_pollingDueObjects;			/**< Reused buffer of the active objects that are due to be polled. */
+	std::vector<RemoteObjectIdentifier>					m_pollingRois;					/**< Reused buffer of the object ids of a polling batch. */
+	std::vector<RemoteObjectMessageData>				m_pollingMsgData;				/**< Reused buffer of the message data of a polling batch. */
 
 	RemoteObjectValueCache		m_valueCache;
 
@@ -35,6 +35,8 @@ RTTrPMProtocolProcessor::RTTrPMProtocolProcessor(const NodeId& parentNodeId, int
 	// RTTrPMProtocolProcessor derives from RTTrPMReceiver::RealtimeListener
 	m_rttrpmReceiver = std::make_unique<RTTrPMReceiver>(listenerPortNumber);
 	m_rttrpmReceiver->addListener(this);
+
+	m_positionBatch = std::make_unique<PositionBatch>();
 }
 
 /**
@@ -57,6 +59,10 @@ bool RTTrPMProtocolProcessor::Start()
 	if (m_rttrpmReceiver)
 		m_IsRunning = m_rttrpmReceiver->start();
 
+	// the timer is used to forward the latest positions that were held back by the output rate limit
+	if (m_IsRunning && m_outputRate > 0)
+		startTimerThread(GetTimerThreadInterval());
+
 	return m_IsRunning;
 }
 
@@ -68,6 +74,12 @@ bool RTTrPMProtocolProcessor::Stop()
 	if (m_rttrpmReceiver)
 		m_IsRunning = !m_rttrpmReceiver->stop();
 
+	stopTimerThread();
+	{
+		const ScopedLock l(m_rateLimitedPositionsLock);
+		m_rateLimitedPositions.clear();
+	}
+
 	return !m_IsRunning;
 }
 
@@ -204,9 +216,39 @@ bool RTTrPMProtocolProcessor::setStateXml(XmlElement* stateXml)
 		else
 			stateXmlUpdateSuccess = false;
 
+		// optional position prediction, defaults to forwarding the positions as received
+		auto positionPredictionXmlElement = stateXml->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::POSITIONPREDICTION));
+		{
+			const ScopedLock l(m_trackableChannelCacheLock);
+			m_predictionStates.clear();
+			if (positionPredictionXmlElement)
+				m_predictionLookAheadMs = jmax(0, positionPredictionXmlElement->getIntAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::VALUE)));
+			else
+				m_predictionLookAheadMs = 0;
+		}
+
+		// optional output rate limit, defaults to forwarding every received position
+		auto outputRateXmlElement = stateXml->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::OUTPUTRATE));
+		{
+			const ScopedLock l(m_rateLimitedPositionsLock);
+			m_rateLimitedPositions.clear();
+			if (outputRateXmlElement)
+			{
+				m_outputRate = jmax(0, outputRateXmlElement->getIntAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::VALUE)));
+				m_outputRateAveraging = (outputRateXmlElement->getStringAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::MODE)) == "average");
+			}
+			else
+			{
+				m_outputRate = 0;
+				m_outputRateAveraging = false;
+			}
+		}
+
 		auto beaconIdxRemappingsXmlElement = stateXml->getChildByName(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::REMAPPINGS));
 		if (beaconIdxRemappingsXmlElement)
 		{
+			const ScopedLock l(m_trackableChannelCacheLock);
+			m_trackableChannelCache.clear();
 			m_beaconIdxToChannelMap.clear();
 			auto beaconIdxRemappingXmlElement = beaconIdxRemappingsXmlElement->getFirstChildElement();
 			while (nullptr != beaconIdxRemappingXmlElement)
@@ -248,17 +290,17 @@ bool RTTrPMProtocolProcessor::SendRemoteObjectMessage(const RemoteObjectIdentifi
 }
 
 /**
- * Called when the RTTrPM server receives a new RTTrPM packet module
+ * Called when the RTTrPM server receives a new RTTrPM packet
  *
- * @param module			The received RTTrPM module.
+ * @param rttrpmPacket		The received and decoded RTTrPM packet.
  * @param senderIPAddress	The ip the message originates from.
  * @param senderPort			The port this message was received on.
  */
-void RTTrPMProtocolProcessor::RTTrPMModuleReceived(const RTTrPMReceiver::RTTrPMMessage& rttrpmMessage, const String& senderIPAddress, const int& senderPort)
+void RTTrPMProtocolProcessor::RTTrPMModuleReceived(const RTTrPMPacket& rttrpmPacket, const String& senderIPAddress, const int& senderPort)
 {
 	// basic sanity checking of incoming data
 	//////////////////////////////////////////////////
-	if (rttrpmMessage.header.GetPacketSize() == 0)
+	if (rttrpmPacket.GetHeader().GetPacketSize() == 0)
 	{
 		std::stringstream ssdbg;
 		ssdbg << __FUNCTION__ << " ERROR: empty RTTrPM message header";
@@ -267,7 +309,7 @@ void RTTrPMProtocolProcessor::RTTrPMModuleReceived(const RTTrPMReceiver::RTTrPMM
 		return;
 	}
 
-	if (!rttrpmMessage.header.IsLittleEndian())
+	if (!rttrpmPacket.GetHeader().IsLittleEndian())
 	{
 		std::stringstream ssdbg;
 		ssdbg << __FUNCTION__ << " ERROR: only LittleEndian RTTrPM encoding supported";
@@ -289,226 +331,364 @@ void RTTrPMProtocolProcessor::RTTrPMModuleReceived(const RTTrPMReceiver::RTTrPMM
 		return;
 	}
 
-	// convenience lambda function definition to be used when
-	// doing the module data processing later on,
-	// to avoid codeclones
+	// dispatch the trackables and their modules to the typed visitor methods
+	//////////////////////////////////////////////////
+	const ScopedLock l(m_trackableChannelCacheLock);
+	RTTrPMReceiver::VisitPacket(rttrpmPacket, *this);
+
+	// transform and forward the positions collected from all trackables of the packet in one go
 	//////////////////////////////////////////////////
-	std::function<void(const juce::Point<float>&, RemoteObjectIdentifier&, RemoteObjectMessageData&, std::vector<float>&)> RTTrPMPositionToMsgData
-		= [=](const juce::Point<float>& rttrpmPosition, RemoteObjectIdentifier& newObjectId, RemoteObjectMessageData& newMsgData, std::vector<float>& floatValueBuffer)
+	ForwardPositionBatch();
+}
+
+/**
+ * Reimplemented from RTTrPMReceiver::ModuleVisitor to resolve the channel
+ * the following sub-modules of the trackable refer to.
+ * @param trackable	The visited trackable.
+ */
+void RTTrPMProtocolProcessor::VisitTrackable(const RTTrPMPacket::Trackable& trackable)
+{
+	m_visitedTrackableAddr._first = GetTrackableChannel(trackable.name);
+	m_visitedTrackableAddr._second = static_cast<RecordId>(m_mappingAreaId);
+
+	m_visitedPositionValid = false;
+	m_visitedMotionValid = false;
+}
+
+/**
+ * Reimplemented from RTTrPMReceiver::ModuleVisitor to collect the predicted position
+ * once all sub-modules of the trackable, including the ones carrying its velocity, are visited.
+ * @param trackable	The visited trackable.
+ */
+void RTTrPMProtocolProcessor::VisitTrackableEnd(const RTTrPMPacket::Trackable& trackable)
+{
+	ignoreUnused(trackable);
+
+	if (m_predictionLookAheadMs > 0 && m_visitedPositionValid)
+		AddTrackablePosition(PredictTrackablePosition(m_visitedPosition));
+}
+
+/**
+ * Reimplemented from RTTrPMReceiver::ModuleVisitor to forward centroid positions.
+ * @param module	The visited module.
+ */
+void RTTrPMProtocolProcessor::VisitCentroidPosition(const RTTrPMPacket::CentroidPosition& module)
+{
+	if (m_packetModuleTypesForPositioning.contains(PacketModule::CentroidPosition))
+		HandleTrackablePosition(juce::Point<float>(static_cast<float>(module.x), static_cast<float>(module.y)));
+}
+
+/**
+ * Reimplemented from RTTrPMReceiver::ModuleVisitor to forward tracked point positions.
+ * @param module	The visited module.
+ */
+void RTTrPMProtocolProcessor::VisitTrackedPointPosition(const RTTrPMPacket::TrackedPointPosition& module)
+{
+	if (m_packetModuleTypesForPositioning.contains(PacketModule::TrackedPointPosition))
+		HandleTrackablePosition(juce::Point<float>(static_cast<float>(module.x), static_cast<float>(module.y)));
+}
+
+/**
+ * Reimplemented from RTTrPMReceiver::ModuleVisitor to forward centroid positions of acceleration and velocity modules.
+ * @param module	The visited module.
+ */
+void RTTrPMProtocolProcessor::VisitCentroidAccelerationAndVelocity(const RTTrPMPacket::AccelerationAndVelocity& module)
+{
+	HandleTrackableMotion(module, true);
+
+	if (m_packetModuleTypesForPositioning.contains(PacketModule::CentroidAccelerationAndVelocity))
+		HandleTrackablePosition(juce::Point<float>(static_cast<float>(module.x), static_cast<float>(module.y)));
+}
+
+/**
+ * Reimplemented from RTTrPMReceiver::ModuleVisitor to forward tracked point positions of acceleration and velocity modules.
+ * @param module	The visited module.
+ */
+void RTTrPMProtocolProcessor::VisitTrackedPointAccelerationAndVelocity(const RTTrPMPacket::AccelerationAndVelocity& module)
+{
+	HandleTrackableMotion(module, false);
+
+	if (m_packetModuleTypesForPositioning.contains(PacketModule::TrackedPointAccelerationAndVelocity))
+		HandleTrackablePosition(juce::Point<float>(static_cast<float>(module.x), static_cast<float>(module.y)));
+}
+
+/**
+ * Helper method to handle a position of the currently visited trackable.
+ * Without prediction, it is collected right away, otherwise it is held until the end of the trackable.
+ * @param rttrpmPosition	The xy position as received in the RTTrPM module.
+ */
+void RTTrPMProtocolProcessor::HandleTrackablePosition(const juce::Point<float>& rttrpmPosition)
+{
+	if (m_predictionLookAheadMs > 0)
 	{
-		jassert(floatValueBuffer.size() == 2);
-		if (floatValueBuffer.size() != 2)
-			return;
+		m_visitedPosition = rttrpmPosition;
+		m_visitedPositionValid = true;
+	}
+	else
+		AddTrackablePosition(rttrpmPosition);
+}
 
-		if (m_mappingAreaId == MAI_Invalid)
-		{
-			newObjectId = ROI_Positioning_SourcePosition_XY;
-			if (m_xyAxisSwapped)
-				floatValueBuffer = { -1.0f * m_yAxisInversionFactor * rttrpmPosition.getY(), m_xAxisInversionFactor * rttrpmPosition.getX() }; // when swapped, we expect y to be positive upstage, therefor the -1 inversion is required
-			else
-				floatValueBuffer = { m_xAxisInversionFactor * rttrpmPosition.getX(), m_yAxisInversionFactor * rttrpmPosition.getY() }; // absolute coordinates are forwarded 1:1
+/**
+ * Helper method to remember the velocity and acceleration of the currently visited trackable for prediction.
+ * @param module		The visited acceleration and velocity module.
+ * @param isPreferred	True for centroid modules, that take precedence over tracked point modules.
+ */
+void RTTrPMProtocolProcessor::HandleTrackableMotion(const RTTrPMPacket::AccelerationAndVelocity& module, bool isPreferred)
+{
+	if (m_predictionLookAheadMs <= 0 || (m_visitedMotionValid && !isPreferred))
+		return;
 
-			floatValueBuffer[0] += m_absoluteOriginOffset.getX();
-			floatValueBuffer[1] += m_absoluteOriginOffset.getY();
-		}
-		else
-		{
-			newObjectId = ROI_CoordinateMapping_SourcePosition_XY;
-			if (m_xyAxisSwapped)
-				floatValueBuffer = GetMappedPosition({ m_xAxisInversionFactor * rttrpmPosition.getY(), m_yAxisInversionFactor * rttrpmPosition.getX() });
-			else
-				floatValueBuffer = GetMappedPosition({ m_xAxisInversionFactor * rttrpmPosition.getX(), m_yAxisInversionFactor * rttrpmPosition.getY() });
-		}
+	m_visitedVelocity = juce::Point<float>(module.velocityX, module.velocityY);
+	m_visitedAcceleration = juce::Point<float>(module.accelerationX, module.accelerationY);
+	m_visitedMotionValid = true;
+}
 
-		newMsgData._valType = ROVT_FLOAT;
-		newMsgData._valCount = 2;
-		newMsgData._payload = floatValueBuffer.data();
-		newMsgData._payloadSize = 2 * sizeof(float);
-	};
+/**
+ * Helper method to extrapolate the position of the currently visited trackable by the configured look-ahead time.
+ * The velocity and acceleration of the trackable are used if it came with an acceleration and velocity module,
+ * otherwise the velocity is derived from the difference to the previous position of the trackable.
+ * @param rttrpmPosition	The xy position as received in the RTTrPM module.
+ * @return	The predicted position, or the received position if no velocity could be determined.
+ */
+const juce::Point<float> RTTrPMProtocolProcessor::PredictTrackablePosition(const juce::Point<float>& rttrpmPosition)
+{
+	auto nowMs = Time::getMillisecondCounterHiRes();
 
-	// actual processing incoming RTTrPM module data
-	//////////////////////////////////////////////////
-	RemoteObjectMessageData newMsgData;
-	newMsgData._addrVal._first = INVALID_ADDRESS_VALUE;
-	newMsgData._addrVal._second = INVALID_ADDRESS_VALUE;
-	newMsgData._valType = ROVT_NONE;
-	newMsgData._valCount = 0;
-	newMsgData._payload = 0;
-	newMsgData._payloadSize = 0;
-
-	RemoteObjectIdentifier newObjectId = ROI_Invalid;
-	
-	std::vector<float> newDualFloatValue = { 0.0f, 0.0f };
-
-	for (auto const& RTTrPMmodule : rttrpmMessage.modules)
+	auto velocity = juce::Point<float>();
+	auto acceleration = juce::Point<float>();
+	auto hasVelocity = false;
+
+	auto& predictionState = m_predictionStates[m_visitedTrackableAddr._first];
+	if (m_visitedMotionValid)
 	{
-		if (RTTrPMmodule->isValid())
+		velocity = m_visitedVelocity;
+		acceleration = m_visitedAcceleration;
+		hasVelocity = true;
+	}
+	else if (predictionState.isValid)
+	{
+		auto intervalMs = nowMs - predictionState.lastTimeMs;
+		if (intervalMs > 0.0 && intervalMs <= s_maxFiniteDifferenceIntervalMs)
 		{
-			switch (RTTrPMmodule->GetModuleType())
-			{
-			case PacketModule::WithTimestamp:
-			case PacketModule::WithoutTimestamp:
-				{
-					const PacketModuleTrackable* trackableModule = dynamic_cast<const PacketModuleTrackable*>(RTTrPMmodule.get());
-					if (trackableModule)
-					{
-						//DBG("PacketModuleTrackable('" + String(trackableModule->GetName()) + "'): seqNo" 
-						//	+ String(trackableModule->GetSeqNumber()) + " with " + String(trackableModule->GetNumberOfSubModules()) + " submodules");
-
-						auto beaconIdx = String(trackableModule->GetName()).getIntValue();
-						// in case the beaconIdx to channel remapping contains the incoming index, we use that remapping
-						if (m_beaconIdxToChannelMap.find(beaconIdx) != m_beaconIdxToChannelMap.end())
-							newMsgData._addrVal._first = m_beaconIdxToChannelMap.at(beaconIdx);
-						// otherwise the generic channel equals beaconIdx scheme is applied
-						else
-							newMsgData._addrVal._first = ChannelId(beaconIdx);
-						newMsgData._addrVal._second = static_cast<RecordId>(m_mappingAreaId);
-					}
-				}
-				break;
-			case PacketModule::CentroidPosition:
-				{
-					const CentroidPositionModule* centroidPositionModule = dynamic_cast<const CentroidPositionModule*>(RTTrPMmodule.get());
-					if (centroidPositionModule)
-					{
-						//DBG("CentroidPositionModule: latency" 
-						//	+ String(centroidPositionModule->GetLatency()) 
-						//	+ String::formatted(" x%f,y%f,z%f", centroidPositionModule->GetX(), centroidPositionModule->GetY(), centroidPositionModule->GetZ()));
-
-						if (m_packetModuleTypesForPositioning.contains(PacketModule::CentroidPosition))
-						{
-							RTTrPMPositionToMsgData(juce::Point<float>(static_cast<float>(centroidPositionModule->GetX()), static_cast<float>(centroidPositionModule->GetY())), newObjectId, newMsgData, newDualFloatValue);
-
-							// If the received data targets a muted object, dont forward the message
-							if (IsRemoteObjectMuted(RemoteObject(newObjectId, newMsgData._addrVal)))
-								continue;
-
-							// provide the received message to parent node
-							else if (m_messageListener)
-								m_messageListener->OnProtocolMessageReceived(this, newObjectId, newMsgData);
-						}
-					}
-				}
-				break;
-			case PacketModule::TrackedPointPosition:
-				{
-					const TrackedPointPositionModule* trackedPointPositionModule = dynamic_cast<const TrackedPointPositionModule*>(RTTrPMmodule.get());
-					if (trackedPointPositionModule)
-					{
-						//DBG("TrackedPointPositionModule: idx" 
-						//	+ String(trackedPointPositionModule->GetPointIndex()) 
-						//	+ " latency" + String(trackedPointPositionModule->GetLatency()) 
-						//	+ String::formatted(" x%f,y%f,z%f", trackedPointPositionModule->GetX(), trackedPointPositionModule->GetY(), trackedPointPositionModule->GetZ()));
-
-						if (m_packetModuleTypesForPositioning.contains(PacketModule::TrackedPointPosition))
-						{
-							RTTrPMPositionToMsgData(juce::Point<float>(static_cast<float>(trackedPointPositionModule->GetX()), static_cast<float>(trackedPointPositionModule->GetY())), newObjectId, newMsgData, newDualFloatValue);
-
-							// If the received data targets a muted object, dont forward the message
-							if (IsRemoteObjectMuted(RemoteObject(newObjectId, newMsgData._addrVal)))
-								continue;
-
-							// provide the received message to parent node
-							else if (m_messageListener)
-								m_messageListener->OnProtocolMessageReceived(this, newObjectId, newMsgData);
-						}
-					}
-				}
-				break;
-			case PacketModule::OrientationQuaternion:
-				{
-					const OrientationQuaternionModule* orientationQuaternionModule = dynamic_cast<const OrientationQuaternionModule*>(RTTrPMmodule.get());
-					if (orientationQuaternionModule)
-					{
-						//DBG("OrientationQuaternionModule: latency" 
-						//	+ String(orientationQuaternionModule->GetLatency()) 
-						//	+ String::formatted(" qx%f,qy%f,qz%f,qw%f", orientationQuaternionModule->GetQx(), orientationQuaternionModule->GetQy(), orientationQuaternionModule->GetQz(), orientationQuaternionModule->GetQw()));
-					}
-				}
-				break;
-			case PacketModule::OrientationEuler:
-				{
-					const OrientationEulerModule* orientationEulerModule = dynamic_cast<const OrientationEulerModule*>(RTTrPMmodule.get());
-					if (orientationEulerModule)
-					{
-						//DBG("OrientationEulerModule: latency" 
-						//	+ String(orientationEulerModule->GetLatency()) + " order" 
-						//	+ String(orientationEulerModule->GetOrder()) 
-						//	+ String::formatted(" r1%f,r2%f,r3%f", orientationEulerModule->GetR1(), orientationEulerModule->GetR2(), orientationEulerModule->GetR3()));
-					}
-				}
-				break;
-			case PacketModule::CentroidAccelerationAndVelocity:
-				{
-					const CentroidAccelAndVeloModule* centroidAccelAndVeloModule = dynamic_cast<const CentroidAccelAndVeloModule*>(RTTrPMmodule.get());
-					if (centroidAccelAndVeloModule)
-					{
-						//DBG("CentroidAccelAndVeloModule:"
-						//	+ String::formatted(" xc%f,yc%f,zc%f", centroidAccelAndVeloModule->GetXCoordinate(), centroidAccelAndVeloModule->GetYCoordinate(), centroidAccelAndVeloModule->GetZCoordinate())
-						//	+ String::formatted(" xa%f,ya%f,za%f", centroidAccelAndVeloModule->GetXAcceleration(), centroidAccelAndVeloModule->GetYAcceleration(), centroidAccelAndVeloModule->GetZAcceleration())
-						//	+ String::formatted(" xv%f,yv%f,zv%f", centroidAccelAndVeloModule->GetXVelocity(), centroidAccelAndVeloModule->GetYVelocity(), centroidAccelAndVeloModule->GetZVelocity()));
-
-						if (m_packetModuleTypesForPositioning.contains(PacketModule::CentroidAccelerationAndVelocity))
-						{
-							RTTrPMPositionToMsgData(juce::Point<float>(static_cast<float>(centroidAccelAndVeloModule->GetXCoordinate()), static_cast<float>(centroidAccelAndVeloModule->GetYCoordinate())), newObjectId, newMsgData, newDualFloatValue);
-
-							// If the received data targets a muted object, dont forward the message
-							if (IsRemoteObjectMuted(RemoteObject(newObjectId, newMsgData._addrVal)))
-								continue;
-
-							// provide the received message to parent node
-							else if (m_messageListener)
-								m_messageListener->OnProtocolMessageReceived(this, newObjectId, newMsgData);
-						}
-					}
-				}
-				break;
-			case PacketModule::TrackedPointAccelerationAndVelocity:
-				{
-					const TrackedPointAccelAndVeloModule* trackedPointAccelAndVeloModule = dynamic_cast<const TrackedPointAccelAndVeloModule*>(RTTrPMmodule.get());
-					if (trackedPointAccelAndVeloModule)
-					{
-						//DBG("TrackedPointAccelAndVeloModule: idx" + String(trackedPointAccelAndVeloModule->GetPointIndex())
-						//	+ String::formatted(" xc%f,yc%f,zc%f", trackedPointAccelAndVeloModule->GetXCoordinate(), trackedPointAccelAndVeloModule->GetYCoordinate(), trackedPointAccelAndVeloModule->GetZCoordinate())
-						//	+ String::formatted(" xa%f,ya%f,za%f", trackedPointAccelAndVeloModule->GetXAcceleration(), trackedPointAccelAndVeloModule->GetYAcceleration(), trackedPointAccelAndVeloModule->GetZAcceleration())
-						//	+ String::formatted(" xv%f,yv%f,zv%f", trackedPointAccelAndVeloModule->GetXVelocity(), trackedPointAccelAndVeloModule->GetYVelocity(), trackedPointAccelAndVeloModule->GetZVelocity()));
-
-						if (m_packetModuleTypesForPositioning.contains(PacketModule::TrackedPointAccelerationAndVelocity))
-						{
-							RTTrPMPositionToMsgData(juce::Point<float>(static_cast<float>(trackedPointAccelAndVeloModule->GetXCoordinate()), static_cast<float>(trackedPointAccelAndVeloModule->GetYCoordinate())), newObjectId, newMsgData, newDualFloatValue);
-
-							// If the received data targets a muted object, dont forward the message
-							if (IsRemoteObjectMuted(RemoteObject(newObjectId, newMsgData._addrVal)))
-								continue;
-
-							// provide the received message to parent node
-							else if (m_messageListener)
-								m_messageListener->OnProtocolMessageReceived(this, newObjectId, newMsgData);
-						}
-					}
-				}
-				break;
-			case PacketModule::ZoneCollisionDetection:
-				{
-					const ZoneCollisionDetectionModule* zoneCollisionDetectionModule = dynamic_cast<const ZoneCollisionDetectionModule*>(RTTrPMmodule.get());
-					if (zoneCollisionDetectionModule)
-					{
-						//DBG("ZoneCollisionDetectionModule: contains " + String(zoneCollisionDetectionModule->GetZoneSubModules().size()) + "submodules");
-					}
-				}
-				break;
-			case PacketModule::Invalid:
-				DBG("Invalid PacketModule!");
-				break;
-			default:
-				break;
-			}
+			velocity = (rttrpmPosition - predictionState.lastPosition) / static_cast<float>(0.001 * intervalMs);
+			hasVelocity = true;
 		}
-		else
+	}
+
+	predictionState.lastPosition = rttrpmPosition;
+	predictionState.lastTimeMs = nowMs;
+	predictionState.isValid = true;
+
+	if (!hasVelocity)
+		return rttrpmPosition;
+
+	auto lookAheadS = 0.001f * static_cast<float>(m_predictionLookAheadMs);
+	return rttrpmPosition + velocity * lookAheadS + acceleration * (0.5f * lookAheadS * lookAheadS);
+}
+
+/**
+ * Helper method to collect a trackable position of the currently visited trackable,
+ * to be converted to a positioning message together with the other positions of the packet.
+ * Positions of muted objects are dropped right away.
+ * @param rttrpmPosition	The xy position as received in the RTTrPM module.
+ */
+void RTTrPMProtocolProcessor::AddTrackablePosition(const juce::Point<float>& rttrpmPosition)
+{
+	auto objectId = (m_mappingAreaId == MAI_Invalid) ? ROI_Positioning_SourcePosition_XY : ROI_CoordinateMapping_SourcePosition_XY;
+	if (IsRemoteObjectMuted(RemoteObject(objectId, m_visitedTrackableAddr)))
+		return;
+
+	auto& batch = *m_positionBatch;
+	if (batch.count >= PositionBatch::Capacity)
+		ForwardPositionBatch();
+
+	batch.x[batch.count] = rttrpmPosition.getX();
+	batch.y[batch.count] = rttrpmPosition.getY();
+	batch.channels[batch.count] = m_visitedTrackableAddr._first;
+	batch.count++;
+}
+
+/**
+ * Helper method to convert the collected trackable positions to positioning messages
+ * and provide them to the parent node. Absolute as well as mapped coordinates are an
+ * affine transform per axis, that is applied to all positions at once.
+ * When positions are extrapolated, mapped coordinates are limited to the mapping area.
+ */
+void RTTrPMProtocolProcessor::ForwardPositionBatch()
+{
+	auto& batch = *m_positionBatch;
+	if (batch.count == 0)
+		return;
+
+	// when swapped, the received y is the output x and vice versa
+	auto sourceX = m_xyAxisSwapped ? batch.y.data() : batch.x.data();
+	auto sourceY = m_xyAxisSwapped ? batch.x.data() : batch.y.data();
+
+	auto objectId = ROI_Invalid;
+	if (m_mappingAreaId == MAI_Invalid)
+	{
+		objectId = ROI_Positioning_SourcePosition_XY;
+
+		// when swapped, we expect y to be positive upstage, therefor the -1 inversion is required, otherwise absolute coordinates are forwarded 1:1
+		auto scaleX = m_xyAxisSwapped ? -1.0f * m_yAxisInversionFactor : m_xAxisInversionFactor;
+		auto scaleY = m_xyAxisSwapped ? m_xAxisInversionFactor : m_yAxisInversionFactor;
+
+		TransformPositions(sourceX, batch.mappedX.data(), batch.count, scaleX, m_absoluteOriginOffset.getX(), false);
+		TransformPositions(sourceY, batch.mappedY.data(), batch.count, scaleY, m_absoluteOriginOffset.getY(), false);
+	}
+	else
+	{
+		objectId = ROI_CoordinateMapping_SourcePosition_XY;
+
+		// map to the configured rescale origin/range: (inversion * p - start) / length
+		jassert(0.0f != m_mappingAreaRescaleRangeX.getLength() && 0.0f != m_mappingAreaRescaleRangeY.getLength());
+		auto scaleX = 0.0f, offsetX = 0.0f, scaleY = 0.0f, offsetY = 0.0f;
+		if (0.0f != m_mappingAreaRescaleRangeX.getLength() && 0.0f != m_mappingAreaRescaleRangeY.getLength())
 		{
-			newObjectId = ROI_Invalid;
+			scaleX = m_xAxisInversionFactor / m_mappingAreaRescaleRangeX.getLength();
+			offsetX = -m_mappingAreaRescaleRangeX.getStart() / m_mappingAreaRescaleRangeX.getLength();
+			scaleY = m_yAxisInversionFactor / m_mappingAreaRescaleRangeY.getLength();
+			offsetY = -m_mappingAreaRescaleRangeY.getStart() / m_mappingAreaRescaleRangeY.getLength();
 		}
+
+		auto clampToMappingArea = m_predictionLookAheadMs > 0;
+		TransformPositions(sourceX, batch.mappedX.data(), batch.count, scaleX, offsetX, clampToMappingArea);
+		TransformPositions(sourceY, batch.mappedY.data(), batch.count, scaleY, offsetY, clampToMappingArea);
 	}
+
+	// provide the converted positions to parent node, either directly or limited to the configured output rate
+	for (int i = 0; i < batch.count; i++)
+	{
+		m_floatValueBuffer[0] = batch.mappedX[i];
+		m_floatValueBuffer[1] = batch.mappedY[i];
+
+		auto object = RemoteObject(objectId, RemoteObjectAddressing(batch.channels[i], static_cast<RecordId>(m_mappingAreaId)));
+		if (m_outputRate > 0)
+			ForwardRateLimitedPosition(object, m_floatValueBuffer);
+		else if (m_messageListener)
+			m_messageListener->OnProtocolMessageReceived(this, objectId, RemoteObjectMessageData(object._Addr, ROVT_FLOAT, 2, m_floatValueBuffer, 2 * sizeof(float)));
+	}
+
+	batch.count = 0;
+}
+
+/**
+ * Helper method to limit the rate at which positions of a trackable are forwarded to the parent node.
+ * The position is held back if the trackable was forwarded less than one output interval ago,
+ * replacing (or, when averaging, accumulating with) the positions held back before.
+ * @param object	The remote object the position refers to.
+ * @param position	The xy position to forward.
+ */
+void RTTrPMProtocolProcessor::ForwardRateLimitedPosition(const RemoteObject& object, const float* position)
+{
+	auto nowMs = Time::getMillisecondCounterHiRes();
+
+	const ScopedLock l(m_rateLimitedPositionsLock);
+	auto& rateLimitedPosition = m_rateLimitedPositions[object];
+	if (m_outputRateAveraging && rateLimitedPosition.frameCount > 0)
+	{
+		rateLimitedPosition.position[0] += position[0];
+		rateLimitedPosition.position[1] += position[1];
+	}
+	else
+	{
+		rateLimitedPosition.position[0] = position[0];
+		rateLimitedPosition.position[1] = position[1];
+	}
+	rateLimitedPosition.frameCount++;
+
+	if (m_outputRate > 0 && (nowMs - rateLimitedPosition.lastForwardTimeMs) >= (1000.0 / m_outputRate))
+		ForwardPendingRateLimitedPosition(object, rateLimitedPosition, nowMs);
+}
+
+/**
+ * Helper method to forward the position held back for a trackable to the parent node.
+ * Must be called with m_rateLimitedPositionsLock held.
+ * @param object				The remote object the position refers to.
+ * @param rateLimitedPosition	The held back position data.
+ * @param nowMs					The current time, to be remembered as time of forwarding.
+ */
+void RTTrPMProtocolProcessor::ForwardPendingRateLimitedPosition(const RemoteObject& object, RateLimitedPosition& rateLimitedPosition, double nowMs)
+{
+	if (rateLimitedPosition.frameCount == 0)
+		return;
+
+	float forwardPosition[2] = { rateLimitedPosition.position[0], rateLimitedPosition.position[1] };
+	if (m_outputRateAveraging)
+	{
+		forwardPosition[0] /= rateLimitedPosition.frameCount;
+		forwardPosition[1] /= rateLimitedPosition.frameCount;
+	}
+
+	rateLimitedPosition.frameCount = 0;
+	rateLimitedPosition.lastForwardTimeMs = nowMs;
+
+	if (m_messageListener)
+		m_messageListener->OnProtocolMessageReceived(this, object._Id, RemoteObjectMessageData(object._Addr, ROVT_FLOAT, 2, forwardPosition, 2 * sizeof(float)));
+}
+
+/**
+ * TimerThreadBase callback to forward the positions that were held back by
+ * the output rate limit and did not get superseded by a newer position in time.
+ */
+void RTTrPMProtocolProcessor::timerThreadCallback()
+{
+	if (m_outputRate <= 0)
+		return;
+
+	auto nowMs = Time::getMillisecondCounterHiRes();
+	auto outputIntervalMs = 1000.0 / m_outputRate;
+
+	const ScopedLock l(m_rateLimitedPositionsLock);
+	for (auto& rateLimitedPositionKV : m_rateLimitedPositions)
+	{
+		if ((nowMs - rateLimitedPositionKV.second.lastForwardTimeMs) >= outputIntervalMs)
+			ForwardPendingRateLimitedPosition(rateLimitedPositionKV.first, rateLimitedPositionKV.second, nowMs);
+	}
+}
+
+/**
+ * Reimplemented from ProtocolProcessorBase to not use the active objects polling chunk interval,
+ * but the interval derived from the configured output rate.
+ * @return	The timer thread interval in ms.
+ */
+int RTTrPMProtocolProcessor::GetTimerThreadInterval()
+{
+	if (m_outputRate <= 0)
+		return ProtocolProcessorBase::GetTimerThreadInterval();
+
+	return jmax(1, 1000 / m_outputRate);
+}
+
+/**
+ * Helper method to resolve the channel a trackable name refers to.
+ * The name is parsed as beacon index and remapped as configured only once,
+ * later packets resolve the name by a lookup in the cached mapping.
+ * Must be called with m_trackableChannelCacheLock held.
+ * @param trackableName	The name of the trackable.
+ * @return	The channel the trackable refers to.
+ */
+ChannelId RTTrPMProtocolProcessor::GetTrackableChannel(const std::string_view& trackableName)
+{
+	auto cachedChannelIter = m_trackableChannelCache.find(trackableName);
+	if (cachedChannelIter != m_trackableChannelCache.end())
+		return cachedChannelIter->second;
+
+	auto channel = ChannelId(INVALID_ADDRESS_VALUE);
+	auto beaconIdx = String(trackableName.data(), trackableName.size()).getIntValue();
+	// in case the beaconIdx to channel remapping contains the incoming index, we use that remapping
+	if (m_beaconIdxToChannelMap.find(beaconIdx) != m_beaconIdxToChannelMap.end())
+		channel = m_beaconIdxToChannelMap.at(beaconIdx);
+	// otherwise the generic channel equals beaconIdx scheme is applied
+	else
+		channel = ChannelId(beaconIdx);
+
+	// limit the cache to not grow unbounded with arbitrary incoming names
+	if (m_trackableChannelCache.size() >= s_maxTrackableChannelCacheSize)
+		m_trackableChannelCache.clear();
+	m_trackableChannelCache.insert(std::make_pair(std::string(trackableName), channel));
+
+	return channel;
 }
 
 /**
@@ -546,23 +726,23 @@ const juce::String RTTrPMProtocolProcessor::GetRTTrPMModuleString(PacketModule::
 }
 
 /**
- * Helper method to map a given xy position to the configured rescale origin/range and return this.
- * @param	moduleDataPosition	The xy position to be mapped
- * @return	The mapped xy position value
+ * Static helper method to apply an affine transform to one axis of a batch of positions.
+ * Kept as plain loops without branches or aliasing, so the compiler can vectorise them.
+ * @param	source				The input coordinates.
+ * @param	target				The caller provided storage for the transformed coordinates, not overlapping the source.
+ * @param	count				The number of coordinates to transform.
+ * @param	scale				The factor to multiply each coordinate with.
+ * @param	offset				The offset to add to each scaled coordinate.
+ * @param	clampToUnitRange	True to limit the transformed coordinates to 0..1.
  */
-std::vector<float> RTTrPMProtocolProcessor::GetMappedPosition(const std::vector<float>& moduleDataPosition)
+void RTTrPMProtocolProcessor::TransformPositions(const float* source, float* target, int count, float scale, float offset, bool clampToUnitRange)
 {
-	jassert(2 == moduleDataPosition.size());
-	if (2 != moduleDataPosition.size())
-		return {0.0f, 0.0f};
-
-	jassert(0.0f != m_mappingAreaRescaleRangeX.getLength() && 0.0f != m_mappingAreaRescaleRangeY.getLength());
-	if (0.0f == m_mappingAreaRescaleRangeX.getLength() || 0.0f == m_mappingAreaRescaleRangeY.getLength())
-		return { 0.0f, 0.0f };
+	for (int i = 0; i < count; i++)
+		target[i] = source[i] * scale + offset;
 
-	std::vector<float> mappedPosition(2);
-	mappedPosition[0] = (moduleDataPosition.at(0) - m_mappingAreaRescaleRangeX.getStart()) / m_mappingAreaRescaleRangeX.getLength();
-	mappedPosition[1] = (moduleDataPosition.at(1) - m_mappingAreaRescaleRangeY.getStart()) / m_mappingAreaRescaleRangeY.getLength();
-
-	return mappedPosition;
+	if (clampToUnitRange)
+	{
+		for (int i = 0; i < count; i++)
+			target[i] = jlimit(0.0f, 1.0f, target[i]);
+	}
 }
@@ -29,6 +29,7 @@
  * Class RTTrPMProtocolProcessor is a derived class for OSC protocol interaction.
  */
 class RTTrPMProtocolProcessor : public RTTrPMReceiver::RealtimeDataListener,
+	public RTTrPMReceiver::ModuleVisitor,
 	public NetworkProtocolProcessorBase
 {
 public:
@@ -46,10 +47,19 @@ public:
 	bool SendRemoteObjectMessage(const RemoteObjectIdentifier roi, const RemoteObjectMessageData& msgData, const int externalId = -1) override;
 
 	//==============================================================================
-	void RTTrPMModuleReceived(const RTTrPMReceiver::RTTrPMMessage& rttrpmMessage, const String& senderIPAddress, const int& senderPort) override;
+	void RTTrPMModuleReceived(const RTTrPMPacket& rttrpmPacket, const String& senderIPAddress, const int& senderPort) override;
+
+	//==============================================================================
+	void VisitTrackable(const RTTrPMPacket::Trackable& trackable) override;
+	void VisitCentroidPosition(const RTTrPMPacket::CentroidPosition& module) override;
+	void VisitTrackedPointPosition(const RTTrPMPacket::TrackedPointPosition& module) override;
+	void VisitCentroidAccelerationAndVelocity(const RTTrPMPacket::AccelerationAndVelocity& module) override;
+	void VisitTrackedPointAccelerationAndVelocity(const RTTrPMPacket::AccelerationAndVelocity& module) override;
+	void VisitTrackableEnd(const RTTrPMPacket::Trackable& trackable) override;
 
 	//==============================================================================
 	static const juce::String GetRTTrPMModuleString(PacketModule::PacketModuleType moduleType);
+	static void TransformPositions(const float* source, float* target, int count, float scale, float offset, bool clampToUnitRange);
 
 protected:
 	//==============================================================================
@@ -57,7 +67,55 @@ protected:
 
 private:
 	//==============================================================================
-	std::vector<float>	GetMappedPosition(const std::vector<float>& moduleDataPosition);
+	/**
+	 * Helper type to hold the last position of a trackable, to derive its velocity by finite differences.
+	 */
+	struct PredictionState
+	{
+		juce::Point<float>	lastPosition;
+		double				lastTimeMs{ 0.0 };
+		bool				isValid{ false };
+	};
+
+	/**
+	 * Helper type to hold the positions of a trackable received in between two rate limited forwardings.
+	 */
+	struct RateLimitedPosition
+	{
+		float	position[2]{ 0.0f, 0.0f };	/**< The latest position or the sum of positions, when averaging. */
+		int		frameCount{ 0 };				/**< The number of positions received since the last forwarding. */
+		double	lastForwardTimeMs{ 0.0 };		/**< The time the position was last forwarded at. */
+	};
+
+	/**
+	 * Helper type to collect the positions of all trackables of a packet as structure of arrays,
+	 * to be transformed in one pass that the compiler can vectorise.
+	 */
+	struct PositionBatch
+	{
+		static constexpr int Capacity = RTTrPMPacket::MaxSubModules;	/**< Without prediction, every position module of a packet contributes. */
+
+		std::array<float, Capacity>		x;			/**< The x positions as received. */
+		std::array<float, Capacity>		y;			/**< The y positions as received. */
+		std::array<float, Capacity>		mappedX;	/**< The x positions transformed to the output coordinate system. */
+		std::array<float, Capacity>		mappedY;	/**< The y positions transformed to the output coordinate system. */
+		std::array<ChannelId, Capacity>	channels;	/**< The channel each position refers to. */
+		int								count{ 0 };
+	};
+
+	//==============================================================================
+	void timerThreadCallback() override;
+	int GetTimerThreadInterval() override;
+
+	//==============================================================================
+	void HandleTrackablePosition(const juce::Point<float>& rttrpmPosition);
+	void HandleTrackableMotion(const RTTrPMPacket::AccelerationAndVelocity& module, bool isPreferred);
+	const juce::Point<float> PredictTrackablePosition(const juce::Point<float>& rttrpmPosition);
+	void AddTrackablePosition(const juce::Point<float>& rttrpmPosition);
+	void ForwardPositionBatch();
+	void ForwardRateLimitedPosition(const RemoteObject& object, const float* position);
+	void ForwardPendingRateLimitedPosition(const RemoteObject& object, RateLimitedPosition& rateLimitedPosition, double nowMs);
+	ChannelId GetTrackableChannel(const std::string_view& trackableName);
 
 	//==============================================================================
 	std::unique_ptr<RTTrPMReceiver>	m_rttrpmReceiver;	/**< A receiver object for BlackTrax RTTrPM protocol that binds to a network port to receive data
@@ -73,12 +131,33 @@ private:
 
 	std::map<int, ChannelId>	m_beaconIdxToChannelMap;
 
+	static constexpr std::size_t						s_maxTrackableChannelCacheSize = 1024;
+	CriticalSection										m_trackableChannelCacheLock;
+	std::map<std::string, ChannelId, std::less<>>		m_trackableChannelCache;	/**< The resolved channel per trackable name, to not parse and remap the name for every packet. */
+	RemoteObjectAddressing								m_visitedTrackableAddr;		/**< The addressing of the trackable whose sub-modules currently are visited. */
+
+	static constexpr double								s_maxFiniteDifferenceIntervalMs = 500.0;	/**< Positions older than this are not used to derive a velocity. */
+	int													m_predictionLookAheadMs{ 0 };	/**< The time positions are extrapolated forward by, to compensate the latency. 0 disables prediction. */
+	std::map<ChannelId, PredictionState>				m_predictionStates;
+	juce::Point<float>									m_visitedPosition;				/**< The position of the visited trackable, held until its end when predicting. */
+	bool												m_visitedPositionValid{ false };
+	juce::Point<float>									m_visitedVelocity;				/**< The velocity of the visited trackable, if it comes with an acceleration and velocity module. */
+	juce::Point<float>									m_visitedAcceleration;			/**< The acceleration of the visited trackable, if it comes with an acceleration and velocity module. */
+	bool												m_visitedMotionValid{ false };
+
+	std::unique_ptr<PositionBatch>	m_positionBatch;	/**< The positions of the packet currently visited, forwarded once the packet is completely visited. */
+
 	juce::Point<float>	m_absoluteOriginOffset{ 0.0f, 1.0f };
 
 	bool	m_xyAxisSwapped{ false };
 	float	m_xAxisInversionFactor{ 1.0f };
 	float	m_yAxisInversionFactor{ 1.0f };
 
+	int												m_outputRate{ 0 };				/**< The maximum rate in Hz at which positions are forwarded per trackable. 0 forwards every received position. */
+	bool											m_outputRateAveraging{ false };	/**< Indicator if positions received in between two forwardings are averaged instead of only forwarding the latest. */
+	CriticalSection									m_rateLimitedPositionsLock;
+	std::map<RemoteObject, RateLimitedPosition>		m_rateLimitedPositions;
+
 	float m_floatValueBuffer[3] = { 0.0f, 0.0f, 0.0f };
 	int m_intValueBuffer[2] = { 0, 0 };
 
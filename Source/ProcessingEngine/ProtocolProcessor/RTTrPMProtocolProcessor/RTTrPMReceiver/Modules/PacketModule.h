@@ -26,7 +26,7 @@
 // class PacketModule 
 // **************************************************************
 /**
-* A class to save the basic packet module information
+* A class to hold the RTTrPM packet module type definitions
 */
 class PacketModule
 {
@@ -43,20 +43,4 @@ public:
 	static constexpr PacketModuleType TrackedPointAccelerationAndVelocity	= 0x21;
 	static constexpr PacketModuleType ZoneCollisionDetection				= 0x22;
 	static const inline std::vector<std::uint8_t>	PacketModuleTypes{ WithTimestamp, WithoutTimestamp, CentroidPosition, TrackedPointPosition, OrientationQuaternion, OrientationEuler, CentroidAccelerationAndVelocity, TrackedPointAccelerationAndVelocity, ZoneCollisionDetection };
-
-public:
-	PacketModule();
-	PacketModule(std::vector<unsigned char>& data, int & readPos);
-	virtual ~PacketModule();
-
-	virtual void readData(std::vector<unsigned char>& data, int& readPos);
-
-	PacketModuleType GetModuleType() const;
-	uint16_t GetModuleSize() const;
-
-	virtual bool isValid() const;
-
-private:
-	PacketModuleType	m_moduleType{ Invalid };	//	Type of the packet module
-	std::uint16_t			m_moduleSize{ 0 };	//	Size of the module
 };
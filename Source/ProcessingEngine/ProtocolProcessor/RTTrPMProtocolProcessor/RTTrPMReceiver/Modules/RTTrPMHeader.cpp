@@ -18,6 +18,8 @@
 
 #include "RTTrPMHeader.h"
 
+#include <cstring>
+
 #if defined (_WIN32) || defined (_WIN64)
 #include <Winsock2.h>
 #else
@@ -33,66 +35,50 @@ RTTrPMHeader::RTTrPMHeader()
 }
 
 /**
-* Constructor of the class RTTrPMHeader.
+* Reads the header in place from a raw data buffer, without copying the buffer.
 *
-* @param	data	Input byte data as vector reference.
-* @param	readPos	Reference variable which helps to know from which bytes the next modul read should beginn
+* @param	data		Pointer to the raw input byte data.
+* @param	dataSize	The number of bytes available in data.
+* @param	readPos		Reference variable which helps to know from which bytes the next modul read should beginn.
+*						Only advanced if the header could be read.
+* @return	True if the buffer contained enough data to read the header.
 */
-RTTrPMHeader::RTTrPMHeader(std::vector<unsigned char>& data, int& readPos)
-{
-	readData(data, readPos);
-}
-
-/**
- * Helper method to parse the input data vector starting at given read position.
- * @param data	The input data in a byte vector.
- * @param readPos	The position in the given vector where reading shall be started.
- */
-void RTTrPMHeader::readData(std::vector<unsigned char>& data, int& readPos)
+bool RTTrPMHeader::readData(const unsigned char* data, std::size_t dataSize, std::size_t& readPos)
 {
-	auto readIter = data.begin() + readPos;
-
-	std::copy(readIter, readIter + 2, (unsigned char*)&m_intSignature);
-	readIter += 2;
-	std::copy(readIter, readIter + 2, (unsigned char*)&m_floatSignature);
-	readIter += 2;
-
-	readPos += 4;
-
-	std::copy(readIter, readIter + 2, (unsigned char*)&m_version);
-	readIter += 2;
-	std::copy(readIter, readIter + 4, (unsigned char*)&m_packetID);
-	readIter += 4;
-	std::copy(readIter, readIter + 1, (unsigned char*)&m_packetFormat);
-	readIter += 1;
-	std::copy(readIter, readIter + 2, (unsigned char*)&m_packetSize);
-	readIter += 2;
-	std::copy(readIter, readIter + 4, (unsigned char*)&m_context);
-	readIter += 4;
-	std::copy(readIter, readIter + 1, (unsigned char*)&m_numModules);
-	readIter += 1;
-
-	readPos += 14;
-
-	if (IsLittleEndian())
+	if (data == nullptr || readPos > dataSize || dataSize - readPos < HeaderSize)
+		return false;
+
+	auto readPtr = data + readPos;
+
+	std::memcpy(&m_intSignature, readPtr, 2);
+	readPtr += 2;
+	std::memcpy(&m_floatSignature, readPtr, 2);
+	readPtr += 2;
+	std::memcpy(&m_version, readPtr, 2);
+	readPtr += 2;
+	std::memcpy(&m_packetID, readPtr, 4);
+	readPtr += 4;
+	std::memcpy(&m_packetFormat, readPtr, 1);
+	readPtr += 1;
+	std::memcpy(&m_packetSize, readPtr, 2);
+	readPtr += 2;
+	std::memcpy(&m_context, readPtr, 4);
+	readPtr += 4;
+	std::memcpy(&m_numModules, readPtr, 1);
+	readPtr += 1;
+
+	readPos += HeaderSize;
+
+	if (IsBigEndian())
 	{
-		// no conversion if little endian signature
-		return;
-	}
-	else if (IsBigEndian())
-	{
-		// conversion net to host if big endian
+		// conversion net to host if big endian, no conversion if little endian or unknown signatures
 		m_version = ntohs(m_version);
 		m_packetID = ntohl(m_packetID);
 		m_packetSize = ntohs(m_packetSize);
 		m_context = ntohl(m_context);
-		return;
-	}
-	else
-	{
-		// unknown signatures
-		return;
 	}
+
+	return true;
 }
 
 /**
@@ -18,8 +18,8 @@
 
 #pragma once
 
-#include <vector>
 #include <cstdint>
+#include <cstddef>
 
 
 // **************************************************************
@@ -33,6 +33,7 @@ class RTTrPMHeader
 {
 public:
 	static constexpr std::uint16_t PacketModuleHeaderVersion = 0x0002;
+	static constexpr std::size_t HeaderSize = 18;
 
 	typedef std::uint16_t PacketModuleSignature;
 	static constexpr PacketModuleSignature LittleEndianInt		= 0x4154;
@@ -47,10 +48,9 @@ public:
 
 public:
 	RTTrPMHeader();
-	RTTrPMHeader(std::vector<unsigned char>& data, int& readPos);
 	~RTTrPMHeader();
 
-	void readData(std::vector<unsigned char>& data, int& readPos);
+	bool readData(const unsigned char* data, std::size_t dataSize, std::size_t& readPos);
 
 	bool IsLittleEndian() const;
 	bool IsBigEndian() const;
@@ -0,0 +1,280 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "RTTrPMPacket.h"
+
+
+/**
+* Constructor of the RTTrPMPacket class
+*/
+RTTrPMPacket::RTTrPMPacket()
+{
+}
+
+/**
+* Destructor of the RTTrPMPacket class
+*/
+RTTrPMPacket::~RTTrPMPacket()
+{
+}
+
+/**
+* Decodes the header and all modules of a RTTrPM packet in place from the given buffer.
+* If the buffer is truncated or the packet exceeds the fixed capacity, decoding stops and
+* the trackables that were completely decoded up to that point remain available.
+* @param	data		Pointer to the raw received datagram.
+* @param	dataSize	The number of bytes received.
+* @return	True if the complete packet was decoded.
+*/
+bool RTTrPMPacket::Decode(const unsigned char* data, std::size_t dataSize)
+{
+	Clear();
+
+	auto readPos = std::size_t(0);
+	if (!m_header.readData(data, dataSize, readPos) || m_header.GetPacketSize() == 0)
+		return false;
+
+	auto packetModuleCount = m_header.GetNumberOfModules();
+	for (int i = 0; i < packetModuleCount; i++)
+	{
+		if (!DecodeTrackable(data, dataSize, readPos))
+			return false;
+	}
+
+	return true;
+}
+
+/**
+* Resets the packet to not contain any trackables. The capacity is kept.
+*/
+void RTTrPMPacket::Clear()
+{
+	m_header = RTTrPMHeader();
+	m_trackableCount = 0;
+	m_subModuleCount = 0;
+}
+
+/**
+* Returns the header of the last decoded packet
+* @return	The packet header
+*/
+const RTTrPMHeader& RTTrPMPacket::GetHeader() const
+{
+	return m_header;
+}
+
+/**
+* Returns the number of valid trackables of the last decoded packet
+* @return	The number of trackables
+*/
+int RTTrPMPacket::GetTrackableCount() const
+{
+	return m_trackableCount;
+}
+
+/**
+* Returns a decoded trackable
+* @param	index	The index of the trackable, in range 0 to GetTrackableCount()
+* @return	The trackable
+*/
+const RTTrPMPacket::Trackable& RTTrPMPacket::GetTrackable(int index) const
+{
+	return m_trackables[static_cast<std::size_t>(index)];
+}
+
+/**
+* Returns the number of valid sub-modules of all trackables of the last decoded packet
+* @return	The number of sub-modules
+*/
+int RTTrPMPacket::GetSubModuleCount() const
+{
+	return m_subModuleCount;
+}
+
+/**
+* Returns a decoded sub-module
+* @param	index	The index of the sub-module, in range 0 to GetSubModuleCount()
+* @return	The sub-module
+*/
+const RTTrPMPacket::SubModule& RTTrPMPacket::GetSubModule(int index) const
+{
+	return m_subModules[static_cast<std::size_t>(index)];
+}
+
+/**
+* Decodes a trackable module and all its sub-modules.
+* Trackables and sub-modules that are not valid are skipped.
+* @param	data		Pointer to the raw received datagram.
+* @param	dataSize	The number of bytes received.
+* @param	readPos		The position to read from, advanced by the size of the decoded modules.
+* @return	True if the trackable was decoded and decoding can continue.
+*/
+bool RTTrPMPacket::DecodeTrackable(const unsigned char* data, std::size_t dataSize, std::size_t& readPos)
+{
+	auto trackable = Trackable();
+	if (!Read(data, dataSize, readPos, trackable.type) || !Read(data, dataSize, readPos, trackable.size))
+		return false;
+
+	auto nameLength = std::uint8_t(0);
+	if (!Read(data, dataSize, readPos, nameLength) || dataSize - readPos < nameLength)
+		return false;
+	trackable.name = std::string_view(reinterpret_cast<const char*>(data + readPos), nameLength);
+	readPos += nameLength;
+
+	if (trackable.type == PacketModule::WithTimestamp)
+	{
+		if (!Read(data, dataSize, readPos, trackable.seqNumber))
+			return false;
+	}
+	else if (trackable.type != PacketModule::WithoutTimestamp)
+		return false; // without knowing the layout, the following data cannot be interpreted
+
+	if (!Read(data, dataSize, readPos, trackable.numberOfSubModules))
+		return false;
+
+	trackable.firstSubModuleIndex = m_subModuleCount;
+	for (int j = 0; j < trackable.numberOfSubModules; j++)
+	{
+		if (m_subModuleCount >= MaxSubModules)
+			return false;
+
+		auto& subModule = m_subModules[static_cast<std::size_t>(m_subModuleCount)];
+		if (!DecodeSubModule(data, dataSize, readPos, subModule))
+			return false;
+
+		if (subModule.size > 0 && subModule.type != PacketModule::Invalid)
+			m_subModuleCount++;
+	}
+	trackable.subModuleCount = m_subModuleCount - trackable.firstSubModuleIndex;
+
+	if (trackable.size > 0)
+	{
+		if (m_trackableCount >= MaxTrackables)
+			return false;
+		m_trackables[static_cast<std::size_t>(m_trackableCount++)] = trackable;
+	}
+	else
+		m_subModuleCount = trackable.firstSubModuleIndex; // drop the sub-modules of an invalid trackable
+
+	return true;
+}
+
+/**
+* Decodes a single sub-module of a trackable.
+* Sub-modules of unknown type are skipped by their size and marked invalid.
+* @param	data		Pointer to the raw received datagram.
+* @param	dataSize	The number of bytes received.
+* @param	readPos		The position to read from, advanced by the size of the decoded module.
+* @param	subModule	The sub-module to decode into.
+* @return	True if the sub-module was decoded and decoding can continue.
+*/
+bool RTTrPMPacket::DecodeSubModule(const unsigned char* data, std::size_t dataSize, std::size_t& readPos, SubModule& subModule)
+{
+	auto moduleStartPos = readPos;
+	if (!Read(data, dataSize, readPos, subModule.type) || !Read(data, dataSize, readPos, subModule.size))
+		return false;
+
+	switch (subModule.type)
+	{
+	case PacketModule::CentroidPosition:
+		{
+			auto& m = subModule.centroidPosition;
+			return Read(data, dataSize, readPos, m.latency)
+				&& Read(data, dataSize, readPos, m.x)
+				&& Read(data, dataSize, readPos, m.y)
+				&& Read(data, dataSize, readPos, m.z);
+		}
+	case PacketModule::TrackedPointPosition:
+		{
+			auto& m = subModule.trackedPointPosition;
+			return Read(data, dataSize, readPos, m.latency)
+				&& Read(data, dataSize, readPos, m.x)
+				&& Read(data, dataSize, readPos, m.y)
+				&& Read(data, dataSize, readPos, m.z)
+				&& Read(data, dataSize, readPos, m.pointIndex);
+		}
+	case PacketModule::OrientationQuaternion:
+		{
+			auto& m = subModule.orientationQuaternion;
+			return Read(data, dataSize, readPos, m.latency)
+				&& Read(data, dataSize, readPos, m.qx)
+				&& Read(data, dataSize, readPos, m.qy)
+				&& Read(data, dataSize, readPos, m.qz)
+				&& Read(data, dataSize, readPos, m.qw);
+		}
+	case PacketModule::OrientationEuler:
+		{
+			auto& m = subModule.orientationEuler;
+			return Read(data, dataSize, readPos, m.latency)
+				&& Read(data, dataSize, readPos, m.order)
+				&& Read(data, dataSize, readPos, m.r1)
+				&& Read(data, dataSize, readPos, m.r2)
+				&& Read(data, dataSize, readPos, m.r3);
+		}
+	case PacketModule::CentroidAccelerationAndVelocity:
+	case PacketModule::TrackedPointAccelerationAndVelocity:
+		{
+			auto& m = subModule.accelerationAndVelocity;
+			m.pointIndex = 0;
+			auto success = Read(data, dataSize, readPos, m.x)
+				&& Read(data, dataSize, readPos, m.y)
+				&& Read(data, dataSize, readPos, m.z)
+				&& Read(data, dataSize, readPos, m.accelerationX)
+				&& Read(data, dataSize, readPos, m.accelerationY)
+				&& Read(data, dataSize, readPos, m.accelerationZ)
+				&& Read(data, dataSize, readPos, m.velocityX)
+				&& Read(data, dataSize, readPos, m.velocityY)
+				&& Read(data, dataSize, readPos, m.velocityZ);
+			if (success && subModule.type == PacketModule::TrackedPointAccelerationAndVelocity)
+				success = Read(data, dataSize, readPos, m.pointIndex);
+			return success;
+		}
+	case PacketModule::ZoneCollisionDetection:
+		{
+			auto& m = subModule.zoneCollisionDetection;
+			if (!Read(data, dataSize, readPos, m.numberOfZoneSubModules))
+				return false;
+
+			// the zone sub-modules are not used, so only skip them
+			for (int i = 1; i < m.numberOfZoneSubModules; ++i) // we start at 1 because the read num of submods includes this base module
+			{
+				auto zoneType = PacketModule::PacketModuleType(0);
+				auto zoneModuleSize = std::uint16_t(0);
+				auto zoneSize = std::uint8_t(0);
+				auto zoneNameLength = std::uint8_t(0);
+				if (!Read(data, dataSize, readPos, zoneType)
+					|| !Read(data, dataSize, readPos, zoneModuleSize)
+					|| !Read(data, dataSize, readPos, zoneSize)
+					|| !Read(data, dataSize, readPos, zoneNameLength)
+					|| dataSize - readPos < zoneNameLength)
+					return false;
+				readPos += zoneNameLength;
+			}
+			return true;
+		}
+	default:
+		{
+			// skip unknown modules by their size, that includes the type and size fields
+			if (subModule.size < 3 || moduleStartPos + subModule.size > dataSize)
+				return false;
+			readPos = moduleStartPos + subModule.size;
+			subModule.type = PacketModule::Invalid;
+			return true;
+		}
+	}
+}
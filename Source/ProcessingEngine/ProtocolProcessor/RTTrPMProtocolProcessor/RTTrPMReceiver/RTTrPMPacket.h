@@ -0,0 +1,176 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include "Modules/RTTrPMHeader.h"
+#include "Modules/PacketModule.h"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+
+// **************************************************************
+// class RTTrPMPacket
+// **************************************************************
+/**
+ * A fixed capacity representation of a decoded RTTrPM packet.
+ * The header and all modules are decoded in place from the receive buffer,
+ * without copying the buffer and without any heap allocation. Trackable names
+ * are views into the decoded buffer, so they are only valid as long as that buffer is.
+ */
+class RTTrPMPacket
+{
+public:
+	static constexpr int MaxTrackables	= 255;	/**< The RTTrPM header holds the trackable count as 8bit value. */
+	static constexpr int MaxSubModules	= 2048;	/**< Sufficient for all trackables of a maximum size datagram to carry several position modules each. */
+
+	//==============================================================================
+	struct CentroidPosition
+	{
+		std::uint16_t	latency;
+		double			x;
+		double			y;
+		double			z;
+	};
+
+	struct TrackedPointPosition
+	{
+		std::uint16_t	latency;
+		double			x;
+		double			y;
+		double			z;
+		std::uint8_t	pointIndex;
+	};
+
+	struct OrientationQuaternion
+	{
+		std::uint16_t	latency;
+		double			qx;
+		double			qy;
+		double			qz;
+		double			qw;
+	};
+
+	struct OrientationEuler
+	{
+		std::uint16_t	latency;
+		std::uint16_t	order;
+		double			r1;
+		double			r2;
+		double			r3;
+	};
+
+	struct AccelerationAndVelocity
+	{
+		double			x;
+		double			y;
+		double			z;
+		float			accelerationX;
+		float			accelerationY;
+		float			accelerationZ;
+		float			velocityX;
+		float			velocityY;
+		float			velocityZ;
+		std::uint8_t	pointIndex;	/**< Only used for tracked point modules. */
+	};
+
+	struct ZoneCollisionDetection
+	{
+		std::uint8_t	numberOfZoneSubModules;
+	};
+
+	/**
+	 * A decoded sub-module of a trackable. The module type tags which of the data members is valid.
+	 */
+	struct SubModule
+	{
+		PacketModule::PacketModuleType	type{ PacketModule::Invalid };
+		std::uint16_t					size{ 0 };
+		union
+		{
+			CentroidPosition		centroidPosition;
+			TrackedPointPosition	trackedPointPosition;
+			OrientationQuaternion	orientationQuaternion;
+			OrientationEuler		orientationEuler;
+			AccelerationAndVelocity	accelerationAndVelocity;
+			ZoneCollisionDetection	zoneCollisionDetection;
+		};
+	};
+
+	/**
+	 * A decoded trackable module, referring to the range of its sub-modules within the packet.
+	 */
+	struct Trackable
+	{
+		PacketModule::PacketModuleType	type{ PacketModule::Invalid };
+		std::uint16_t					size{ 0 };
+		std::string_view				name;
+		std::uint32_t					seqNumber{ 0 };
+		std::uint8_t					numberOfSubModules{ 0 };
+		int								firstSubModuleIndex{ 0 };
+		int								subModuleCount{ 0 };
+	};
+
+public:
+	RTTrPMPacket();
+	~RTTrPMPacket();
+
+	//==============================================================================
+	bool Decode(const unsigned char* data, std::size_t dataSize);
+	void Clear();
+
+	//==============================================================================
+	const RTTrPMHeader& GetHeader() const;
+	int GetTrackableCount() const;
+	const Trackable& GetTrackable(int index) const;
+	int GetSubModuleCount() const;
+	const SubModule& GetSubModule(int index) const;
+
+private:
+	//==============================================================================
+	bool DecodeTrackable(const unsigned char* data, std::size_t dataSize, std::size_t& readPos);
+	bool DecodeSubModule(const unsigned char* data, std::size_t dataSize, std::size_t& readPos, SubModule& subModule);
+
+	/**
+	 * Helper to read a value from the buffer with bounds checking.
+	 * @param	data		Pointer to the raw input byte data.
+	 * @param	dataSize	The number of bytes available in data.
+	 * @param	readPos		The position to read from, advanced by the size of the value on success.
+	 * @param	value		The value to read into.
+	 * @return	True if the buffer contained enough data to read the value.
+	 */
+	template <typename T>
+	static bool Read(const unsigned char* data, std::size_t dataSize, std::size_t& readPos, T& value)
+	{
+		if (readPos > dataSize || dataSize - readPos < sizeof(T))
+			return false;
+		std::memcpy(&value, data + readPos, sizeof(T));
+		readPos += sizeof(T);
+		return true;
+	}
+
+	//==============================================================================
+	RTTrPMHeader							m_header;
+	std::array<Trackable, MaxTrackables>	m_trackables;
+	int										m_trackableCount{ 0 };
+	std::array<SubModule, MaxSubModules>	m_subModules;
+	int										m_subModuleCount{ 0 };
+};
@@ -18,8 +18,6 @@
 
 #include "RTTrPMReceiver.h"
 
-#include "Modules/RTTrPMHeader.h"
-
 
 /**
 * Constructor of the RTTrPMReceiver class
@@ -30,6 +28,9 @@ RTTrPMReceiver::RTTrPMReceiver(int portNumber)
 	  m_listeningPort(portNumber)
 {
 	m_socket = std::make_unique<DatagramSocket>();
+
+	m_receivedPacket = std::make_unique<RTTrPMPacket>();
+	m_freePackets.push_back(std::make_unique<RTTrPMPacket>());
 }
 
 /**
@@ -102,67 +103,68 @@ void RTTrPMReceiver::removeListener(RTTrPMReceiver::RealtimeDataListener* listen
 }
 
 /**
-* Reads all packet modules and sorts them within the CCentroidMod class, saves all modules into packetModules vector
-* @param	dataBuffer		: An array which keeps the caught data information.
-* @param	bytesRead		: Keeps the number of read bytes
-* @param	packetModules	: Module vector that is filled with the modules read from the buffer
-*
-* @return	Returns the count of packet modules read into given target module content vector
-*/
-int RTTrPMReceiver::HandleBuffer(unsigned char* dataBuffer, size_t bytesRead, RTTrPMMessage& decodedMessage)
+ * Dispatches all trackables and their sub-modules of a decoded packet to the type specific visitor methods.
+ * @param packet	The decoded packet to visit.
+ * @param visitor	The visitor to call for each module.
+ */
+void RTTrPMReceiver::VisitPacket(const RTTrPMPacket& packet, RTTrPMReceiver::ModuleVisitor& visitor)
 {
-	std::vector<unsigned char> data(dataBuffer, dataBuffer + bytesRead);
-	int readPos = 0;
-
-	auto& header = decodedMessage.header;
-	auto& packetModules = decodedMessage.modules;
-
-	header = RTTrPMHeader(data, readPos);					
-
-	if(readPos == 0 || header.GetPacketSize() == 0)
-		return 0;
-
-	auto packetModuleCount = header.GetNumberOfModules();
-	for (int i = 0; i < packetModuleCount; i++)
+	for (int i = 0; i < packet.GetTrackableCount(); i++)
 	{
-		packetModules.push_back(std::make_unique<PacketModuleTrackable>(data, readPos));
+		auto const& trackable = packet.GetTrackable(i);
+		visitor.VisitTrackable(trackable);
 
-		auto trackableSubModuleCount = dynamic_cast<PacketModuleTrackable*>(packetModules.back().get())->GetNumberOfSubModules();
-		for (int j = 0; j < trackableSubModuleCount; j++)
+		for (int j = trackable.firstSubModuleIndex; j < trackable.firstSubModuleIndex + trackable.subModuleCount; j++)
 		{
-			auto metaInfoReadPos = readPos;
-			PacketModule packetModuleMetaInfo(data, metaInfoReadPos);
-			
-			switch(packetModuleMetaInfo.GetModuleType())				
+			auto const& subModule = packet.GetSubModule(j);
+			switch (subModule.type)
 			{
-				case PacketModule::CentroidPosition:
-					packetModules.push_back(std::make_unique<CentroidPositionModule>(data, readPos));
-					break;
-				case PacketModule::CentroidAccelerationAndVelocity:
-					packetModules.push_back(std::make_unique<CentroidAccelAndVeloModule>(data, readPos));
-					break;
-				case PacketModule::TrackedPointPosition:
-					packetModules.push_back(std::make_unique<TrackedPointPositionModule>(data, readPos));
-					break;
-				case PacketModule::TrackedPointAccelerationAndVelocity:
-					packetModules.push_back(std::make_unique<TrackedPointAccelAndVeloModule>(data, readPos));
-					break;
-				case PacketModule::OrientationQuaternion:
-					packetModules.push_back(std::make_unique<OrientationQuaternionModule>(data, readPos));
-					break;
-				case PacketModule::OrientationEuler:
-					packetModules.push_back(std::make_unique<OrientationEulerModule>(data, readPos));
-					break;
-				case PacketModule::ZoneCollisionDetection:
-					packetModules.push_back(std::make_unique<ZoneCollisionDetectionModule>(data, readPos));
-					break;
-				default:
-					break;
+			case PacketModule::CentroidPosition:
+				visitor.VisitCentroidPosition(subModule.centroidPosition);
+				break;
+			case PacketModule::TrackedPointPosition:
+				visitor.VisitTrackedPointPosition(subModule.trackedPointPosition);
+				break;
+			case PacketModule::CentroidAccelerationAndVelocity:
+				visitor.VisitCentroidAccelerationAndVelocity(subModule.accelerationAndVelocity);
+				break;
+			case PacketModule::TrackedPointAccelerationAndVelocity:
+				visitor.VisitTrackedPointAccelerationAndVelocity(subModule.accelerationAndVelocity);
+				break;
+			case PacketModule::OrientationQuaternion:
+				visitor.VisitOrientationQuaternion(subModule.orientationQuaternion);
+				break;
+			case PacketModule::OrientationEuler:
+				visitor.VisitOrientationEuler(subModule.orientationEuler);
+				break;
+			case PacketModule::ZoneCollisionDetection:
+				visitor.VisitZoneCollisionDetection(subModule.zoneCollisionDetection);
+				break;
+			default:
+				break;
 			}
 		}
+
+		visitor.VisitTrackableEnd(trackable);
+	}
+}
+
+/**
+* Decodes the header and all packet modules in place from the receive buffer into the given preallocated packet.
+* @param	dataBuffer		: An array which keeps the caught data information.
+* @param	bytesRead		: Keeps the number of read bytes
+* @param	decodedPacket	: Packet that is filled with the header and modules read from the buffer
+*
+* @return	Returns the count of trackables read into the given packet
+*/
+int RTTrPMReceiver::HandleBuffer(const unsigned char* dataBuffer, size_t bytesRead, RTTrPMPacket& decodedPacket)
+{
+	if (!decodedPacket.Decode(dataBuffer, bytesRead))
+	{
+		DBG(String(__FUNCTION__) << " RTTrPM packet truncated or exceeding capacity, using " << decodedPacket.GetTrackableCount() << " completely decoded trackables");
 	}
 
-	return static_cast<int>(packetModules.size());
+	return decodedPacket.GetTrackableCount();
 }
 
 /**
@@ -171,7 +173,7 @@ int RTTrPMReceiver::HandleBuffer(unsigned char* dataBuffer, size_t bytesRead, RT
 */
 void RTTrPMReceiver::run()
 {
-	int bufferSize = 4096;
+	int bufferSize = 65535; // maximum udp datagram size, to not truncate packets with many trackables
 	HeapBlock<unsigned char> rttrpmBuffer(bufferSize);
 	String senderIPAddress;
 	int senderPortNumber;
@@ -192,15 +194,27 @@ void RTTrPMReceiver::run()
 
 		if(bytesRead >= 4)
 		{
-			RTTrPMMessage receivedMessage;
-			int moduleCount = HandleBuffer(rttrpmBuffer.getData(), bytesRead, receivedMessage);
-			if (moduleCount > 0)
+			if (!m_listeners.isEmpty())
+			{
+				// decode once from the copy of the datagram the posted message holds, for both kinds of listeners
+				auto callbackMessage = std::make_unique<CallbackMessage>(rttrpmBuffer.getData(), static_cast<size_t>(bytesRead), senderIPAddress, senderPortNumber, AcquirePacket());
+				auto& datagram = callbackMessage->contentRTTrPM;
+				int trackableCount = HandleBuffer(static_cast<const unsigned char*>(datagram.getData()), datagram.getSize(), *callbackMessage->decodedPacket);
+				if (trackableCount > 0)
+				{
+					if (!m_realtimeListeners.isEmpty())
+						callRealtimeListeners(*callbackMessage->decodedPacket, senderIPAddress, senderPortNumber);
+
+					postMessage(callbackMessage.release());
+				}
+				else
+					ReleasePacket(std::move(callbackMessage->decodedPacket));
+			}
+			else if (!m_realtimeListeners.isEmpty())
 			{
-				if (!m_realtimeListeners.isEmpty())
-					callRealtimeListeners(receivedMessage, senderIPAddress, senderPortNumber);
-				
-				if (!m_listeners.isEmpty())
-					postMessage(std::make_unique<CallbackMessage>(receivedMessage, senderIPAddress, senderPortNumber).release());
+				int trackableCount = HandleBuffer(rttrpmBuffer.getData(), static_cast<size_t>(bytesRead), *m_receivedPacket);
+				if (trackableCount > 0)
+					callRealtimeListeners(*m_receivedPacket, senderIPAddress, senderPortNumber);
 			}
 		}
 	}
@@ -230,6 +244,40 @@ bool RTTrPMReceiver::BeginWaitingForSocket(const int portNumber, const String &b
 	return false;
 }
 
+/**
+ * Helper to get a packet to decode a datagram into that is passed on with a posted message.
+ * Packets handed back after handling are reused, a new one is only allocated if all are in use.
+ * @return	The packet to decode into.
+ */
+std::unique_ptr<RTTrPMPacket> RTTrPMReceiver::AcquirePacket()
+{
+	{
+		const ScopedLock l(m_freePacketsLock);
+		if (!m_freePackets.empty())
+		{
+			auto packet = std::move(m_freePackets.back());
+			m_freePackets.pop_back();
+			return packet;
+		}
+	}
+
+	return std::make_unique<RTTrPMPacket>();
+}
+
+/**
+ * Helper to hand back a packet that is no longer used, to be reused for later datagrams.
+ * @param packet	The packet to hand back.
+ */
+void RTTrPMReceiver::ReleasePacket(std::unique_ptr<RTTrPMPacket> packet)
+{
+	if (!packet)
+		return;
+
+	const ScopedLock l(m_freePacketsLock);
+	if (m_freePackets.size() < static_cast<size_t>(s_maxFreePackets))
+		m_freePackets.push_back(std::move(packet));
+}
+
 /**
  * Reimplemented from MessageListener to handle messages posted to queue.
  * @param msg	The incoming message to handle
@@ -238,28 +286,32 @@ void RTTrPMReceiver::handleMessage(const Message& msg)
 {
 	if (auto* callbackMessage = dynamic_cast<const CallbackMessage*> (&msg))
 	{
-		callListeners(callbackMessage->contentRTTrPM, callbackMessage->senderIPAddress, callbackMessage->senderPort);
+		if (callbackMessage->decodedPacket)
+		{
+			callListeners(*callbackMessage->decodedPacket, callbackMessage->senderIPAddress, callbackMessage->senderPort);
+			ReleasePacket(std::move(callbackMessage->decodedPacket));
+		}
 	}
 }
 
 /**
  * Helper method that handles distributing given message data to all registered datamessage listeners.
- * @param contentMessage	The message to distribute.
+ * @param contentPacket	The packet to distribute.
  * @param senderIPAddress	The ip address the data message was received from.
  * @param senderPort		The port the data message was received from.
  */
-void RTTrPMReceiver::callListeners(const RTTrPMMessage& contentMessage, const String& senderIPAddress, const int& senderPort)
+void RTTrPMReceiver::callListeners(const RTTrPMPacket& contentPacket, const String& senderIPAddress, const int& senderPort)
 {
-	m_listeners.call([&](RTTrPMReceiver::DataListener& l) { l.RTTrPMModuleReceived(contentMessage, senderIPAddress, senderPort); });
+	m_listeners.call([&](RTTrPMReceiver::DataListener& l) { l.RTTrPMModuleReceived(contentPacket, senderIPAddress, senderPort); });
 }
 
 /**
  * Helper method that handles distributing given message data to all registered realtime datamessage listeners.
- * @param contentMessage	The message to distribute.
+ * @param contentPacket	The packet to distribute.
  * @param senderIPAddress	The ip address the data message was received from.
  * @param senderPort		The port the data message was received from.
  */
-void RTTrPMReceiver::callRealtimeListeners(const RTTrPMMessage& contentMessage, const String& senderIPAddress, const int& senderPort)
+void RTTrPMReceiver::callRealtimeListeners(const RTTrPMPacket& contentPacket, const String& senderIPAddress, const int& senderPort)
 {
-	m_realtimeListeners.call([&](RTTrPMReceiver::RealtimeDataListener& l) { l.RTTrPMModuleReceived(contentMessage, senderIPAddress, senderPort); });
+	m_realtimeListeners.call([&](RTTrPMReceiver::RealtimeDataListener& l) { l.RTTrPMModuleReceived(contentPacket, senderIPAddress, senderPort); });
 }
\ No newline at end of file
@@ -20,8 +20,7 @@
 
 #include <JuceHeader.h>
 
-#include "Modules/RTTrPMHeader.h"
-#include "Modules/PacketModules.h"
+#include "RTTrPMPacket.h"
 
 
 // **************************************************************
@@ -36,48 +35,30 @@ class RTTrPMReceiver : private Thread,
 	private MessageListener
 {
 public:
-	//==============================================================================
-	/**
-	 * Helper type that combindes RTTrPM header information
-	 * with list of content modules
-	 */
-	struct RTTrPMMessage
-	{
-		/**
-		 * Constructor with default initialization header and modules.
-		 */
-		RTTrPMMessage() : header(), modules() {}
-
-		RTTrPMHeader								header;
-		std::vector<std::unique_ptr<PacketModule>>	modules;
-	};
-
 	//==============================================================================
 	/**
 	 * Implementation of a RTTrPM message. This is designed similar to SenderAwareOSCReceiver::SAOPimpl 
 	 * that itself is taken from JUCEs' OSCReceiver::pimpl
+	 * The raw datagram is copied into the message and decoded once from that copy on the receive thread,
+	 * so the decoded packet, whose trackable names refer to the copy, is passed on with the message.
 	 */
 	struct CallbackMessage : public Message
 	{
 		/**
 		* Constructor with default initialization of sender ip and port.
 		*
-		* @param rttrpmModule	The rttrpm module data to use in this message.
+		* @param data		The raw rttrpm datagram to use in this message.
+		* @param dataSize	The size of the raw rttrpm datagram.
+		* @param sndIP		The sender ip of this message.
+		* @param sndPort	The port this message was received on.
+		* @param packet		The preallocated packet to decode the datagram into.
 		*/
-		CallbackMessage(RTTrPMMessage& rttrpmMessage) : contentRTTrPM(std::move(rttrpmMessage)), senderIPAddress(String()), senderPort(0) {}
+		CallbackMessage(const unsigned char* data, size_t dataSize, String sndIP, int sndPort, std::unique_ptr<RTTrPMPacket> packet) : contentRTTrPM(data, dataSize), decodedPacket(std::move(packet)), senderIPAddress(sndIP), senderPort(sndPort) {}
 
-		/**
-		* Constructor with default initialization of sender ip and port.
-		*
-		* @param rttrpmModule	The rttrpm module data to use in this message.
-		* @param sndIP	The sender ip of this message.
-		* @param sndPort The port this message was received on.
-		*/
-		CallbackMessage(RTTrPMMessage& rttrpmMessage, String sndIP, int sndPort) : contentRTTrPM(std::move(rttrpmMessage)), senderIPAddress(sndIP), senderPort(sndPort) {}
-
-		RTTrPMMessage	contentRTTrPM;		/**< The payload of the message. */
-		String			senderIPAddress;	/**< The sender ip address from whom the message was received. */
-		int				senderPort;			/**< The sender port from where the message was received. */
+		MemoryBlock								contentRTTrPM;		/**< The raw datagram of the message. */
+		mutable std::unique_ptr<RTTrPMPacket>	decodedPacket;		/**< The packet decoded from the raw datagram. Mutable to be handed back to the receiver's free packets after handling. */
+		String									senderIPAddress;	/**< The sender ip address from whom the message was received. */
+		int										senderPort;			/**< The sender port from where the message was received. */
 	};
 	
 	//==============================================================================
@@ -91,7 +72,7 @@ public:
 		virtual ~DataListener() = default;
 
 		/** Called when the RTTrPMReceiver receives new RTTrPM module(s). */
-		virtual void RTTrPMModuleReceived(const RTTrPMMessage& module, const String& senderIPAddress, const int& senderPort) = 0;
+		virtual void RTTrPMModuleReceived(const RTTrPMPacket& packet, const String& senderIPAddress, const int& senderPort) = 0;
 	};
 
 	//==============================================================================
@@ -105,7 +86,30 @@ public:
 		virtual ~RealtimeDataListener() = default;
 
 		/** Called when the RTTrPMReceiver receives new RTTrPM module(s). */
-		virtual void RTTrPMModuleReceived(const RTTrPMMessage& module, const String& senderIPAddress, const int& senderPort) = 0;
+		virtual void RTTrPMModuleReceived(const RTTrPMPacket& packet, const String& senderIPAddress, const int& senderPort) = 0;
+	};
+
+	//==============================================================================
+	/**
+	 * A class for type dispatched handling of the modules of a decoded RTTrPM packet.
+	 * Each trackable is visited before its sub-modules and its end is visited after them,
+	 * unhandled module types can be left to the default empty implementation.
+	 */
+	class ModuleVisitor
+	{
+	public:
+		/** Destructor. */
+		virtual ~ModuleVisitor() = default;
+
+		virtual void VisitTrackable(const RTTrPMPacket::Trackable& trackable) { ignoreUnused(trackable); }
+		virtual void VisitCentroidPosition(const RTTrPMPacket::CentroidPosition& module) { ignoreUnused(module); }
+		virtual void VisitTrackedPointPosition(const RTTrPMPacket::TrackedPointPosition& module) { ignoreUnused(module); }
+		virtual void VisitCentroidAccelerationAndVelocity(const RTTrPMPacket::AccelerationAndVelocity& module) { ignoreUnused(module); }
+		virtual void VisitTrackedPointAccelerationAndVelocity(const RTTrPMPacket::AccelerationAndVelocity& module) { ignoreUnused(module); }
+		virtual void VisitOrientationQuaternion(const RTTrPMPacket::OrientationQuaternion& module) { ignoreUnused(module); }
+		virtual void VisitOrientationEuler(const RTTrPMPacket::OrientationEuler& module) { ignoreUnused(module); }
+		virtual void VisitZoneCollisionDetection(const RTTrPMPacket::ZoneCollisionDetection& module) { ignoreUnused(module); }
+		virtual void VisitTrackableEnd(const RTTrPMPacket::Trackable& trackable) { ignoreUnused(trackable); }
 	};
 
 public:
@@ -122,21 +126,35 @@ public:
 	void removeListener(RTTrPMReceiver::DataListener* listenerToRemove);
 	void removeListener(RTTrPMReceiver::RealtimeDataListener* listenerToRemove);
 
+	//==============================================================================
+	static void VisitPacket(const RTTrPMPacket& packet, RTTrPMReceiver::ModuleVisitor& visitor);
+
 private:
 	//==============================================================================
 	bool BeginWaitingForSocket(const int portNumber, const String &bindAddress = String());
 
 	void run() override;
-	int HandleBuffer(unsigned char* dataBuffer, size_t bytesRead, RTTrPMMessage& decodedMessage);
+	int HandleBuffer(const unsigned char* dataBuffer, size_t bytesRead, RTTrPMPacket& decodedPacket);
+
+	//==============================================================================
+	std::unique_ptr<RTTrPMPacket> AcquirePacket();
+	void ReleasePacket(std::unique_ptr<RTTrPMPacket> packet);
 
 	//==============================================================================
 	void handleMessage(const Message& msg) override;
-	void callListeners(const RTTrPMMessage& content, const String& senderIPAddress, const int& senderPort);
-	void callRealtimeListeners(const RTTrPMMessage& content, const String& senderIPAddress, const int& senderPort);
+	void callListeners(const RTTrPMPacket& content, const String& senderIPAddress, const int& senderPort);
+	void callRealtimeListeners(const RTTrPMPacket& content, const String& senderIPAddress, const int& senderPort);
 
 	//==============================================================================
 	std::unique_ptr<DatagramSocket>	m_socket;
 
+	//==============================================================================
+	std::unique_ptr<RTTrPMPacket>				m_receivedPacket;	/**< Preallocated packet the receive thread decodes into, if no messages are posted. */
+	CriticalSection								m_freePacketsLock;	/**< Lock to guard the free packets, that are acquired on the receive thread and released on the message thread. */
+	std::vector<std::unique_ptr<RTTrPMPacket>>	m_freePackets;		/**< Packets that were handed back after the posted messages carrying them were handled, to be reused. */
+
+	static constexpr int s_maxFreePackets = 4;	/**< The maximum number of free packets kept for reuse, further ones are deleted. */
+
 	//==============================================================================
 	int													m_listeningPort{ 0 };
 	ListenerList<RTTrPMReceiver::DataListener>			m_listeners;
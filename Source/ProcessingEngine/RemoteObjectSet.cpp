@@ -0,0 +1,117 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "RemoteObjectSet.h"
+
+#include <algorithm>
+
+
+// **************************************************************************************
+//    class RemoteObjectSet
+// **************************************************************************************
+
+/**
+ * Constructor of class RemoteObjectSet, creating an empty set.
+ */
+RemoteObjectSet::RemoteObjectSet()
+{
+}
+
+/**
+ * Constructor of class RemoteObjectSet, indexing the given objects.
+ * @param objects	The objects the set shall contain.
+ */
+RemoteObjectSet::RemoteObjectSet(const std::vector<RemoteObject>& objects)
+	: m_objects(objects)
+{
+	for (auto const& object : m_objects)
+	{
+		auto objectIdIndex = static_cast<int>(object._Id);
+		auto denseIndex = GetDenseIndex(object._Addr);
+		if (objectIdIndex >= 0 && objectIdIndex <= ROI_InvalidMAX && denseIndex >= 0)
+		{
+			auto& bits = m_denseObjects[objectIdIndex];
+			if (bits.empty())
+				bits.resize((s_denseIndexCount + 63) / 64, 0);
+			bits[denseIndex / 64] |= (std::uint64_t(1) << (denseIndex % 64));
+		}
+		else
+		{
+			m_sparseObjects.push_back(object);
+		}
+	}
+
+	std::sort(m_sparseObjects.begin(), m_sparseObjects.end());
+}
+
+/**
+ * Destructor
+ */
+RemoteObjectSet::~RemoteObjectSet()
+{
+}
+
+/**
+ * Method to check if an object is contained in the set.
+ * @param object	The object to look for.
+ * @return	True if the object is contained, false if not.
+ */
+bool RemoteObjectSet::Contains(const RemoteObject& object) const
+{
+	auto objectIdIndex = static_cast<int>(object._Id);
+	auto denseIndex = GetDenseIndex(object._Addr);
+	if (objectIdIndex >= 0 && objectIdIndex <= ROI_InvalidMAX && denseIndex >= 0)
+	{
+		auto const& bits = m_denseObjects[objectIdIndex];
+		return !bits.empty() && (bits[denseIndex / 64] & (std::uint64_t(1) << (denseIndex % 64))) != 0;
+	}
+
+	return !m_sparseObjects.empty() && std::binary_search(m_sparseObjects.begin(), m_sparseObjects.end(), object);
+}
+
+/**
+ * Getter for the empty state of the set.
+ * @return	True if the set does not contain any objects.
+ */
+bool RemoteObjectSet::IsEmpty() const
+{
+	return m_objects.empty();
+}
+
+/**
+ * Getter for the objects contained in the set, in the order they were given.
+ * @return	The objects contained in the set.
+ */
+const std::vector<RemoteObject>& RemoteObjectSet::GetObjects() const
+{
+	return m_objects;
+}
+
+/**
+ * Helper to get the bit index of an addressing in the per object id bitsets.
+ * @param addressing	The addressing to get the index for.
+ * @return	The bit index or -1 if the addressing is beyond the dense range.
+ */
+int RemoteObjectSet::GetDenseIndex(const RemoteObjectAddressing& addressing)
+{
+	if (addressing._first < INVALID_ADDRESS_VALUE || addressing._first > s_maxDenseChannel
+		|| addressing._second < INVALID_ADDRESS_VALUE || addressing._second > s_maxDenseRecord)
+		return -1;
+
+	return (addressing._first + 1) * (s_maxDenseRecord + 2) + (addressing._second + 1);
+}
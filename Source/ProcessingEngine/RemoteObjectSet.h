@@ -0,0 +1,54 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include "../RemoteProtocolBridgeCommon.h"
+
+#include <array>
+#include <vector>
+
+/**
+ * Class RemoteObjectSet is an immutable set of remote objects with constant time membership lookup.
+ * Objects are indexed in a bitset per object id, keyed by channel and record, only objects with
+ * addressing beyond the dense range fall back to a binary search in a sorted list.
+ * Since the set is never modified after construction, it can be shared between threads
+ * and replaced as a whole by swapping the pointer to it.
+ */
+class RemoteObjectSet
+{
+public:
+	RemoteObjectSet();
+	explicit RemoteObjectSet(const std::vector<RemoteObject>& objects);
+	~RemoteObjectSet();
+
+	bool Contains(const RemoteObject& object) const;
+	bool IsEmpty() const;
+	const std::vector<RemoteObject>& GetObjects() const;
+
+private:
+	static int GetDenseIndex(const RemoteObjectAddressing& addressing);
+
+	static constexpr int s_maxDenseChannel = 128;		/**< The highest channel (first address value) covered by the bitsets, matching the DS100 input count. */
+	static constexpr int s_maxDenseRecord = 16;			/**< The highest record (second address value) covered by the bitsets. */
+	static constexpr int s_denseIndexCount = (s_maxDenseChannel + 2) * (s_maxDenseRecord + 2);	/**< The number of bits per object id, including INVALID_ADDRESS_VALUE for both address values. */
+
+	std::vector<RemoteObject>										m_objects;			/**< The objects in the order they were given. */
+	std::array<std::vector<std::uint64_t>, ROI_InvalidMAX + 1>		m_denseObjects;		/**< The bitset per object id, only allocated for object ids contained in the set. */
+	std::vector<RemoteObject>										m_sparseObjects;	/**< The sorted objects with addressing beyond the dense range. */
+};
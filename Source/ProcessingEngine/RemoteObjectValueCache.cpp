@@ -46,7 +46,37 @@ RemoteObjectValueCache::~RemoteObjectValueCache()
  */
 void RemoteObjectValueCache::Clear()
 {
+	const ScopedLock l(m_cachedValuesLock);
 	m_cachedValues.clear();
+	m_cachedValuesSnapshotIsDirty = true;
+}
+
+/**
+ * Helper to look up the cached value of a given remote object. The lock has to be held by the caller.
+ * @param	ro	The remote object to look up
+ * @return	The cached value or nullptr if none is cached.
+ */
+const RemoteObjectMessageData* RemoteObjectValueCache::FindValue(const RemoteObject& ro) const
+{
+	auto cachedValueIter = m_cachedValues.find(ro);
+	if (cachedValueIter == m_cachedValues.end())
+		return nullptr;
+
+	return cachedValueIter->second.get();
+}
+
+/**
+ * Helper to replace a cached value with a new immutable copy of the given value. The value previously
+ * cached is not modified, since it may still be referenced by snapshots. The lock has to be held by the caller.
+ * @param	cachedValue	The cached value to replace
+ * @param	valueData	The value to copy to the cache
+ */
+void RemoteObjectValueCache::PublishValue(std::shared_ptr<const RemoteObjectMessageData>& cachedValue, const RemoteObjectMessageData& valueData)
+{
+	auto newValue = std::make_shared<RemoteObjectMessageData>();
+	newValue->payloadCopy(valueData);
+	cachedValue = std::move(newValue);
+	m_cachedValuesSnapshotIsDirty = true;
 }
 
 /**
@@ -56,7 +86,8 @@ void RemoteObjectValueCache::Clear()
  */
 bool RemoteObjectValueCache::Contains(const RemoteObject& ro) const
 {
-	if (m_cachedValues.count(ro) != 0)
+	const ScopedLock l(m_cachedValuesLock);
+	if (FindValue(ro) != nullptr)
 		return true;
 
 	DBG(String(__FUNCTION__) + " no value available for requested RO");
@@ -70,10 +101,12 @@ bool RemoteObjectValueCache::Contains(const RemoteObject& ro) const
  */
 int RemoteObjectValueCache::GetIntValue(const RemoteObject& ro) const
 {
-	if (m_cachedValues.count(ro) != 0)
+	const ScopedLock l(m_cachedValuesLock);
+	auto cachedValue = FindValue(ro);
+	if (cachedValue)
 	{
-		if (m_cachedValues.at(ro)._valType == ROVT_INT && m_cachedValues.at(ro)._valCount == 1 && m_cachedValues.at(ro)._payloadSize == sizeof(int))
-			return *static_cast<int*>(m_cachedValues.at(ro)._payload);
+		if (cachedValue->_valType == ROVT_INT && cachedValue->_valCount == 1 && cachedValue->_payloadSize == sizeof(int))
+			return *static_cast<int*>(cachedValue->_payload);
 		else
 			jassertfalse;
 	}
@@ -89,10 +122,12 @@ int RemoteObjectValueCache::GetIntValue(const RemoteObject& ro) const
  */
 float RemoteObjectValueCache::GetFloatValue(const RemoteObject& ro) const
 {
-	if (m_cachedValues.count(ro) != 0)
+	const ScopedLock l(m_cachedValuesLock);
+	auto cachedValue = FindValue(ro);
+	if (cachedValue)
 	{
-		if (m_cachedValues.at(ro)._valType == ROVT_FLOAT && m_cachedValues.at(ro)._valCount == 1 && m_cachedValues.at(ro)._payloadSize == sizeof(float))
-			return *static_cast<float*>(m_cachedValues.at(ro)._payload);
+		if (cachedValue->_valType == ROVT_FLOAT && cachedValue->_valCount == 1 && cachedValue->_payloadSize == sizeof(float))
+			return *static_cast<float*>(cachedValue->_payload);
 		else
 			jassertfalse;
 	}
@@ -108,10 +143,12 @@ float RemoteObjectValueCache::GetFloatValue(const RemoteObject& ro) const
  */
 std::tuple<float, float> RemoteObjectValueCache::GetDualFloatValues(const RemoteObject& ro) const
 {
-	if (m_cachedValues.count(ro) != 0)
+	const ScopedLock l(m_cachedValuesLock);
+	auto cachedValue = FindValue(ro);
+	if (cachedValue)
 	{
-		auto plptr = static_cast<float*>(m_cachedValues.at(ro)._payload);
-		if (m_cachedValues.at(ro)._valType == ROVT_FLOAT && m_cachedValues.at(ro)._valCount == 2 && m_cachedValues.at(ro)._payloadSize == 2 * sizeof(float))
+		auto plptr = static_cast<float*>(cachedValue->_payload);
+		if (cachedValue->_valType == ROVT_FLOAT && cachedValue->_valCount == 2 && cachedValue->_payloadSize == 2 * sizeof(float))
 			return { plptr[0], plptr[1] };
 		else
 			jassertfalse;
@@ -128,10 +165,12 @@ std::tuple<float, float> RemoteObjectValueCache::GetDualFloatValues(const Remote
  */
 std::tuple<float, float, float> RemoteObjectValueCache::GetTripleFloatValues(const RemoteObject& ro) const
 {
-	if (m_cachedValues.count(ro) != 0)
+	const ScopedLock l(m_cachedValuesLock);
+	auto cachedValue = FindValue(ro);
+	if (cachedValue)
 	{
-		auto plptr = static_cast<float*>(m_cachedValues.at(ro)._payload);
-		if (m_cachedValues.at(ro)._valType == ROVT_FLOAT && m_cachedValues.at(ro)._valCount == 3 && m_cachedValues.at(ro)._payloadSize == 3 * sizeof(float))
+		auto plptr = static_cast<float*>(cachedValue->_payload);
+		if (cachedValue->_valType == ROVT_FLOAT && cachedValue->_valCount == 3 && cachedValue->_payloadSize == 3 * sizeof(float))
 			return { plptr[0], plptr[1], plptr[2] };
 		else
 			jassertfalse;
@@ -148,10 +187,12 @@ std::tuple<float, float, float> RemoteObjectValueCache::GetTripleFloatValues(con
  */
 std::string RemoteObjectValueCache::GetStringValue(const RemoteObject& ro) const
 {
-	if (m_cachedValues.count(ro) != 0)
+	const ScopedLock l(m_cachedValuesLock);
+	auto cachedValue = FindValue(ro);
+	if (cachedValue)
 	{
-		if (m_cachedValues.at(ro)._valType == ROVT_STRING)
-			return std::string(static_cast<char*>(m_cachedValues.at(ro)._payload), m_cachedValues.at(ro)._payloadSize);
+		if (cachedValue->_valType == ROVT_STRING)
+			return std::string(static_cast<char*>(cachedValue->_payload), cachedValue->_payloadSize);
 		else
 			jassertfalse;
 	}
@@ -167,87 +208,129 @@ std::string RemoteObjectValueCache::GetStringValue(const RemoteObject& ro) const
  */
 void RemoteObjectValueCache::SetValue(const RemoteObject& ro, const RemoteObjectMessageData& valueData)
 {
-	m_cachedValues[ro].payloadCopy(valueData);
-
-//#ifdef DEBUG
-//	DbgPrintCacheContent();
-//#endif
-
-//	#ifdef DEBUG
-//		auto val = m_cachedValues[ro];
-//		auto valString = juce::String();
-//	
-//		switch (val._valType)
-//		{
-//		case ROVT_FLOAT:
-//		{
-//			jassert(val._valCount * sizeof(float) == val._payloadSize);
-//			auto p = static_cast<float*>(val._payload);
-//			for (auto i = 0; i < val._valCount; i++)
-//				valString += String(*(p + i)) + ";";
-//		}
-//		break;
-//		default:
-//			break;
-//		}
-//	
-//		DBG(juce::String(__FUNCTION__) << " " << ro._Id << " (" << static_cast<int>(ro._Addr._first) << "," << static_cast<int>(ro._Addr._second) << ") " << valString);
-//	#endif
+	const ScopedLock l(m_cachedValuesLock);
+	PublishValue(m_cachedValues[ro], valueData);
 }
 
 /**
- * Gets the data value for a given remote object in the cache map
- * @param	ro			The remote object to set the value for
- * @return	The value to get
+ * Gets a copy of the data value for a given remote object in the cache map.
+ * The copy owns its payload, so it stays valid regardless of later changes to the cache.
+ * @param	ro			The remote object to get the value for
+ * @param	valueData	The message data to copy the value to
+ * @return	True if a value is cached for the object, false if not and the message data was not modified.
  */
-const RemoteObjectMessageData& RemoteObjectValueCache::GetValue(const RemoteObject& ro)
+bool RemoteObjectValueCache::GetValue(const RemoteObject& ro, RemoteObjectMessageData& valueData) const
 {
-	if (!Contains(ro))
-		m_cachedValues[ro] = RemoteObjectMessageData(ro._Addr, ROVT_NONE, 0, nullptr, 0);
-
-	//#ifdef DEBUG
-	//	auto val = m_cachedValues[ro];
-	//	auto valString = juce::String();
-	//
-	//	switch (val._valType)
-	//	{
-	//	case ROVT_FLOAT:
-	//	{
-	//		jassert(val._valCount * sizeof(float) == val._payloadSize);
-	//		auto p = static_cast<float*>(val._payload);
-	//		for (auto i = 0; i < val._valCount; i++)
-	//			valString += String(*(p + i)) + ";";
-	//	}
-	//	break;
-	//	default:
-	//		break;
-	//	}
-	//
-	//	DBG(juce::String(__FUNCTION__) << " " << ro._Id << " (" << static_cast<int>(ro._Addr._first) << "," << static_cast<int>(ro._Addr._second) << ") " << valString);
-	//#endif
-
-	return m_cachedValues[ro];
+	const ScopedLock l(m_cachedValuesLock);
+	auto cachedValue = FindValue(ro);
+	if (!cachedValue)
+		return false;
+
+	valueData.payloadCopy(*cachedValue);
+	return true;
+}
+
+/**
+ * Updates some of the float values cached for a given remote object, e.g. the x component of a position,
+ * as one locked operation. If no value is cached for the object yet, it is initialized with zeros.
+ * @param	ro				The remote object to update the values for
+ * @param	valueCount		The number of float values the object has
+ * @param	firstValueIndex	The index of the first value to update
+ * @param	values			The values to set
+ * @param	count			The number of values to set
+ * @param	updatedValues	Buffer of valueCount floats to copy all values of the object to after updating
+ * @return	True if the values were updated, false if the cached value does not have the expected type and count.
+ */
+bool RemoteObjectValueCache::UpdateFloatValues(const RemoteObject& ro, int valueCount, int firstValueIndex, const float* values, int count, float* updatedValues)
+{
+	if (firstValueIndex < 0 || firstValueIndex + count > valueCount)
+		return false;
+
+	const ScopedLock l(m_cachedValuesLock);
+	auto cachedValueIter = m_cachedValues.find(ro);
+	if (cachedValueIter != m_cachedValues.end())
+	{
+		auto const& cachedValue = cachedValueIter->second;
+		if (cachedValue->_valType != ROVT_FLOAT || cachedValue->_valCount != valueCount || cachedValue->_payloadSize != valueCount * sizeof(float))
+			return false;
+
+		auto cachedFloatValues = static_cast<float*>(cachedValue->_payload);
+		std::copy(cachedFloatValues, cachedFloatValues + valueCount, updatedValues);
+	}
+	else
+	{
+		std::fill(updatedValues, updatedValues + valueCount, 0.0f);
+		cachedValueIter = m_cachedValues.emplace(ro, nullptr).first;
+	}
+
+	std::copy(values, values + count, updatedValues + firstValueIndex);
+	PublishValue(cachedValueIter->second, RemoteObjectMessageData(ro._Addr, ROVT_FLOAT, static_cast<std::uint16_t>(valueCount), updatedValues, static_cast<std::uint32_t>(valueCount * sizeof(float))));
+
+	return true;
+}
+
+/**
+ * Updates cached values as one locked operation, e.g. to step all animated values at once.
+ * The update function is called with the lock held on a mutable copy of every cached value and may modify
+ * the payload values, but not the value type, count or payload size. Only the values the function reports
+ * as modified are replaced in the cache.
+ * @param	updateFunction	The function called for every cached value, returning true if it modified the value.
+ */
+void RemoteObjectValueCache::UpdateValues(const std::function<bool(const RemoteObject&, RemoteObjectMessageData&)>& updateFunction)
+{
+	const ScopedLock l(m_cachedValuesLock);
+	for (auto& cachedValue : m_cachedValues)
+	{
+		m_updateValue.payloadCopy(*cachedValue.second);
+		if (updateFunction(cachedValue.first, m_updateValue))
+			PublishValue(cachedValue.second, m_updateValue);
+	}
+}
+
+/**
+ * Gets a snapshot of all cached values. The snapshot shares the immutable values with the cache and is not modified later,
+ * so it can be iterated without holding any lock while the cache is written to. As long as the cache does not change,
+ * the same snapshot is handed out without locking, otherwise it is recreated once on the next request,
+ * which only copies the value references, not the values.
+ * @return	The snapshot of all cached values.
+ */
+std::shared_ptr<const RemoteObjectValueCache::ValueSnapshot> RemoteObjectValueCache::GetCachedValues() const
+{
+	if (!m_cachedValuesSnapshotIsDirty)
+		return std::atomic_load(&m_cachedValuesSnapshot);
+
+	const ScopedLock l(m_cachedValuesLock);
+	if (m_cachedValuesSnapshotIsDirty)
+	{
+		auto snapshot = std::make_shared<ValueSnapshot>(m_cachedValues.begin(), m_cachedValues.end());
+
+		std::atomic_store(&m_cachedValuesSnapshot, std::shared_ptr<const ValueSnapshot>(snapshot));
+		m_cachedValuesSnapshotIsDirty = false;
+	}
+
+	return std::atomic_load(&m_cachedValuesSnapshot);
 }
 
 #ifdef DEBUG
 void RemoteObjectValueCache::DbgPrintCacheContent()
 {
+	const ScopedLock l(m_cachedValuesLock);
 	for (auto const& val : m_cachedValues)
 	{
 		auto valString = String();
-		switch (val.second._valType)
+		switch (val.second->_valType)
 		{
 		case ROVT_INT:
 			{
-				auto p = static_cast<int*>(val.second._payload);
-				for (auto i = 0; i < val.second._valCount; i++)
+				auto p = static_cast<int*>(val.second->_payload);
+				for (auto i = 0; i < val.second->_valCount; i++)
 					valString += String(*(p + i)) + ";";
 			}
 			break;
 		case ROVT_FLOAT:
 			{
-			auto p = static_cast<float*>(val.second._payload);
-			for (auto i = 0; i < val.second._valCount; i++)
+			auto p = static_cast<float*>(val.second->_payload);
+			for (auto i = 0; i < val.second->_valCount; i++)
 				valString += String(*(p + i)) + ";";
 			}
 			break;
@@ -255,7 +338,7 @@ void RemoteObjectValueCache::DbgPrintCacheContent()
 			break;
 		}
 		DBG(ProcessingEngineConfig::GetObjectShortDescription(val.first._Id)
-			+ " (" + String(val.second._addrVal._first) + ":" + String(val.second._addrVal._second) + ") "
+			+ " (" + String(val.second->_addrVal._first) + ":" + String(val.second->_addrVal._second) + ") "
 			+ valString);
 	}
 }
@@ -20,12 +20,25 @@
 
 #include "../RemoteProtocolBridgeCommon.h"
 
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 /**
- * 
+ * Class RemoteObjectValueCache holds the last known value per remote object.
+ * Values are held in a hashed map to have a single constant time lookup per access,
+ * all access is synchronized, since values are written and read from different protocol threads.
+ * Every cached value is immutable once written and replaced as a whole on change (copy-on-write per entry),
+ * so readers that need to iterate over all values get a snapshot that shares the values with the cache
+ * instead of copying them, and iterating does not block writers.
  */
 class RemoteObjectValueCache
 {
 public:
+	typedef std::vector<std::pair<RemoteObject, std::shared_ptr<const RemoteObjectMessageData>>> ValueSnapshot;
+
 	RemoteObjectValueCache();
 	~RemoteObjectValueCache();
 
@@ -40,15 +53,38 @@ public:
 	std::string GetStringValue(const RemoteObject& ro) const;
 
 	void SetValue(const RemoteObject& ro, const RemoteObjectMessageData& valueData);
-	const RemoteObjectMessageData& GetValue(const RemoteObject& ro);
+	bool GetValue(const RemoteObject& ro, RemoteObjectMessageData& valueData) const;
+	bool UpdateFloatValues(const RemoteObject& ro, int valueCount, int firstValueIndex, const float* values, int count, float* updatedValues);
+	void UpdateValues(const std::function<bool(const RemoteObject&, RemoteObjectMessageData&)>& updateFunction);
 
-	const std::map<RemoteObject, RemoteObjectMessageData>& GetCachedValues() const { return m_cachedValues; };
+	std::shared_ptr<const ValueSnapshot> GetCachedValues() const;
 
 private:
+	/**
+	 * Hash function for remote objects, combining the object id and addressing.
+	 */
+	struct RemoteObjectHash
+	{
+		std::size_t operator()(const RemoteObject& ro) const
+		{
+			auto key = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(ro._Id)) << 40)
+				^ (static_cast<std::uint64_t>(static_cast<std::uint32_t>(ro._Addr._first)) << 20)
+				^ static_cast<std::uint64_t>(static_cast<std::uint32_t>(ro._Addr._second));
+			return std::hash<std::uint64_t>()(key);
+		}
+	};
+
+	const RemoteObjectMessageData* FindValue(const RemoteObject& ro) const;
+	void PublishValue(std::shared_ptr<const RemoteObjectMessageData>& cachedValue, const RemoteObjectMessageData& valueData);
+
 #ifdef DEBUG
 	void DbgPrintCacheContent();
 #endif
 
-	std::map<RemoteObject, RemoteObjectMessageData> m_cachedValues;
+	std::unordered_map<RemoteObject, std::shared_ptr<const RemoteObjectMessageData>, RemoteObjectHash>	m_cachedValues;	/**< The cached value per remote object. Values are immutable owned copies that are shared with snapshots. */
+	CriticalSection																m_cachedValuesLock;				/**< Lock to protect the cached values against concurrent access. */
+	mutable std::shared_ptr<const ValueSnapshot>								m_cachedValuesSnapshot;			/**< The snapshot of all cached values as last handed out to readers. */
+	RemoteObjectMessageData														m_updateValue;					/**< Scratch value reused by UpdateValues to let the update function work on a mutable copy. */
+	mutable std::atomic<bool>													m_cachedValuesSnapshotIsDirty{ true };	/**< Indication if the cached values have changed since the snapshot was created. */
 
 };
@@ -25,8 +25,9 @@
  * Constructor
  */
 TimerThreadBase::TimerThreadBase()
-	: Thread("TimerThreadBase_Thread")
 {
+    m_scheduledTimer.owner = this;
+    m_scheduler->Register(m_scheduledTimer);
 }
 
 /**
@@ -34,94 +35,53 @@ TimerThreadBase::TimerThreadBase()
  */
 TimerThreadBase::~TimerThreadBase()
 {
+    m_scheduler->Unregister(m_scheduledTimer);
 }
 
 /**
- * Helper method to start the internal timer thread.
- * This checks, if the thread is already running and if yes, stops it first.
- * @param callbackInterval  The interval at which the new thread shall call the given callbackfunction.
+ * Helper method to start the timer callback.
+ * This checks, if the timer is already running and if yes, restarts it.
+ * @param callbackInterval  The interval at which the callback function shall be called.
+ * @param initialCallbackOffset The initial delay in ms before first calling the callback function.
  */
 void TimerThreadBase::startTimerThread(int callbackInterval, int initialCallbackOffset)
 {
-    if (isThreadRunning())
-        stopTimerThread();
-
-    m_callbackInterval = callbackInterval;
-    m_initialCallbackOffset = initialCallbackOffset;
-
-    startThread();
+    m_scheduler->Start(m_scheduledTimer, callbackInterval, initialCallbackOffset);
 }
 
 /**
- * Helper method to stop the internal timer thread.
- * This simply calls the stoptread function of thread with 10ms timeout.
+ * Helper method to stop the timer callback.
+ * When called from another thread, this waits for a currently executing callback to return.
  */
 void TimerThreadBase::stopTimerThread()
 {
-    stopThread(4 * m_callbackInterval);
+    m_scheduler->Stop(m_scheduledTimer);
 }
 
 /**
- * Helper method to get the internal timer thread running state.
- * @return  True if the juce::Thread is running, false if not.
+ * Helper method to get the timer running state.
+ * @return  True if the timer is started, false if not.
  */
 bool TimerThreadBase::isTimerThreadRunning()
 {
-    return isThreadRunning();
+    return m_scheduledTimer.isActive;
 }
 
 /**
- * Main thread loop reimplementation from JUCE thread.
- * This handles calling the pure virtual callback function calling in the given time intervals
+ * Getter for the number of callbacks that were not finished within the callback interval,
+ * either because the callback itself took too long or because the scheduler thread was busy.
+ * @return  The number of overruns since construction.
  */
-void TimerThreadBase::run()
+int TimerThreadBase::getTimerThreadOverrunCount()
 {
-    Thread::sleep(m_initialCallbackOffset);
-
-    while (!threadShouldExit())
-    {
-        // execute the timed callback and measure the time it takes
-        auto callbackStartTime = Time::getMillisecondCounterHiRes() * 1000.0f;
-        timerThreadCallback();
-        auto callbackStopTime = Time::getMillisecondCounterHiRes() * 1000.0f;
-        auto callbackDuration = callbackStopTime - callbackStartTime;
-
-        // calculate the remaining time that needs to be spent until next callback
-        auto remainingInterval = (m_callbackInterval * 1000) - callbackDuration;
-        if (remainingInterval < 0)
-        {
-            // we are in an overload situation, the callback takes more time than the configured interval allows
-            jassertfalse;
-            remainingInterval = 0;
-        }
-        auto remainingIntervalMs = static_cast<int>(0.001f * remainingInterval);
-        auto callbackIntervalus = static_cast<int>(1000 * m_callbackInterval);
-        if (remainingInterval >= callbackIntervalus)
-        {
-            // we are in an undefined state, must not happen!
-            jassertfalse;
-            remainingIntervalMs = 0;
-        }
-
-        auto threadExitCheckInterval = 25;
-        auto remainingThreadExitCheckTimeFragments = remainingIntervalMs / threadExitCheckInterval;
-        auto finalTimeFragmentMs = remainingIntervalMs % threadExitCheckInterval;
-
-        while (remainingThreadExitCheckTimeFragments > 0)
-        {
-            // To avoid overly long blocking, even though the thread is 
-            // already scheduled for termination, 
-            // check here if the thread shall be terminated 
-            if (threadShouldExit())
-                break;
-
-            // Spend another time fragment before continuing to next loop iteration and recheck for thread termination.
-            Thread::sleep(threadExitCheckInterval);
-
-            remainingThreadExitCheckTimeFragments--;
-        }
+    return m_scheduledTimer.overrunCount;
+}
 
-        // Spend the remaining time fragment.
-        Thread::sleep(finalTimeFragmentMs);
-    }
-}
\ No newline at end of file
+/**
+ * Getter for the longest duration a callback took to execute.
+ * @return  The longest callback duration in ms since construction.
+ */
+int TimerThreadBase::getTimerThreadMaxCallbackDuration()
+{
+    return m_scheduledTimer.maxCallbackDuration;
+}
@@ -18,13 +18,16 @@
 
 #pragma once
 
+#include "TimerThreadScheduler.h"
+
 #include <JuceHeader.h>
 
 /**
- * Class TimerThreadBase is a class for running a thread to call a given callback function at defined time intervals.
+ * Class TimerThreadBase is a class for calling a given callback function at defined time intervals from a background thread.
+ * The callback is called by one of the threads of the engine wide TimerThreadScheduler, not by a thread of its own.
  * The callback function reimplementation has to ensure itself that it meets all threadsafety requirements.
  */
-class TimerThreadBase :    private Thread
+class TimerThreadBase
 {
 public:
 	TimerThreadBase();
@@ -35,15 +38,18 @@ public:
 	bool isTimerThreadRunning();
 
 	//==============================================================================
-	void run() override;
+	int getTimerThreadOverrunCount();
+	int getTimerThreadMaxCallbackDuration();
 	
 protected:
 	//==============================================================================
 	virtual void timerThreadCallback() = 0;
 
 private:
-	int	m_callbackInterval{ 100 };		/**< The interval at which the callback function shall be called from running thread. */
-	int	m_initialCallbackOffset{ 0 };	/**< The initial delay in ms before first calling the callback function. Use e.g. if something that requires some time needs to be set up first before the callback thread becomes active. */
+	friend class TimerThreadScheduler;
+
+	SharedResourcePointer<TimerThreadScheduler>	m_scheduler;		/**< The engine wide scheduler calling the callback function. */
+	TimerThreadScheduler::ScheduledTimer		m_scheduledTimer;	/**< The scheduling data of this timer, with the callback interval and overrun statistics. */
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TimerThreadBase)
 };
\ No newline at end of file
@@ -0,0 +1,509 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include "TimerThreadScheduler.h"
+
+#include "TimerThreadBase.h"
+
+
+// **************************************************************************************
+//    class TimerThreadScheduler
+// **************************************************************************************
+/**
+ * Constructor of class TimerThreadScheduler.
+ * Creates and starts the scheduler threads, one per two cpu cores but at least two, to not have all timers
+ * delayed by a single long running callback, and at most s_maxThreadCount.
+ */
+TimerThreadScheduler::TimerThreadScheduler()
+{
+	auto threadCount = jlimit(2, s_maxThreadCount, SystemStats::getNumCpus() / 2);
+	for (auto i = 0; i < threadCount; i++)
+	{
+		m_wheelThreads.push_back(std::make_unique<WheelThread>(i));
+		m_wheelThreads.back()->startThread();
+	}
+}
+
+/**
+ * Destructor
+ */
+TimerThreadScheduler::~TimerThreadScheduler()
+{
+	m_wheelThreads.clear();
+}
+
+/**
+ * Method to assign a timer to the scheduler thread with the fewest timers.
+ * Needs to be called once before the timer is started for the first time.
+ * @param timer		The timer to assign.
+ */
+void TimerThreadScheduler::Register(ScheduledTimer& timer)
+{
+	auto wheelIndex = 0;
+	for (auto i = 1; i < static_cast<int>(m_wheelThreads.size()); i++)
+		if (m_wheelThreads.at(i)->GetTimerCount() < m_wheelThreads.at(wheelIndex)->GetTimerCount())
+			wheelIndex = i;
+
+	timer.wheelIndex = wheelIndex;
+	m_wheelThreads.at(wheelIndex)->AddTimer();
+}
+
+/**
+ * Method to stop a timer and release its scheduler thread assignment.
+ * @param timer		The timer to release.
+ */
+void TimerThreadScheduler::Unregister(ScheduledTimer& timer)
+{
+	if (timer.wheelIndex < 0)
+		return;
+
+	Stop(timer);
+
+	m_wheelThreads.at(timer.wheelIndex)->RemoveTimer();
+	timer.wheelIndex = -1;
+}
+
+/**
+ * Method to start a timer. A timer that is already started is restarted with the new interval.
+ * @param timer						The timer to start.
+ * @param callbackInterval			The interval in ms at which the timer callback shall be called.
+ * @param initialCallbackOffset		The delay in ms before the timer callback is called for the first time.
+ */
+void TimerThreadScheduler::Start(ScheduledTimer& timer, int callbackInterval, int initialCallbackOffset)
+{
+	if (timer.wheelIndex < 0)
+		Register(timer);
+
+	m_wheelThreads.at(timer.wheelIndex)->Schedule(timer, callbackInterval, initialCallbackOffset);
+}
+
+/**
+ * Method to stop a timer. When this returns, the timer callback is not executing anymore,
+ * unless it is called from within the callback itself.
+ * @param timer		The timer to stop.
+ */
+void TimerThreadScheduler::Stop(ScheduledTimer& timer)
+{
+	if (timer.wheelIndex < 0)
+		return;
+
+	m_wheelThreads.at(timer.wheelIndex)->Cancel(timer);
+}
+
+/**
+ * Getter for the number of scheduler threads.
+ * @return	The number of scheduler threads.
+ */
+int TimerThreadScheduler::GetThreadCount() const
+{
+	return static_cast<int>(m_wheelThreads.size());
+}
+
+/**
+ * Getter for the number of times any of the scheduler threads woke up, e.g. to compare
+ * the scheduling overhead of different configurations.
+ * @return	The sum of wakeups of all scheduler threads.
+ */
+std::uint64_t TimerThreadScheduler::GetWakeupCount() const
+{
+	auto wakeupCount = std::uint64_t(0);
+	for (auto const& wheelThread : m_wheelThreads)
+		wakeupCount += wheelThread->GetWakeupCount();
+
+	return wakeupCount;
+}
+
+/**
+ * Helper to call the callback of the TimerThreadBase a timer belongs to.
+ * @param timer		The timer to call the callback for.
+ */
+void TimerThreadScheduler::CallTimerCallback(ScheduledTimer& timer)
+{
+	if (timer.owner)
+		timer.owner->timerThreadCallback();
+}
+
+
+// **************************************************************************************
+//    class TimerThreadScheduler::WheelThread
+// **************************************************************************************
+/**
+ * Constructor of class TimerThreadScheduler::WheelThread.
+ * @param index		The index of the thread in the scheduler, used for the thread name.
+ */
+TimerThreadScheduler::WheelThread::WheelThread(int index)
+	: Thread("TimerThreadScheduler_Thread" + String(index))
+{
+	m_currentTick = GetCurrentTick();
+}
+
+/**
+ * Destructor
+ */
+TimerThreadScheduler::WheelThread::~WheelThread()
+{
+	signalThreadShouldExit();
+	m_wakeupEvent.signal();
+	stopThread(1000);
+}
+
+/**
+ * Method to link a timer into the wheel for its first callback.
+ * A timer that is already linked is unlinked first.
+ * @param timer						The timer to schedule.
+ * @param callbackInterval			The interval in ms at which the timer callback shall be called.
+ * @param initialCallbackOffset		The delay in ms before the timer callback is called for the first time.
+ */
+void TimerThreadScheduler::WheelThread::Schedule(ScheduledTimer& timer, int callbackInterval, int initialCallbackOffset)
+{
+	{
+		const ScopedLock l(m_wheelLock);
+
+		if (timer.level >= 0)
+			Unlink(timer);
+
+		// an idle wheel does not advance, so catch up to avoid advancing through the whole idle time later on
+		if (m_scheduledCount == 0 && nullptr == m_executingTimer)
+			m_currentTick = jmax(m_currentTick, GetCurrentTick());
+
+		timer.generation++;
+		timer.interval = jmax(1, callbackInterval);
+		timer.dueTick = GetCurrentTick() + static_cast<std::uint64_t>(jmax(0, initialCallbackOffset));
+		timer.isActive = true;
+		Insert(timer, m_currentTick + 1);
+	}
+
+	m_wakeupEvent.signal();
+}
+
+/**
+ * Method to unlink a timer from the wheel and wait for its callback to return, if it is currently executing.
+ * @param timer		The timer to cancel.
+ */
+void TimerThreadScheduler::WheelThread::Cancel(ScheduledTimer& timer)
+{
+	{
+		const ScopedLock l(m_wheelLock);
+
+		if (timer.level >= 0)
+			Unlink(timer);
+
+		timer.generation++;
+		timer.isActive = false;
+	}
+
+	// a callback that stops its own timer must not wait for itself to return
+	if (Thread::getCurrentThreadId() == getThreadId())
+		return;
+
+	while (true)
+	{
+		{
+			const ScopedLock l(m_wheelLock);
+			if (m_executingTimer != &timer)
+				break;
+		}
+		m_callbackFinishedEvent.wait(10);
+	}
+}
+
+/**
+ * Getter for the number of timers assigned to this thread.
+ * @return	The number of assigned timers.
+ */
+int TimerThreadScheduler::WheelThread::GetTimerCount() const
+{
+	return m_timerCount.load();
+}
+
+/**
+ * Method to account for a timer that was assigned to this thread.
+ */
+void TimerThreadScheduler::WheelThread::AddTimer()
+{
+	m_timerCount++;
+}
+
+/**
+ * Method to account for a timer that was released from this thread.
+ */
+void TimerThreadScheduler::WheelThread::RemoveTimer()
+{
+	m_timerCount--;
+}
+
+/**
+ * Getter for the number of times this thread woke up.
+ * @return	The number of wakeups.
+ */
+std::uint64_t TimerThreadScheduler::WheelThread::GetWakeupCount() const
+{
+	return m_wakeupCount.load();
+}
+
+/**
+ * Main thread loop reimplementation from JUCE thread.
+ * Advances the wheel to the current tick, calling all timers that became due,
+ * and sleeps until the next timer is due or a wheel slot needs to be cascaded.
+ */
+void TimerThreadScheduler::WheelThread::run()
+{
+	while (!threadShouldExit())
+	{
+		auto waitTime = -1;
+		{
+			const ScopedLock l(m_wheelLock);
+
+			Advance(GetCurrentTick());
+
+			auto nextWakeupTick = GetNextWakeupTick();
+			if (nextWakeupTick != 0)
+			{
+				auto nowTick = GetCurrentTick();
+				waitTime = nextWakeupTick > nowTick ? static_cast<int>(jmin(nextWakeupTick - nowTick, std::uint64_t(60000))) : 0;
+			}
+		}
+
+		if (waitTime != 0)
+			m_wakeupEvent.wait(waitTime);
+
+		m_wakeupCount++;
+	}
+}
+
+/**
+ * Helper to get the current tick, with one tick per ms.
+ * @return	The current tick.
+ */
+std::uint64_t TimerThreadScheduler::WheelThread::GetCurrentTick()
+{
+	return static_cast<std::uint64_t>(Time::getMillisecondCounterHiRes());
+}
+
+/**
+ * Helper to link a timer into the slot of the level its due tick falls into.
+ * The wheel lock must be held when calling this.
+ * @param timer			The timer to link.
+ * @param earliestTick	The earliest tick the timer may be called at. Due ticks before are moved to this one.
+ */
+void TimerThreadScheduler::WheelThread::Insert(ScheduledTimer& timer, std::uint64_t earliestTick)
+{
+	auto expiryTick = jmax(timer.dueTick, earliestTick);
+	auto delta = expiryTick - m_currentTick;
+
+	auto level = 0;
+	while (level < s_levelCount - 1 && delta >= (std::uint64_t(1) << (s_slotBits * (level + 1))))
+		level++;
+
+	// timers beyond the range of the highest level are parked in its furthest slot and cascaded again from there
+	auto maxDelta = (std::uint64_t(1) << (s_slotBits * s_levelCount)) - 1;
+	if (delta > maxDelta)
+		expiryTick = m_currentTick + maxDelta;
+
+	auto slot = static_cast<int>((expiryTick >> (s_slotBits * level)) & (s_slotCount - 1));
+
+	timer.level = level;
+	timer.slot = slot;
+	timer.prev = nullptr;
+	timer.next = m_slots[level][slot];
+	if (timer.next)
+		timer.next->prev = &timer;
+	m_slots[level][slot] = &timer;
+	m_slotOccupancy[level] |= (std::uint64_t(1) << slot);
+
+	m_scheduledCount++;
+}
+
+/**
+ * Helper to unlink a timer from the slot or due list it is linked into.
+ * The wheel lock must be held when calling this.
+ * @param timer		The timer to unlink.
+ */
+void TimerThreadScheduler::WheelThread::Unlink(ScheduledTimer& timer)
+{
+	if (timer.prev)
+		timer.prev->next = timer.next;
+	else if (timer.level == s_dueLevel)
+		m_dueTimers = timer.next;
+	else
+		m_slots[timer.level][timer.slot] = timer.next;
+
+	if (timer.next)
+		timer.next->prev = timer.prev;
+
+	if (timer.level < s_dueLevel && nullptr == m_slots[timer.level][timer.slot])
+		m_slotOccupancy[timer.level] &= ~(std::uint64_t(1) << timer.slot);
+
+	timer.prev = nullptr;
+	timer.next = nullptr;
+	timer.level = -1;
+	timer.slot = -1;
+
+	m_scheduledCount--;
+}
+
+/**
+ * Helper to relink all timers of a slot into the lower levels, now that the current tick reached the slot's range.
+ * The wheel lock must be held when calling this.
+ * @param level		The level of the slot to cascade.
+ * @param slot		The slot to cascade.
+ */
+void TimerThreadScheduler::WheelThread::Cascade(int level, int slot)
+{
+	auto timer = m_slots[level][slot];
+	while (timer)
+	{
+		auto next = timer->next;
+		Unlink(*timer);
+		Insert(*timer, m_currentTick);
+		timer = next;
+	}
+}
+
+/**
+ * Helper to advance the wheel tick by tick up to the given tick, cascading
+ * the higher levels and calling the timers that became due on the way.
+ * Ticks without any timer in level 0 are skipped up to the next cascade.
+ * The wheel lock must be held when calling this.
+ * @param nowTick	The tick to advance to.
+ */
+void TimerThreadScheduler::WheelThread::Advance(std::uint64_t nowTick)
+{
+	while (m_currentTick < nowTick)
+	{
+		if (m_scheduledCount == 0)
+		{
+			m_currentTick = nowTick;
+			break;
+		}
+
+		if (m_slotOccupancy[0] == 0)
+		{
+			auto nextCascadeTick = ((m_currentTick >> s_slotBits) + 1) << s_slotBits;
+			m_currentTick = jmin(nowTick, nextCascadeTick - 1);
+			if (m_currentTick == nowTick)
+				break;
+		}
+
+		m_currentTick++;
+
+		for (auto level = 1; level < s_levelCount; level++)
+		{
+			if ((m_currentTick & ((std::uint64_t(1) << (s_slotBits * level)) - 1)) != 0)
+				break;
+			Cascade(level, static_cast<int>((m_currentTick >> (s_slotBits * level)) & (s_slotCount - 1)));
+		}
+
+		auto slot = static_cast<int>(m_currentTick & (s_slotCount - 1));
+		while (m_slots[0][slot])
+		{
+			auto timer = m_slots[0][slot];
+			Unlink(*timer);
+
+			timer->level = s_dueLevel;
+			timer->next = m_dueTimers;
+			if (m_dueTimers)
+				m_dueTimers->prev = timer;
+			m_dueTimers = timer;
+			m_scheduledCount++;
+		}
+
+		FireDueTimers();
+	}
+}
+
+/**
+ * Helper to call the callbacks of all due timers and link them in again for their next callback.
+ * The wheel lock is released while a callback executes, so timers may be started or stopped meanwhile.
+ * A callback that took longer than its timer interval is reported as overrun and the missed callbacks are skipped.
+ * The wheel lock must be held when calling this.
+ */
+void TimerThreadScheduler::WheelThread::FireDueTimers()
+{
+	while (m_dueTimers)
+	{
+		auto timer = m_dueTimers;
+		Unlink(*timer);
+
+		auto generation = timer->generation;
+		m_executingTimer = timer;
+
+		auto callbackDuration = 0.0;
+		{
+			const ScopedUnlock ul(m_wheelLock);
+
+			auto callbackStartTime = Time::getMillisecondCounterHiRes();
+			CallTimerCallback(*timer);
+			callbackDuration = Time::getMillisecondCounterHiRes() - callbackStartTime;
+		}
+
+		m_executingTimer = nullptr;
+		m_callbackFinishedEvent.signal();
+
+		// the timer was stopped or restarted while its callback was executing
+		if (!timer->isActive || timer->generation != generation)
+			continue;
+
+		auto callbackDurationMs = static_cast<int>(callbackDuration);
+		if (callbackDurationMs > timer->maxCallbackDuration)
+			timer->maxCallbackDuration = callbackDurationMs;
+
+		timer->dueTick += static_cast<std::uint64_t>(timer->interval);
+		auto nowTick = GetCurrentTick();
+		if (timer->dueTick <= nowTick)
+		{
+			// overload situation, the callback takes more time than the configured interval allows
+			timer->overrunCount++;
+			timer->dueTick = nowTick + 1;
+		}
+
+		Insert(*timer, m_currentTick + 1);
+	}
+}
+
+/**
+ * Helper to get the tick the thread needs to wake up at next, either because a timer
+ * in level 0 is due or because a slot in the higher levels needs to be cascaded.
+ * The wheel lock must be held when calling this.
+ * @return	The next tick to wake up at, 0 if no timer is scheduled.
+ */
+std::uint64_t TimerThreadScheduler::WheelThread::GetNextWakeupTick() const
+{
+	auto nextWakeupTick = std::uint64_t(0);
+
+	for (auto level = 0; level < s_levelCount; level++)
+	{
+		if (m_slotOccupancy[level] == 0)
+			continue;
+
+		auto levelShift = s_slotBits * level;
+		auto currentSlot = static_cast<int>((m_currentTick >> levelShift) & (s_slotCount - 1));
+		for (auto i = 1; i <= s_slotCount; i++)
+		{
+			if ((m_slotOccupancy[level] & (std::uint64_t(1) << ((currentSlot + i) & (s_slotCount - 1)))) == 0)
+				continue;
+
+			auto slotTick = ((m_currentTick >> levelShift) + static_cast<std::uint64_t>(i)) << levelShift;
+			if (nextWakeupTick == 0 || slotTick < nextWakeupTick)
+				nextWakeupTick = slotTick;
+			break;
+		}
+	}
+
+	return nextWakeupTick;
+}
@@ -0,0 +1,142 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#pragma once
+
+#include <JuceHeader.h>
+
+class TimerThreadBase;
+
+/**
+ * Class TimerThreadScheduler is the engine wide scheduler that calls the callbacks of all TimerThreadBase instances.
+ * Instead of one sleeping thread per timer, a few scheduler threads each run a hierarchical timing wheel with
+ * millisecond ticks and only wake up when a timer is due or a wheel level needs to be cascaded.
+ * Timers are distributed across the scheduler threads at registration, a callback therefore never runs
+ * concurrently with itself, but may be delayed by a long running callback on the same thread.
+ * The instance is shared through a SharedResourcePointer and exists as long as any TimerThreadBase does.
+ */
+class TimerThreadScheduler
+{
+public:
+	/**
+	 * The scheduling data of a single timer. It is owned by the TimerThreadBase instance
+	 * and linked into the wheel slot it is due in, so scheduling does not allocate.
+	 */
+	struct ScheduledTimer
+	{
+		TimerThreadBase*		owner{ nullptr };			/**< The timer whose callback is to be called. */
+		ScheduledTimer*			prev{ nullptr };			/**< The previous timer in the same wheel slot. */
+		ScheduledTimer*			next{ nullptr };			/**< The next timer in the same wheel slot. */
+		int						wheelIndex{ -1 };			/**< The index of the scheduler thread the timer is assigned to. */
+		int						level{ -1 };				/**< The wheel level the timer is linked into, -1 if not linked. */
+		int						slot{ -1 };					/**< The wheel slot the timer is linked into. */
+		int						interval{ 100 };			/**< The callback interval in ms. */
+		std::uint64_t			dueTick{ 0 };				/**< The tick the next callback is due at. */
+		std::uint32_t			generation{ 0 };			/**< Incremented on every start or stop, to detect restarts while the callback is executing. */
+		std::atomic<bool>		isActive{ false };			/**< Indication if the timer is started. */
+		std::atomic<int>		overrunCount{ 0 };			/**< The number of callbacks that took longer than the interval. */
+		std::atomic<int>		maxCallbackDuration{ 0 };	/**< The longest callback duration in ms that was measured. */
+	};
+
+public:
+	TimerThreadScheduler();
+	~TimerThreadScheduler();
+
+	//==============================================================================
+	void Register(ScheduledTimer& timer);
+	void Unregister(ScheduledTimer& timer);
+
+	//==============================================================================
+	void Start(ScheduledTimer& timer, int callbackInterval, int initialCallbackOffset);
+	void Stop(ScheduledTimer& timer);
+
+	//==============================================================================
+	int GetThreadCount() const;
+	std::uint64_t GetWakeupCount() const;
+
+private:
+	class WheelThread;
+
+	//==============================================================================
+	static void CallTimerCallback(ScheduledTimer& timer);
+
+	//==============================================================================
+	static constexpr int s_maxThreadCount = 4;		/**< The maximum number of scheduler threads, independent of the number of timers. */
+
+	std::vector<std::unique_ptr<WheelThread>>	m_wheelThreads;		/**< The scheduler threads, each running its own timing wheel. */
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TimerThreadScheduler)
+};
+
+/**
+ * Class TimerThreadScheduler::WheelThread is a single scheduler thread with its hierarchical timing wheel.
+ * Level 0 has a slot per ms tick, every further level covers 64 times the range of the previous one.
+ * Timers are linked into the slot of the level their due tick falls into and cascaded down
+ * to the lower levels when the current tick reaches the range of their slot.
+ */
+class TimerThreadScheduler::WheelThread : public Thread
+{
+public:
+	WheelThread(int index);
+	~WheelThread() override;
+
+	//==============================================================================
+	void Schedule(ScheduledTimer& timer, int callbackInterval, int initialCallbackOffset);
+	void Cancel(ScheduledTimer& timer);
+
+	//==============================================================================
+	int GetTimerCount() const;
+	void AddTimer();
+	void RemoveTimer();
+	std::uint64_t GetWakeupCount() const;
+
+	//==============================================================================
+	void run() override;
+
+private:
+	//==============================================================================
+	static std::uint64_t GetCurrentTick();
+
+	//==============================================================================
+	void Insert(ScheduledTimer& timer, std::uint64_t earliestTick);
+	void Unlink(ScheduledTimer& timer);
+	void Cascade(int level, int slot);
+	void Advance(std::uint64_t nowTick);
+	void FireDueTimers();
+	std::uint64_t GetNextWakeupTick() const;
+
+	//==============================================================================
+	static constexpr int s_slotBits = 6;						/**< The number of tick bits resolved by a single wheel level. */
+	static constexpr int s_slotCount = 1 << s_slotBits;			/**< The number of slots per wheel level. */
+	static constexpr int s_levelCount = 4;						/**< The number of wheel levels, covering roughly 4.6h at 1ms ticks. */
+	static constexpr int s_dueLevel = s_levelCount;				/**< The pseudo level of the timers that are due in the current tick. */
+
+	CriticalSection														m_wheelLock;						/**< The lock that guards the wheel and all timers linked into it. */
+	WaitableEvent														m_wakeupEvent;						/**< Signalled to make the thread recalculate its wakeup time. */
+	WaitableEvent														m_callbackFinishedEvent;			/**< Signalled whenever a callback returned, to let stopping threads continue. */
+	std::array<std::array<ScheduledTimer*, s_slotCount>, s_levelCount>	m_slots{};							/**< The first timer in every slot of every level. */
+	std::array<std::uint64_t, s_levelCount>								m_slotOccupancy{};					/**< A bit per slot of every level indicating if any timer is linked into it. */
+	ScheduledTimer*														m_dueTimers{ nullptr };				/**< The timers that are due in the current tick and not yet called. */
+	ScheduledTimer*														m_executingTimer{ nullptr };		/**< The timer whose callback is currently executing. */
+	std::uint64_t														m_currentTick{ 0 };					/**< The tick the wheel has advanced to. */
+	int																	m_scheduledCount{ 0 };				/**< The number of timers linked into the wheel. */
+	std::atomic<int>													m_timerCount{ 0 };					/**< The number of timers assigned to this thread. */
+	std::atomic<std::uint64_t>											m_wakeupCount{ 0 };					/**< The number of times the thread woke up. */
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WheelThread)
+};
@@ -0,0 +1,46 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <JuceHeader.h>
+
+/**
+ * Runs all unit tests registered by the test sources and reports failures through the return code,
+ * so the tests can be run by ctest. Tests in the category "Benchmarks" only measure and log timings,
+ * they are skipped by default and run exclusively when the argument --benchmarks is given.
+ */
+int main(int argc, char* argv[])
+{
+	auto runBenchmarks = false;
+	for (auto i = 1; i < argc; i++)
+		runBenchmarks = runBenchmarks || (String(argv[i]) == "--benchmarks");
+
+	Array<UnitTest*> tests;
+	for (auto test : UnitTest::getAllTests())
+		if ((test->getCategory() == "Benchmarks") == runBenchmarks)
+			tests.add(test);
+
+	UnitTestRunner testRunner;
+	testRunner.setAssertOnFailure(false);
+	testRunner.runTests(tests);
+
+	auto failureCount = 0;
+	for (auto i = 0; i < testRunner.getNumResults(); i++)
+		failureCount += testRunner.getResult(i)->failures;
+
+	return (failureCount > 0) ? 1 : 0;
+}
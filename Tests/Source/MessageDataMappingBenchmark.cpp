@@ -0,0 +1,172 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <JuceHeader.h>
+
+#include <ProtocolProcessor/ProtocolProcessorBase.h>
+
+
+/**
+ * Benchmark of ProtocolProcessorBase::MapMessageDataToTargetRangeAndType for all combinations of
+ * float and int source and target values, for single values and the multi-value objects (XY, XYZ).
+ * Measures the mapping into an inline MappedPayloadBuffer against the previous implementation,
+ * that normalized and mapped through temporary vectors into a newly allocated payload.
+ */
+class MessageDataMappingBenchmark : public UnitTest
+{
+public:
+	MessageDataMappingBenchmark() : UnitTest("MessageDataMapping", "Benchmarks") {}
+
+	void runTest() override
+	{
+		for (auto sourceType : { ROVT_FLOAT, ROVT_INT })
+		{
+			for (auto targetType : { ROVT_FLOAT, ROVT_INT })
+			{
+				for (auto valueCount : { 1, 2, 3 })
+				{
+					beginTest(GetValueTypeName(sourceType) + " to " + GetValueTypeName(targetType) + " with " + String(valueCount) + " values");
+
+					float floatValues[3] = { 0.25f, 0.6f, 0.75f };
+					int intValues[3] = { 25, 60, 75 };
+					auto sourceData = (sourceType == ROVT_FLOAT)
+						? RemoteObjectMessageData(RemoteObjectAddressing(1, 1), ROVT_FLOAT, static_cast<std::uint16_t>(valueCount), floatValues, static_cast<std::uint32_t>(valueCount * sizeof(float)))
+						: RemoteObjectMessageData(RemoteObjectAddressing(1, 1), ROVT_INT, static_cast<std::uint16_t>(valueCount), intValues, static_cast<std::uint32_t>(valueCount * sizeof(int)));
+					auto sourceRange = (sourceType == ROVT_FLOAT) ? juce::Range<float>(0.0f, 1.0f) : juce::Range<float>(0.0f, 100.0f);
+					auto targetRange = juce::Range<float>(-10.0f, 10.0f);
+
+					auto bufferNs = Measure([&]() {
+						RemoteObjectMessageData targetData;
+						ProtocolProcessorBase::MappedPayloadBuffer targetPayload;
+						auto mappingSuccess = ProtocolProcessorBase::MapMessageDataToTargetRangeAndType(sourceData, sourceRange, targetRange, targetType, targetData, targetPayload);
+						return mappingSuccess ? GetLastValue(targetData) : 0.0f;
+					});
+
+					auto previousNs = Measure([&]() {
+						RemoteObjectMessageData targetData;
+						auto mappingSuccess = MapMessageDataToTargetRangeAndTypeAllocating(sourceData, sourceRange, targetRange, targetType, targetData);
+						return mappingSuccess ? GetLastValue(targetData) : 0.0f;
+					});
+
+					logMessage("MappedPayloadBuffer: " + String(bufferNs, 1) + " ns per message, previous allocating mapping: " + String(previousNs, 1) + " ns per message");
+
+					RemoteObjectMessageData targetData;
+					ProtocolProcessorBase::MappedPayloadBuffer targetPayload;
+					RemoteObjectMessageData referenceData;
+					expect(ProtocolProcessorBase::MapMessageDataToTargetRangeAndType(sourceData, sourceRange, targetRange, targetType, targetData, targetPayload));
+					expect(MapMessageDataToTargetRangeAndTypeAllocating(sourceData, sourceRange, targetRange, targetType, referenceData));
+					expect(targetData._valType == referenceData._valType && targetData._valCount == referenceData._valCount && targetData._payloadSize == referenceData._payloadSize);
+					expect(0 == std::memcmp(targetData._payload, referenceData._payload, targetData._payloadSize));
+				}
+			}
+		}
+
+		beginTest("Non-numeric source values");
+		{
+			RemoteObjectMessageData targetData;
+			ProtocolProcessorBase::MappedPayloadBuffer targetPayload;
+			char stringValue[] = "value";
+			auto sourceData = RemoteObjectMessageData(RemoteObjectAddressing(1, 1), ROVT_STRING, 1, stringValue, 5);
+			expect(ProtocolProcessorBase::MapMessageDataToTargetRangeAndType(sourceData, { 0.0f, 1.0f }, { 0.0f, 10.0f }, ROVT_FLOAT, targetData, targetPayload));
+			expect(targetData._valType == ROVT_FLOAT && targetData._valCount == 0 && targetData._payloadSize == 0);
+			expect(!ProtocolProcessorBase::MapMessageDataToTargetRangeAndType(sourceData, { 0.0f, 1.0f }, { 0.0f, 10.0f }, ROVT_STRING, targetData, targetPayload));
+		}
+	}
+
+private:
+	/**
+	 * The previous mapping implementation as reference, normalizing and mapping the values through temporary vectors
+	 * and dumping them into a newly allocated payload, that is owned by the target data here to not leak it.
+	 */
+	static bool MapMessageDataToTargetRangeAndTypeAllocating(const RemoteObjectMessageData& sourceData, const juce::Range<float>& sourceRange, const juce::Range<float>& targetRange, const RemoteObjectValueType targetType, RemoteObjectMessageData& targetData)
+	{
+		auto normalizedObjValues = std::vector<float>();
+		for (auto i = 0; i < sourceData._valCount; i++)
+		{
+			auto objectValue = (sourceData._valType == ROVT_FLOAT) ? static_cast<float*>(sourceData._payload)[i] : static_cast<float>(static_cast<int*>(sourceData._payload)[i]);
+			normalizedObjValues.push_back(ProtocolProcessorBase::NormalizeValueByRange(objectValue, sourceRange));
+		}
+
+		auto targetRangeMappedObjValues = std::vector<float>();
+		for (auto const& normalizedValue : normalizedObjValues)
+			targetRangeMappedObjValues.push_back(ProtocolProcessorBase::MapNormalizedValueToRange(normalizedValue, targetRange));
+
+		targetData = sourceData;
+		targetData._valType = targetType;
+		targetData._valCount = static_cast<std::uint16_t>(targetRangeMappedObjValues.size());
+		targetData._payloadOwned = true;
+		if (targetType == ROVT_FLOAT)
+		{
+			targetData._payload = new float[targetData._valCount];
+			targetData._payloadSize = sizeof(float) * targetData._valCount;
+			for (auto i = 0; i < targetData._valCount; i++)
+				static_cast<float*>(targetData._payload)[i] = targetRangeMappedObjValues.at(i);
+		}
+		else
+		{
+			targetData._payload = new int[targetData._valCount];
+			targetData._payloadSize = sizeof(int) * targetData._valCount;
+			for (auto i = 0; i < targetData._valCount; i++)
+				static_cast<int*>(targetData._payload)[i] = static_cast<int>(targetRangeMappedObjValues.at(i));
+		}
+
+		return true;
+	}
+
+	/**
+	 * Helper to get the last mapped value of message data as float, to not let the mapping be optimised away.
+	 * @param	msgData	The mapped message data.
+	 * @return	The last value.
+	 */
+	static float GetLastValue(const RemoteObjectMessageData& msgData)
+	{
+		auto lastIndex = msgData._valCount - 1;
+		return (msgData._valType == ROVT_FLOAT) ? static_cast<float*>(msgData._payload)[lastIndex] : static_cast<float>(static_cast<int*>(msgData._payload)[lastIndex]);
+	}
+
+	/**
+	 * Helper to get a readable name of the benchmarked value types.
+	 * @param	valueType	The value type.
+	 * @return	The name.
+	 */
+	static String GetValueTypeName(RemoteObjectValueType valueType)
+	{
+		return (valueType == ROVT_FLOAT) ? "float" : "int";
+	}
+
+	/**
+	 * Runs the given mapping repeatedly.
+	 * @param	map	The mapping to measure, returning the last mapped value.
+	 * @return	The average duration of one mapping, in nanoseconds.
+	 */
+	double Measure(const std::function<float()>& map)
+	{
+		auto checksum = 0.0f;
+		auto startTicks = Time::getHighResolutionTicks();
+		for (auto i = 0; i < s_messageCount; i++)
+			checksum += map();
+		auto durationSeconds = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - startTicks);
+
+		expect(checksum != 0.0f);
+		return durationSeconds * 1.0e9 / s_messageCount;
+	}
+
+	static constexpr int s_messageCount = 200000;
+};
+
+static MessageDataMappingBenchmark messageDataMappingBenchmark;
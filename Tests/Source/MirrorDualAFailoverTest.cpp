@@ -0,0 +1,198 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <JuceHeader.h>
+
+#include <ProcessingEngineNode.h>
+#include <ObjectDataHandling/Mirror_dualA_withValFilter/Mirror_dualA_withValFilter.h>
+
+
+/**
+ * Unit tests for the failover of Mirror_dualA_withValFilter, run on a simulated clock
+ * to deterministically simulate a dropout of the master protocol.
+ */
+class MirrorDualAFailoverTest : public UnitTest
+{
+public:
+	MirrorDualAFailoverTest() : UnitTest("MirrorDualAFailover", "ProcessingEngine") {}
+
+	void runTest() override
+	{
+		beginTest("Heartbeat pings are sent to both typeA protocols");
+		{
+			SimulatedMirror mirror;
+			expect(mirror.Configure());
+
+			mirror.RunLivenessCheck();
+			expectEquals(mirror.GetSentCount(s_masterId, ROI_HeartbeatPing), 1);
+			expectEquals(mirror.GetSentCount(s_slaveId, ROI_HeartbeatPing), 1);
+
+			// no further pings before the heartbeat interval elapsed
+			mirror.Advance(s_heartbeatIntervalMs / 2);
+			mirror.RunLivenessCheck();
+			expectEquals(mirror.GetSentCount(s_masterId, ROI_HeartbeatPing), 1);
+
+			mirror.Advance(s_heartbeatIntervalMs / 2);
+			mirror.RunLivenessCheck();
+			expectEquals(mirror.GetSentCount(s_masterId, ROI_HeartbeatPing), 2);
+		}
+
+		beginTest("The master is kept while it reacts");
+		{
+			SimulatedMirror mirror;
+			expect(mirror.Configure());
+
+			for (auto timeMs = 0; timeMs < 5 * s_failoverTimeMs; timeMs += s_heartbeatIntervalMs)
+			{
+				mirror.Advance(s_heartbeatIntervalMs);
+				mirror.UpdateOnlineState(s_masterId);
+				mirror.UpdateOnlineState(s_slaveId);
+				mirror.RunLivenessCheck();
+			}
+
+			expect(mirror.IsMaster(s_masterId));
+			expect(!mirror.IsMaster(s_slaveId));
+		}
+
+		beginTest("Failover after a master dropout replays the missed values");
+		{
+			SimulatedMirror mirror;
+			expect(mirror.Configure());
+			mirror.UpdateOnlineState(s_masterId);
+			mirror.UpdateOnlineState(s_slaveId);
+
+			// a value from typeB is forwarded to the master only, the slave misses it
+			auto gain = 0.5f;
+			mirror.OnReceivedMessageFromProtocol(s_typeBId, ROI_MatrixInput_Gain, RemoteObjectMessageData(RemoteObjectAddressing(1, INVALID_ADDRESS_VALUE), ROVT_FLOAT, 1, &gain, sizeof(float)), RemoteObjectMessageMetaInfo());
+			expectEquals(mirror.GetSentCount(s_masterId, ROI_MatrixInput_Gain), 1);
+			expectEquals(mirror.GetSentCount(s_slaveId, ROI_MatrixInput_Gain), 0);
+
+			// the master drops out, the slave keeps reacting
+			auto timeMs = 0;
+			while (timeMs < s_failoverTimeMs)
+			{
+				mirror.Advance(s_heartbeatIntervalMs);
+				timeMs += s_heartbeatIntervalMs;
+				mirror.UpdateOnlineState(s_slaveId);
+				mirror.RunLivenessCheck();
+			}
+			expect(mirror.IsMaster(s_masterId), "The master must not be failed over from before the failover time elapsed");
+
+			mirror.Advance(s_heartbeatIntervalMs);
+			mirror.RunLivenessCheck();
+			expect(mirror.IsMaster(s_slaveId), "The master has to be failed over from once the failover time elapsed");
+			expect(!mirror.IsMaster(s_masterId));
+			expectEquals(mirror.GetSentCount(s_slaveId, ROI_MatrixInput_Gain), 1, "The value missed by the new master has to be replayed to it");
+
+			// values from typeB are now forwarded to the new master
+			gain = 0.25f;
+			mirror.OnReceivedMessageFromProtocol(s_typeBId, ROI_MatrixInput_Gain, RemoteObjectMessageData(RemoteObjectAddressing(1, INVALID_ADDRESS_VALUE), ROVT_FLOAT, 1, &gain, sizeof(float)), RemoteObjectMessageMetaInfo());
+			expectEquals(mirror.GetSentCount(s_slaveId, ROI_MatrixInput_Gain), 2);
+			expectEquals(mirror.GetSentCount(s_masterId, ROI_MatrixInput_Gain), 1);
+		}
+
+		beginTest("No failover to a slave that dropped out as well");
+		{
+			SimulatedMirror mirror;
+			expect(mirror.Configure());
+
+			for (auto timeMs = 0; timeMs < 5 * s_failoverTimeMs; timeMs += s_heartbeatIntervalMs)
+			{
+				mirror.Advance(s_heartbeatIntervalMs);
+				mirror.RunLivenessCheck();
+			}
+
+			expect(mirror.IsMaster(s_masterId));
+		}
+	}
+
+private:
+	/**
+	 * Mirror data handling that runs on a simulated clock and captures the messages it sends instead of sending them via a node.
+	 */
+	class SimulatedMirror : public Mirror_dualA_withValFilter
+	{
+	public:
+		SimulatedMirror() : Mirror_dualA_withValFilter(nullptr)
+		{
+			// the reaction timeout is not relevant for the failover, it is kept out of the simulated time range
+			SetProtocolReactionTimeout(3600000);
+			AddProtocolAId(s_masterId);
+			AddProtocolAId(s_slaveId);
+			AddProtocolBId(s_typeBId);
+		}
+
+		bool Configure()
+		{
+			auto stateXml = std::make_unique<XmlElement>(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::OBJECTHANDLING));
+			stateXml->createNewChildElement(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::DATAPRECISION))->addTextElement(String(0.001));
+			auto failoverTimeXmlElement = stateXml->createNewChildElement(ProcessingEngineConfig::getTagName(ProcessingEngineConfig::TagID::FAILOVERTIME));
+			failoverTimeXmlElement->setAttribute(ProcessingEngineConfig::getAttributeName(ProcessingEngineConfig::AttributeID::INTERVAL), s_heartbeatIntervalMs);
+			failoverTimeXmlElement->addTextElement(String(s_failoverTimeMs));
+			return setStateXml(stateXml.get());
+		}
+
+		void Advance(int timeMs) { m_nowMs += static_cast<std::uint32_t>(timeMs); }
+		void RunLivenessCheck() { timerThreadCallback(); }
+		bool IsMaster(ProtocolId id) { return (GetProtocolState(id) & OHS_Protocol_Master) == OHS_Protocol_Master; }
+
+		int GetSentCount(ProtocolId id, RemoteObjectIdentifier roi)
+		{
+			const ScopedLock l(m_sentMessagesLock);
+			return static_cast<int>(std::count(m_sentMessages.begin(), m_sentMessages.end(), std::make_pair(id, roi)));
+		}
+
+	protected:
+		std::uint32_t GetMillisecondCounter() override { return m_nowMs; }
+
+		// the liveness checks are run by the test, not by the timer thread
+		int GetTimerThreadInterval() override { return 0; }
+
+		bool SendOutgoingMessage(const OutgoingMessage& outgoingMessage) override
+		{
+			const ScopedLock l(m_sentMessagesLock);
+			m_sentMessages.push_back(std::make_pair(outgoingMessage.PId, outgoingMessage.roi));
+			return true;
+		}
+
+	private:
+		std::atomic<std::uint32_t>									m_nowMs{ 100000 };
+		CriticalSection												m_sentMessagesLock;
+		std::vector<std::pair<ProtocolId, RemoteObjectIdentifier>>	m_sentMessages;
+	};
+
+	static constexpr ProtocolId s_masterId = 1;
+	static constexpr ProtocolId s_slaveId = 2;
+	static constexpr ProtocolId s_typeBId = 3;
+	static constexpr int s_failoverTimeMs = 1000;
+	static constexpr int s_heartbeatIntervalMs = 100;
+};
+
+static MirrorDualAFailoverTest mirrorDualAFailoverTest;
+
+
+// The data handling objects are tested without a parent node, so the node methods they refer to only have to be linkable.
+NodeId ProcessingEngineNode::GetId()
+{
+	return 0;
+}
+
+bool ProcessingEngineNode::SendMessageTo(ProtocolId, RemoteObjectIdentifier, const RemoteObjectMessageData&, const int) const
+{
+	return false;
+}
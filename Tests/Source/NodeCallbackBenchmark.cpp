@@ -0,0 +1,238 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <JuceHeader.h>
+
+#include <ProcessingEngineNode.h>
+
+
+/**
+ * Throughput benchmark of the node callback delivery, that hands the bridged messages to the node listeners
+ * e.g. for logging. Compares the headless mode, that delivers batches from an engine scheduler thread,
+ * to the message thread mode, that delivers batches through one message per interval, and to the previous
+ * handling, that posted one message per bridged message. Logs how long the node thread takes per message
+ * and how many messages reached the listener. Also checks that messages exceeding a batch are reported as dropped.
+ */
+class NodeCallbackBenchmark : public UnitTest
+{
+public:
+	NodeCallbackBenchmark() : UnitTest("NodeCallbacks", "Benchmarks") {}
+
+	void runTest() override
+	{
+		MessageManager::getInstance();
+
+		beginTest("Headless mode");
+		{
+			CountingListener listener;
+			ProcessingEngineNode::CallbackCollector collector;
+			collector.SetHeadlessMode(true);
+			collector.AddListener(&listener);
+			collector.Start();
+
+			// the message thread is not involved at all, so it is not dispatching here
+			auto nodeThreadNs = Measure([&collector](const ProcessingEngineNode::InterProtocolMessage& protocolMessage) { collector.CollectCallback(protocolMessage); }, false);
+			Thread::sleep(s_drainMs);
+			collector.Stop();
+
+			LogResult(nodeThreadNs, listener.GetMessageCount());
+			expectEquals(listener.GetMessageCount(), s_messageCount);
+		}
+
+		beginTest("Message thread mode");
+		{
+			CountingListener listener;
+			ProcessingEngineNode::CallbackCollector collector;
+			collector.SetHeadlessMode(false);
+			collector.AddListener(&listener);
+			collector.Start();
+
+			auto nodeThreadNs = Measure([&collector](const ProcessingEngineNode::InterProtocolMessage& protocolMessage) { collector.CollectCallback(protocolMessage); }, true);
+			MessageManager::getInstance()->runDispatchLoopUntil(s_drainMs);
+			collector.Stop();
+
+			LogResult(nodeThreadNs, listener.GetMessageCount());
+			expectEquals(listener.GetMessageCount(), s_messageCount);
+		}
+
+		beginTest("Message per callback, as before");
+		{
+			CountingListener listener;
+			PerMessagePoster poster(listener);
+
+			auto nodeThreadNs = Measure([&poster](const ProcessingEngineNode::InterProtocolMessage& protocolMessage) { poster.Post(protocolMessage); }, true);
+			MessageManager::getInstance()->runDispatchLoopUntil(s_drainMs);
+
+			LogResult(nodeThreadNs, listener.GetMessageCount());
+			expectEquals(listener.GetMessageCount(), s_messageCount);
+		}
+
+		beginTest("Dropped callbacks are reported");
+		{
+			CountingListener listener;
+			ProcessingEngineNode::CallbackCollector collector;
+			collector.SetHeadlessMode(true);
+			collector.AddListener(&listener);
+
+			// collect more than one batch holds before the delivery is started
+			for (auto i = 0; i < s_overflowCount; i++)
+			{
+				float values[2] = { 0.0f, float(i) };
+				auto msgData = RemoteObjectMessageData(RemoteObjectAddressing(static_cast<ChannelId>(1 + i % s_channelCount), 1), ROVT_FLOAT, 2, values, 2 * sizeof(float));
+				collector.CollectCallback(ProcessingEngineNode::InterProtocolMessage(1, 1, PT_OSCProtocol, ROI_CoordinateMapping_SourcePosition_XY, msgData, RemoteObjectMessageMetaInfo()));
+			}
+			collector.Start();
+			Thread::sleep(s_drainMs);
+			collector.Stop();
+
+			logMessage(String(listener.GetMessageCount()) + " of " + String(s_overflowCount) + " messages delivered, " + String(listener.GetDroppedCount()) + " reported as dropped");
+			expect(listener.GetMessageCount() < s_overflowCount);
+			expectEquals(listener.GetMessageCount() + listener.GetDroppedCount(), s_overflowCount);
+		}
+	}
+
+private:
+	/**
+	 * Node listener that counts the messages it is delivered.
+	 */
+	class CountingListener : public ProcessingEngineNode::NodeListener
+	{
+	public:
+		void HandleNodeData(const ProcessingEngineNode::NodeCallbackMessage* callbackMessage) override
+		{
+			ignoreUnused(callbackMessage);
+			m_messageCount++;
+		}
+
+		void HandleNodeDataBatch(const ProcessingEngineNode::InterProtocolMessage* protocolMessages, int messageCount) override
+		{
+			ignoreUnused(protocolMessages);
+			m_messageCount += messageCount;
+		}
+
+		void HandleNodeDataDropped(int droppedCount) override
+		{
+			m_droppedCount += droppedCount;
+		}
+
+		int GetMessageCount() const { return m_messageCount; }
+		int GetDroppedCount() const { return m_droppedCount; }
+
+	private:
+		std::atomic<int>	m_messageCount{ 0 };
+		std::atomic<int>	m_droppedCount{ 0 };
+	};
+
+	/**
+	 * The previous callback handling as reference, posting every message to the message thread on its own.
+	 */
+	class PerMessagePoster : public MessageListener
+	{
+	public:
+		explicit PerMessagePoster(ProcessingEngineNode::NodeListener& listener) : m_listener(listener) {}
+
+		void Post(const ProcessingEngineNode::InterProtocolMessage& protocolMessage)
+		{
+			postMessage(new ProcessingEngineNode::NodeCallbackMessage(protocolMessage));
+		}
+
+		void handleMessage(const Message& msg) override
+		{
+			if (auto* callbackMessage = dynamic_cast<const ProcessingEngineNode::NodeCallbackMessage*> (&msg))
+				m_listener.HandleNodeData(callbackMessage);
+		}
+
+	private:
+		ProcessingEngineNode::NodeListener&	m_listener;
+	};
+
+	/**
+	 * Thread that stands in for the node thread and hands the bridged messages on.
+	 */
+	class NodeThread : public Thread
+	{
+	public:
+		explicit NodeThread(const std::function<void()>& work) : Thread("NodeCallbackBenchmark_NodeThread"), m_work(work) {}
+		~NodeThread() override { stopThread(1000); }
+
+		void run() override { m_work(); }
+
+	private:
+		std::function<void()>	m_work;
+	};
+
+	/**
+	 * Hands source position messages of all channels on in bursts, at a rate a busy bridging node sees.
+	 * @param	handle				The callback handling to measure, called on the node thread.
+	 * @param	dispatchMessages	True to run the message thread's dispatch loop meanwhile.
+	 * @return	The average duration the node thread took to hand on one message, in nanoseconds.
+	 */
+	double Measure(const std::function<void(const ProcessingEngineNode::InterProtocolMessage&)>& handle, bool dispatchMessages)
+	{
+		std::atomic<double> handlingSeconds{ 0.0 };
+		std::atomic<bool> done{ false };
+		NodeThread nodeThread([&]() {
+			auto seconds = 0.0;
+			for (auto burst = 0; burst < s_messageCount / s_burstSize; burst++)
+			{
+				auto startTicks = Time::getHighResolutionTicks();
+				for (auto i = 0; i < s_burstSize; i++)
+				{
+					float values[2] = { float(burst), float(i) };
+					auto msgData = RemoteObjectMessageData(RemoteObjectAddressing(static_cast<ChannelId>(1 + i % s_channelCount), 1), ROVT_FLOAT, 2, values, 2 * sizeof(float));
+					handle(ProcessingEngineNode::InterProtocolMessage(1, 1, PT_OSCProtocol, ROI_CoordinateMapping_SourcePosition_XY, msgData, RemoteObjectMessageMetaInfo()));
+				}
+				seconds += Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - startTicks);
+				Thread::sleep(s_burstIntervalMs);
+			}
+			handlingSeconds = seconds;
+			done = true;
+		});
+		nodeThread.startThread();
+
+		while (!done)
+		{
+			if (dispatchMessages)
+				MessageManager::getInstance()->runDispatchLoopUntil(s_burstIntervalMs);
+			else
+				Thread::sleep(s_burstIntervalMs);
+		}
+		nodeThread.stopThread(1000);
+
+		return handlingSeconds * 1.0e9 / s_messageCount;
+	}
+
+	/**
+	 * Logs the result of one mode.
+	 * @param	nodeThreadNs		The average duration the node thread took per message, in nanoseconds.
+	 * @param	deliveredCount		The number of messages that reached the listener.
+	 */
+	void LogResult(double nodeThreadNs, int deliveredCount)
+	{
+		logMessage("Node thread: " + String(nodeThreadNs, 1) + " ns per message, " + String(deliveredCount) + " of " + String(s_messageCount) + " messages delivered");
+	}
+
+	static constexpr int s_messageCount = 100000;
+	static constexpr int s_burstSize = 500;				/**< Messages handed on per burst, so the rate stays below the callbacks a node collects per delivery interval. */
+	static constexpr int s_burstIntervalMs = 10;
+	static constexpr int s_channelCount = 128;
+	static constexpr int s_drainMs = 200;
+	static constexpr int s_overflowCount = 10000;		/**< Messages collected at once, more than a node delivers per interval. */
+};
+
+static NodeCallbackBenchmark nodeCallbackBenchmark;
@@ -0,0 +1,165 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <JuceHeader.h>
+
+#include <ProtocolProcessor/OCP1ProtocolProcessor/OCP1ProtocolProcessor.h>
+
+#include <NanoOcp1.h>
+#include <Ocp1DS100ObjectDefinitions.h>
+
+#include <cstdlib>
+#include <new>
+
+
+/**
+ * Heap allocations done by the current thread while counting is enabled.
+ * Counting is thread local to not pick up allocations of timer or network threads running in parallel.
+ */
+static thread_local bool s_countAllocations = false;
+static thread_local int s_allocationCount = 0;
+
+void* operator new(std::size_t size)
+{
+	if (s_countAllocations)
+		s_allocationCount++;
+
+	if (auto ptr = std::malloc(size > 0 ? size : 1))
+		return ptr;
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+
+/**
+ * Unit tests verifying that the OCP1 notification processing does not allocate on top of the NanoOcp decoding.
+ * The NanoOcp1::Variant conversion of position values allocates itself, which is out of scope of this library,
+ * so the allocations of the processor are compared to the allocations of the bare NanoOcp decoding calls.
+ */
+class OCP1NotificationAllocationTest : public UnitTest
+{
+public:
+	OCP1NotificationAllocationTest() : UnitTest("OCP1NotificationAllocation", "ProtocolProcessor") {}
+
+	void runTest() override
+	{
+		beginTest("Position notifications do not allocate beyond the NanoOcp decoding");
+		{
+			auto objDef = NanoOcp1::DS100::dbOcaObjectDef_Positioning_Source_Position(1);
+
+			std::vector<std::unique_ptr<NanoOcp1::Ocp1Notification>> notifications;
+			for (auto i = 0; i < s_notificationCount; i++)
+				notifications.push_back(CreateNotification(objDef, NanoOcp1::DataFromPosition(0.001f * i, 0.5f, 0.0f)));
+
+			auto nanoOcpAllocationCount = CountAllocations([&] {
+				for (auto const& notification : notifications)
+				{
+					bool ok = false;
+					NanoOcp1::Variant(notification->GetParameterData()).ToPosition(&ok);
+				}
+			});
+
+			// position, xy, x and y are forwarded per notification
+			expectEquals(CountProcessorAllocations(notifications, 4), nanoOcpAllocationCount);
+		}
+
+		beginTest("Scalar notifications do not allocate beyond the NanoOcp decoding");
+		{
+			auto objDef = NanoOcp1::DS100::dbOcaObjectDef_Status_AudioNetworkSampleStatus();
+
+			std::vector<std::unique_ptr<NanoOcp1::Ocp1Notification>> notifications;
+			for (auto i = 0; i < s_notificationCount; i++)
+				notifications.push_back(CreateNotification(objDef, NanoOcp1::Variant(static_cast<std::int32_t>(i % 2)).ToByteVector()));
+
+			auto nanoOcpAllocationCount = CountAllocations([&] {
+				for (auto const& notification : notifications)
+					NanoOcp1::DataToInt32(notification->GetParameterData());
+			});
+
+			expectEquals(CountProcessorAllocations(notifications, 1), nanoOcpAllocationCount);
+		}
+	}
+
+private:
+	/**
+	 * Listener counting the forwarded messages, without allocating itself.
+	 */
+	class ForwardedMessageCounter : public ProtocolProcessorBase::Listener
+	{
+	public:
+		void OnProtocolMessageReceived(ProtocolProcessorBase*, const RemoteObjectIdentifier, const RemoteObjectMessageData&, const RemoteObjectMessageMetaInfo&) override
+		{
+			m_forwardedCount++;
+		}
+
+		int	m_forwardedCount{ 0 };
+	};
+
+	static std::unique_ptr<NanoOcp1::Ocp1Notification> CreateNotification(const NanoOcp1::Ocp1CommandDefinition& objDef, const std::vector<std::uint8_t>& parameterData)
+	{
+		return std::make_unique<NanoOcp1::Ocp1Notification>(objDef.m_targetOno, objDef.m_propertyDefLevel, objDef.m_propertyIndex, static_cast<std::uint8_t>(1), parameterData);
+	}
+
+	template <class F>
+	static int CountAllocations(F&& function)
+	{
+		s_allocationCount = 0;
+		s_countAllocations = true;
+		function();
+		s_countAllocations = false;
+
+		return s_allocationCount;
+	}
+
+	/**
+	 * Passes the notifications to a processor once to populate its value cache and a second time while counting the allocations,
+	 * to measure the steady state of repeated notifications for the same objects.
+	 */
+	int CountProcessorAllocations(const std::vector<std::unique_ptr<NanoOcp1::Ocp1Notification>>& notifications, int forwardsPerNotification)
+	{
+		OCP1ProtocolProcessor processor(0);
+		ForwardedMessageCounter counter;
+		processor.AddListener(&counter);
+
+		for (auto const& notification : notifications)
+			processor.OnSharedConnectionMessageReceived(notification.get());
+
+		auto allocationCount = CountAllocations([&] {
+			for (auto const& notification : notifications)
+				processor.OnSharedConnectionMessageReceived(notification.get());
+		});
+
+		expectEquals(counter.m_forwardedCount, 2 * s_notificationCount * forwardsPerNotification);
+
+		return allocationCount;
+	}
+
+	static constexpr int s_notificationCount = 100;
+};
+
+static OCP1NotificationAllocationTest ocp1NotificationAllocationTest;
@@ -0,0 +1,144 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <JuceHeader.h>
+
+#include <ObjectDataHandling/Forward_only_valueChanges/ObjectValueStore.h>
+
+
+/**
+ * Benchmark of the change detection of Forward_only_valueChanges for 128 channels of 10 remote objects.
+ * Measures ObjectValueStore against the previous nested std::map of values, that was compared value by value
+ * and stored a newly allocated copy of every changed value.
+ */
+class ObjectValueStoreBenchmark : public UnitTest
+{
+public:
+	ObjectValueStoreBenchmark() : UnitTest("ObjectValueStore", "Benchmarks") {}
+
+	void runTest() override
+	{
+		beginTest("Change detection for " + String(s_channelCount) + " channels x " + String(s_objectCount) + " objects");
+		{
+			std::vector<std::unique_ptr<ObjectValueStore>> valueStores;
+			for (auto i = 0; i < s_objectCount; i++)
+				valueStores.push_back(std::make_unique<ObjectValueStore>());
+
+			auto storeNs = Measure([&](int objectIndex, const RemoteObjectMessageData& msgData) {
+				auto& valueStore = *valueStores[objectIndex];
+				auto slot = valueStore.FindSlot(msgData._addrVal);
+				auto isChanged = (slot < 0) || valueStore.IsChangedValue(slot, msgData, s_precision);
+				if (isChanged)
+					valueStore.SetValue(valueStore.GetOrCreateSlot(msgData._addrVal), msgData);
+				return isChanged;
+			});
+
+			std::map<int, std::map<RemoteObjectAddressing, RemoteObjectMessageData>> mapValues;
+			auto mapNs = Measure([&](int objectIndex, const RemoteObjectMessageData& msgData) {
+				auto isChanged = IsChangedMapValue(mapValues, objectIndex, msgData);
+				if (isChanged)
+					mapValues[objectIndex][msgData._addrVal].payloadCopy(msgData);
+				return isChanged;
+			});
+
+			logMessage("ObjectValueStore: " + String(storeNs, 1) + " ns per value, nested std::map: " + String(mapNs, 1) + " ns per value");
+		}
+
+		beginTest("Value type changes reuse the slot");
+		{
+			ObjectValueStore valueStore;
+			auto slot = valueStore.GetOrCreateSlot(RemoteObjectAddressing(1, 1));
+			for (auto i = 0; i < 100; i++)
+			{
+				float floatValues[2] = { float(i), float(i) + 0.5f };
+				valueStore.SetValue(slot, RemoteObjectMessageData(RemoteObjectAddressing(1, 1), ROVT_FLOAT, 2, floatValues, 2 * sizeof(float)));
+				expect(!valueStore.IsChangedValue(slot, RemoteObjectMessageData(RemoteObjectAddressing(1, 1), ROVT_FLOAT, 2, floatValues, 2 * sizeof(float)), s_precision));
+
+				int intValue = i;
+				valueStore.SetValue(slot, RemoteObjectMessageData(RemoteObjectAddressing(1, 1), ROVT_INT, 1, &intValue, sizeof(int)));
+				auto value = valueStore.GetValue(slot);
+				expect(value._valType == ROVT_INT && value._valCount == 1 && static_cast<int*>(value._payload)[0] == i);
+			}
+			expectEquals(valueStore.GetSlotCount(), 1);
+		}
+	}
+
+private:
+	/**
+	 * The previous change detection as reference, comparing value by value against the nested std::map of values.
+	 * @param	mapValues	The values known per object and addressing.
+	 * @param	objectIndex	The object the value is received for.
+	 * @param	msgData		The received value.
+	 * @return	True if the value differs from the known one.
+	 */
+	static bool IsChangedMapValue(const std::map<int, std::map<RemoteObjectAddressing, RemoteObjectMessageData>>& mapValues, int objectIndex, const RemoteObjectMessageData& msgData)
+	{
+		auto objectValuesIter = mapValues.find(objectIndex);
+		if (objectValuesIter == mapValues.end())
+			return true;
+		auto valueIter = objectValuesIter->second.find(msgData._addrVal);
+		if (valueIter == objectValuesIter->second.end())
+			return true;
+
+		auto const& currentVal = valueIter->second;
+		if (currentVal._valType != msgData._valType || currentVal._valCount != msgData._valCount || currentVal._payloadSize != msgData._payloadSize)
+			return true;
+
+		auto isChanged = false;
+		for (int i = 0; i < currentVal._valCount; ++i)
+			isChanged = isChanged || (std::fabs(static_cast<float*>(currentVal._payload)[i] - static_cast<float*>(msgData._payload)[i]) > s_precision);
+		return isChanged;
+	}
+
+	/**
+	 * Sends position values for all channels of all objects in turns, every other round with a changed value.
+	 * @param	handle	The change detection under test, returning if the value is regarded as changed.
+	 * @return	The average duration of the change detection of one value, in nanoseconds.
+	 */
+	double Measure(const std::function<bool(int, const RemoteObjectMessageData&)>& handle)
+	{
+		auto changedCount = 0;
+		auto valueCount = 0;
+		auto startTicks = Time::getHighResolutionTicks();
+		for (auto round = 0; round < s_roundCount; round++)
+		{
+			for (auto objectIndex = 0; objectIndex < s_objectCount; objectIndex++)
+			{
+				for (auto channel = 1; channel <= s_channelCount; channel++)
+				{
+					float values[2] = { float(round / 2), float(channel) };
+					if (handle(objectIndex, RemoteObjectMessageData(RemoteObjectAddressing(static_cast<ChannelId>(channel), 1), ROVT_FLOAT, 2, values, 2 * sizeof(float))))
+						changedCount++;
+					valueCount++;
+				}
+			}
+		}
+		auto durationSeconds = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - startTicks);
+
+		// the value changes every second round
+		expectEquals(changedCount, (s_roundCount + 1) / 2 * s_objectCount * s_channelCount);
+		return durationSeconds * 1.0e9 / valueCount;
+	}
+
+	static constexpr int s_channelCount = 128;
+	static constexpr int s_objectCount = 10;
+	static constexpr int s_roundCount = 200;
+	static constexpr float s_precision = 0.001f;
+};
+
+static ObjectValueStoreBenchmark objectValueStoreBenchmark;
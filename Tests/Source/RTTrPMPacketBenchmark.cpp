@@ -0,0 +1,150 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <JuceHeader.h>
+
+#include <ProtocolProcessor/RTTrPMProtocolProcessor/RTTrPMReceiver/RTTrPMReceiver.h>
+
+
+/**
+ * Benchmark of the RTTrPM datagram handling of RTTrPMReceiver for a maximum size packet.
+ * Measures decoding in place, as done if only realtime listeners are registered, and decoding once from the
+ * datagram copy a posted message holds, compared to the previous handling that decoded, copied and decoded again.
+ */
+class RTTrPMPacketBenchmark : public UnitTest
+{
+public:
+	RTTrPMPacketBenchmark() : UnitTest("RTTrPMPacket", "Benchmarks") {}
+
+	void runTest() override
+	{
+		auto datagram = CreateDatagram(RTTrPMPacket::MaxTrackables);
+		auto data = static_cast<const unsigned char*>(datagram.getData());
+		auto dataSize = datagram.getSize();
+
+		auto receivedPacket = std::make_unique<RTTrPMPacket>();
+		auto callbackPacket = std::make_unique<RTTrPMPacket>();
+
+		beginTest("Decoding " + String(RTTrPMPacket::MaxTrackables) + " trackables");
+		{
+			auto decodeNs = Measure([&]() {
+				receivedPacket->Decode(data, dataSize);
+				return receivedPacket->GetTrackableCount();
+			});
+
+			logMessage("Decode: " + String(decodeNs, 1) + " ns per datagram");
+			expectEquals(receivedPacket->GetTrackableCount(), RTTrPMPacket::MaxTrackables);
+			expectEquals(receivedPacket->GetSubModuleCount(), RTTrPMPacket::MaxTrackables);
+			expect(receivedPacket->GetTrackable(RTTrPMPacket::MaxTrackables - 1).name == "Trackable254");
+		}
+
+		beginTest("Handing " + String(RTTrPMPacket::MaxTrackables) + " trackables on to posted listeners");
+		{
+			auto decodeOnceNs = Measure([&]() {
+				RTTrPMReceiver::CallbackMessage callbackMessage(data, dataSize, "127.0.0.1", 24100, std::move(callbackPacket));
+				auto& messageDatagram = callbackMessage.contentRTTrPM;
+				callbackMessage.decodedPacket->Decode(static_cast<const unsigned char*>(messageDatagram.getData()), messageDatagram.getSize());
+				auto trackableCount = callbackMessage.decodedPacket->GetTrackableCount();
+				callbackPacket = std::move(callbackMessage.decodedPacket);
+				return trackableCount;
+			});
+
+			auto decodeAgainNs = Measure([&]() {
+				receivedPacket->Decode(data, dataSize);
+				MemoryBlock datagramCopy(data, dataSize);
+				callbackPacket->Decode(static_cast<const unsigned char*>(datagramCopy.getData()), datagramCopy.getSize());
+				return callbackPacket->GetTrackableCount();
+			});
+
+			logMessage("Copied and decoded once: " + String(decodeOnceNs, 1) + " ns per datagram, decoded, copied and decoded again: " + String(decodeAgainNs, 1) + " ns per datagram");
+
+			RTTrPMReceiver::CallbackMessage callbackMessage(data, dataSize, "127.0.0.1", 24100, std::move(callbackPacket));
+			auto& messageDatagram = callbackMessage.contentRTTrPM;
+			callbackMessage.decodedPacket->Decode(static_cast<const unsigned char*>(messageDatagram.getData()), messageDatagram.getSize());
+			expectEquals(callbackMessage.decodedPacket->GetTrackableCount(), RTTrPMPacket::MaxTrackables);
+			expect(callbackMessage.decodedPacket->GetTrackable(0).name == "Trackable0");
+			expect(callbackMessage.decodedPacket->GetTrackable(0).name.data() != reinterpret_cast<const char*>(data));
+			expectEquals(callbackMessage.decodedPacket->GetSubModule(1).centroidPosition.x, 1.0);
+		}
+	}
+
+private:
+	/**
+	 * Creates a little endian RTTrPM datagram with the given number of trackables, each with one centroid position module.
+	 * @param	trackableCount	The number of trackables.
+	 * @return	The datagram.
+	 */
+	static MemoryBlock CreateDatagram(int trackableCount)
+	{
+		MemoryOutputStream stream;
+		stream.writeShort(static_cast<short>(RTTrPMHeader::LittleEndianInt));
+		stream.writeShort(static_cast<short>(RTTrPMHeader::LittleEndianFloat));
+		stream.writeShort(static_cast<short>(RTTrPMHeader::PacketModuleHeaderVersion));
+		stream.writeInt(1); // packet id
+		stream.writeByte(static_cast<char>(RTTrPMHeader::Raw));
+		auto packetSizePos = stream.getPosition();
+		stream.writeShort(0); // packet size, written below
+		stream.writeInt(0); // context
+		stream.writeByte(static_cast<char>(trackableCount));
+
+		for (auto i = 0; i < trackableCount; i++)
+		{
+			auto name = "Trackable" + String(i);
+			stream.writeByte(static_cast<char>(PacketModule::WithoutTimestamp));
+			stream.writeShort(static_cast<short>(3 + 1 + name.length() + 1 + s_centroidModuleSize));
+			stream.writeByte(static_cast<char>(name.length()));
+			stream.write(name.toRawUTF8(), static_cast<size_t>(name.length()));
+			stream.writeByte(1); // number of sub-modules
+
+			stream.writeByte(static_cast<char>(PacketModule::CentroidPosition));
+			stream.writeShort(static_cast<short>(s_centroidModuleSize));
+			stream.writeShort(0); // latency
+			stream.writeDouble(double(i));
+			stream.writeDouble(0.5);
+			stream.writeDouble(0.0);
+		}
+
+		auto packetSize = static_cast<short>(stream.getPosition());
+		stream.setPosition(packetSizePos);
+		stream.writeShort(packetSize);
+
+		return stream.getMemoryBlock();
+	}
+
+	/**
+	 * Runs the given handling repeatedly.
+	 * @param	handle	The handling to measure, returning the number of handled trackables.
+	 * @return	The average duration of one handling, in nanoseconds.
+	 */
+	double Measure(const std::function<int()>& handle)
+	{
+		auto handledTrackableCount = 0;
+		auto startTicks = Time::getHighResolutionTicks();
+		for (auto i = 0; i < s_datagramCount; i++)
+			handledTrackableCount += handle();
+		auto durationSeconds = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - startTicks);
+
+		expectEquals(handledTrackableCount, s_datagramCount * RTTrPMPacket::MaxTrackables);
+		return durationSeconds * 1.0e9 / s_datagramCount;
+	}
+
+	static constexpr int s_datagramCount = 20000;
+	static constexpr int s_centroidModuleSize = 3 + 2 + 3 * 8;
+};
+
+static RTTrPMPacketBenchmark rttrpmPacketBenchmark;
@@ -0,0 +1,126 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <JuceHeader.h>
+
+#include <ProtocolProcessor/RTTrPMProtocolProcessor/RTTrPMProtocolProcessor.h>
+
+
+/**
+ * Benchmark of the RTTrPM coordinate mapping for 256 trackable positions per packet.
+ * Measures the batched mapping of RTTrPMProtocolProcessor::TransformPositions, that maps and clamps
+ * all positions of a packet in one pass per axis, compared to the previous per trackable mapping
+ * that returned a newly allocated vector for every position.
+ */
+class RTTrPMPositionMappingBenchmark : public UnitTest
+{
+public:
+	RTTrPMPositionMappingBenchmark() : UnitTest("RTTrPMPositionMapping", "Benchmarks") {}
+
+	void runTest() override
+	{
+		auto random = getRandom();
+		for (auto i = 0; i < s_positionCount; i++)
+		{
+			m_x[i] = random.nextFloat() * 20.0f - 10.0f;
+			m_y[i] = random.nextFloat() * 20.0f - 10.0f;
+		}
+
+		// the mapping of the previous per trackable implementation, (p - start) / length, as affine transform
+		auto scaleX = 1.0f / s_rangeX.getLength();
+		auto offsetX = -s_rangeX.getStart() / s_rangeX.getLength();
+		auto scaleY = 1.0f / s_rangeY.getLength();
+		auto offsetY = -s_rangeY.getStart() / s_rangeY.getLength();
+
+		beginTest("Mapping " + String(s_positionCount) + " positions per packet");
+		{
+			auto batchedNs = Measure([&]() {
+				RTTrPMProtocolProcessor::TransformPositions(m_x.data(), m_mappedX.data(), s_positionCount, scaleX, offsetX, true);
+				RTTrPMProtocolProcessor::TransformPositions(m_y.data(), m_mappedY.data(), s_positionCount, scaleY, offsetY, true);
+				return m_mappedX[s_positionCount - 1] + m_mappedY[s_positionCount - 1];
+			});
+
+			auto perTrackableNs = Measure([&]() {
+				for (auto i = 0; i < s_positionCount; i++)
+				{
+					auto mappedPosition = GetMappedPosition({ m_x[i], m_y[i] });
+					m_referenceX[i] = jlimit(0.0f, 1.0f, mappedPosition[0]);
+					m_referenceY[i] = jlimit(0.0f, 1.0f, mappedPosition[1]);
+				}
+				return m_referenceX[s_positionCount - 1] + m_referenceY[s_positionCount - 1];
+			});
+
+			logMessage("Batched: " + String(batchedNs, 1) + " ns per packet, per trackable: " + String(perTrackableNs, 1) + " ns per packet");
+
+			for (auto i = 0; i < s_positionCount; i++)
+			{
+				expectWithinAbsoluteError(m_mappedX[i], m_referenceX[i], 1.0e-6f);
+				expectWithinAbsoluteError(m_mappedY[i], m_referenceY[i], 1.0e-6f);
+				expect(m_mappedX[i] >= 0.0f && m_mappedX[i] <= 1.0f);
+				expect(m_mappedY[i] >= 0.0f && m_mappedY[i] <= 1.0f);
+			}
+		}
+	}
+
+private:
+	/**
+	 * The previous per trackable mapping of a position to the mapping area, kept as reference.
+	 * @param	position	The xy position to be mapped.
+	 * @return	The mapped xy position value.
+	 */
+	static std::vector<float> GetMappedPosition(const std::vector<float>& position)
+	{
+		std::vector<float> mappedPosition(2);
+		mappedPosition[0] = (position.at(0) - s_rangeX.getStart()) / s_rangeX.getLength();
+		mappedPosition[1] = (position.at(1) - s_rangeY.getStart()) / s_rangeY.getLength();
+
+		return mappedPosition;
+	}
+
+	/**
+	 * Runs the given mapping repeatedly.
+	 * @param	map	The mapping to measure, returning a mapped value so it is not optimised away.
+	 * @return	The average duration of one mapping of a packet, in nanoseconds.
+	 */
+	double Measure(const std::function<float()>& map)
+	{
+		auto checksum = 0.0f;
+		auto startTicks = Time::getHighResolutionTicks();
+		for (auto i = 0; i < s_packetCount; i++)
+			checksum += map();
+		auto durationSeconds = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - startTicks);
+
+		expect(checksum >= 0.0f);
+		return durationSeconds * 1.0e9 / s_packetCount;
+	}
+
+	static constexpr int s_positionCount = 256;
+	static constexpr int s_packetCount = 20000;
+
+	static inline const Range<float> s_rangeX{ -5.0f, 5.0f };
+	static inline const Range<float> s_rangeY{ -4.0f, 6.0f };
+
+	std::array<float, s_positionCount>	m_x;
+	std::array<float, s_positionCount>	m_y;
+	std::array<float, s_positionCount>	m_mappedX;
+	std::array<float, s_positionCount>	m_mappedY;
+	std::array<float, s_positionCount>	m_referenceX;
+	std::array<float, s_positionCount>	m_referenceY;
+};
+
+static RTTrPMPositionMappingBenchmark rttrpmPositionMappingBenchmark;
@@ -0,0 +1,133 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <JuceHeader.h>
+
+#include <RemoteObjectValueCache.h>
+
+
+/**
+ * Benchmark of RemoteObjectValueCache against the previous std::map based cache,
+ * that deep copied all values into a new snapshot on the first read after every write.
+ * Measures a continuous write stream that is interleaved with snapshot reads.
+ */
+class RemoteObjectValueCacheBenchmark : public UnitTest
+{
+public:
+	RemoteObjectValueCacheBenchmark() : UnitTest("RemoteObjectValueCache", "Benchmarks") {}
+
+	void runTest() override
+	{
+		for (auto readInterval : { 1, 16, 256 })
+		{
+			beginTest("Write stream with a snapshot read every " + String(readInterval) + " writes");
+
+			RemoteObjectValueCache cache;
+			auto cacheNs = Measure(readInterval,
+				[&cache](const RemoteObject& ro, const RemoteObjectMessageData& valueData) { cache.SetValue(ro, valueData); },
+				[&cache]() {
+					auto valueCount = 0;
+					for (auto const& value : *cache.GetCachedValues())
+						valueCount += value.second->_valCount;
+					return valueCount;
+				});
+
+			MapValueCache mapCache;
+			auto mapCacheNs = Measure(readInterval,
+				[&mapCache](const RemoteObject& ro, const RemoteObjectMessageData& valueData) { mapCache.SetValue(ro, valueData); },
+				[&mapCache]() {
+					auto valueCount = 0;
+					for (auto const& value : *mapCache.GetCachedValues())
+						valueCount += value.second._valCount;
+					return valueCount;
+				});
+
+			logMessage("RemoteObjectValueCache: " + String(cacheNs, 1) + " ns per write, std::map cache: " + String(mapCacheNs, 1) + " ns per write");
+			expect(cacheNs > 0.0 && mapCacheNs > 0.0);
+		}
+	}
+
+private:
+	/**
+	 * The previous cache implementation as reference, a std::map that is deep copied into a new snapshot
+	 * on the first read after a write.
+	 */
+	class MapValueCache
+	{
+	public:
+		void SetValue(const RemoteObject& ro, const RemoteObjectMessageData& valueData)
+		{
+			const ScopedLock l(m_cachedValuesLock);
+			m_cachedValues[ro].payloadCopy(valueData);
+			m_isDirty = true;
+		}
+
+		std::shared_ptr<const std::map<RemoteObject, RemoteObjectMessageData>> GetCachedValues()
+		{
+			const ScopedLock l(m_cachedValuesLock);
+			if (m_isDirty)
+			{
+				auto snapshot = std::make_shared<std::map<RemoteObject, RemoteObjectMessageData>>();
+				for (auto const& cachedValue : m_cachedValues)
+					(*snapshot)[cachedValue.first].payloadCopy(cachedValue.second);
+				m_snapshot = snapshot;
+				m_isDirty = false;
+			}
+			return m_snapshot;
+		}
+
+	private:
+		std::map<RemoteObject, RemoteObjectMessageData>						m_cachedValues;
+		CriticalSection														m_cachedValuesLock;
+		std::shared_ptr<const std::map<RemoteObject, RemoteObjectMessageData>>	m_snapshot;
+		bool																m_isDirty{ true };
+	};
+
+	/**
+	 * Writes source positions for all benchmarked objects in turns and reads a snapshot every readInterval writes.
+	 * @param	readInterval	The number of writes between two snapshot reads
+	 * @param	write			The function to write a value to the cache under test
+	 * @param	read			The function to read and iterate a snapshot of the cache under test
+	 * @return	The average duration of one write including its share of snapshot reads, in nanoseconds.
+	 */
+	double Measure(int readInterval,
+		const std::function<void(const RemoteObject&, const RemoteObjectMessageData&)>& write,
+		const std::function<int()>& read)
+	{
+		auto readValueCount = 0;
+		auto startTicks = Time::getHighResolutionTicks();
+		for (auto i = 0; i < s_writeCount; i++)
+		{
+			auto ro = RemoteObject(ROI_CoordinateMapping_SourcePosition, RemoteObjectAddressing(static_cast<ChannelId>(1 + (i % s_channelCount)), 1));
+			float values[3] = { float(i), float(i), float(i) };
+			write(ro, RemoteObjectMessageData(ro._Addr, ROVT_FLOAT, 3, values, 3 * sizeof(float)));
+
+			if (i % readInterval == 0)
+				readValueCount += read();
+		}
+		auto durationSeconds = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - startTicks);
+
+		expect(readValueCount > 0);
+		return durationSeconds * 1.0e9 / s_writeCount;
+	}
+
+	static constexpr int s_writeCount = 200000;
+	static constexpr int s_channelCount = 512;
+};
+
+static RemoteObjectValueCacheBenchmark remoteObjectValueCacheBenchmark;
@@ -0,0 +1,166 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <JuceHeader.h>
+
+#include <RemoteObjectValueCache.h>
+
+
+/**
+ * Unit tests for RemoteObjectValueCache, covering value access, snapshot reuse
+ * and concurrent writing while snapshots are read.
+ */
+class RemoteObjectValueCacheTest : public UnitTest
+{
+public:
+	RemoteObjectValueCacheTest() : UnitTest("RemoteObjectValueCache", "ProcessingEngine") {}
+
+	void runTest() override
+	{
+		beginTest("Set and get values");
+		{
+			RemoteObjectValueCache cache;
+			auto ro = RemoteObject(ROI_MatrixInput_Gain, RemoteObjectAddressing(1, INVALID_ADDRESS_VALUE));
+			expect(!cache.Contains(ro));
+
+			auto gain = -6.0f;
+			cache.SetValue(ro, RemoteObjectMessageData(ro._Addr, ROVT_FLOAT, 1, &gain, sizeof(float)));
+			gain = 0.0f; // the cache has to hold its own copy
+			expect(cache.Contains(ro));
+			expectEquals(cache.GetFloatValue(ro), -6.0f);
+
+			auto valueData = RemoteObjectMessageData();
+			expect(cache.GetValue(ro, valueData));
+			expectEquals(static_cast<int>(valueData._valCount), 1);
+			expectEquals(*static_cast<float*>(valueData._payload), -6.0f);
+		}
+
+		beginTest("Update single float values");
+		{
+			RemoteObjectValueCache cache;
+			auto ro = RemoteObject(ROI_CoordinateMapping_SourcePosition, RemoteObjectAddressing(1, 1));
+			float x = 0.25f;
+			float updatedValues[3];
+			expect(cache.UpdateFloatValues(ro, 3, 0, &x, 1, updatedValues));
+			expectEquals(updatedValues[0], 0.25f);
+			expectEquals(updatedValues[1], 0.0f);
+			expectEquals(updatedValues[2], 0.0f);
+
+			float yz[2] = { 0.5f, 0.75f };
+			expect(cache.UpdateFloatValues(ro, 3, 1, yz, 2, updatedValues));
+			expectEquals(updatedValues[0], 0.25f);
+			expectEquals(updatedValues[2], 0.75f);
+
+			expect(!cache.UpdateFloatValues(ro, 2, 0, yz, 2, updatedValues), "A value count mismatch must be rejected");
+		}
+
+		beginTest("Snapshots are only rebuilt after changes");
+		{
+			RemoteObjectValueCache cache;
+			auto ro = RemoteObject(ROI_MatrixInput_Mute, RemoteObjectAddressing(2, INVALID_ADDRESS_VALUE));
+			auto mute = 1;
+			cache.SetValue(ro, RemoteObjectMessageData(ro._Addr, ROVT_INT, 1, &mute, sizeof(int)));
+
+			auto firstSnapshot = cache.GetCachedValues();
+			expect(firstSnapshot == cache.GetCachedValues(), "An unchanged cache has to hand out the same snapshot");
+			expectEquals(static_cast<int>(firstSnapshot->size()), 1);
+
+			cache.UpdateValues([](const RemoteObject&, RemoteObjectMessageData&) { return false; });
+			expect(firstSnapshot == cache.GetCachedValues(), "Updates that do not modify values must not invalidate the snapshot");
+
+			cache.UpdateValues([](const RemoteObject&, RemoteObjectMessageData& valueData) {
+				*static_cast<int*>(valueData._payload) = 0;
+				return true;
+			});
+			auto secondSnapshot = cache.GetCachedValues();
+			expect(firstSnapshot != secondSnapshot);
+			expectEquals(*static_cast<int*>(firstSnapshot->front().second->_payload), 1, "A snapshot must not change once handed out");
+			expectEquals(*static_cast<int*>(secondSnapshot->front().second->_payload), 0);
+		}
+
+		beginTest("Concurrent writing and snapshot reading");
+		{
+			RemoteObjectValueCache cache;
+			std::atomic<bool> isWriting{ true };
+			std::atomic<int> inconsistentSnapshotCount{ 0 };
+
+			// every value is written with all three components set to the same number,
+			// so a torn value would show up as differing components in a snapshot
+			std::vector<std::unique_ptr<Thread>> writers;
+			for (auto writerIndex = 0; writerIndex < s_writerCount; writerIndex++)
+			{
+				writers.push_back(std::make_unique<TestThread>([&cache, writerIndex]() {
+					for (auto i = 1; i <= s_writeCount; i++)
+					{
+						auto ro = RemoteObject(ROI_CoordinateMapping_SourcePosition, RemoteObjectAddressing(static_cast<ChannelId>(1 + (i % s_channelCount)), static_cast<RecordId>(1 + writerIndex)));
+						float values[3] = { float(i), float(i), float(i) };
+						cache.SetValue(ro, RemoteObjectMessageData(ro._Addr, ROVT_FLOAT, 3, values, 3 * sizeof(float)));
+					}
+				}));
+			}
+			TestThread reader([&cache, &isWriting, &inconsistentSnapshotCount]() {
+				while (isWriting)
+				{
+					for (auto const& value : *cache.GetCachedValues())
+					{
+						auto values = static_cast<float*>(value.second->_payload);
+						if (value.second->_valCount != 3 || values[0] != values[1] || values[1] != values[2])
+							inconsistentSnapshotCount++;
+					}
+				}
+			});
+
+			reader.startThread();
+			for (auto const& writer : writers)
+				writer->startThread();
+			for (auto const& writer : writers)
+				writer->waitForThreadToExit(s_threadTimeoutMs);
+			isWriting = false;
+			reader.waitForThreadToExit(s_threadTimeoutMs);
+
+			expectEquals(inconsistentSnapshotCount.load(), 0);
+			expectEquals(static_cast<int>(cache.GetCachedValues()->size()), s_writerCount * s_channelCount);
+			for (auto writerIndex = 0; writerIndex < s_writerCount; writerIndex++)
+			{
+				auto lastWrittenValues = cache.GetTripleFloatValues(RemoteObject(ROI_CoordinateMapping_SourcePosition, RemoteObjectAddressing(static_cast<ChannelId>(1 + (s_writeCount % s_channelCount)), static_cast<RecordId>(1 + writerIndex))));
+				expectEquals(std::get<0>(lastWrittenValues), float(s_writeCount));
+			}
+		}
+	}
+
+private:
+	/**
+	 * Thread that runs a given function once.
+	 */
+	class TestThread : public Thread
+	{
+	public:
+		explicit TestThread(std::function<void()> function) : Thread("RemoteObjectValueCacheTest"), m_function(std::move(function)) {}
+		void run() override { m_function(); }
+
+	private:
+		std::function<void()> m_function;
+	};
+
+	static constexpr int s_writerCount = 4;
+	static constexpr int s_writeCount = 20000;
+	static constexpr int s_channelCount = 64;
+	static constexpr int s_threadTimeoutMs = 10000;
+};
+
+static RemoteObjectValueCacheTest remoteObjectValueCacheTest;
@@ -0,0 +1,116 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <JuceHeader.h>
+
+#include <TimerThreadBase.h>
+
+
+/**
+ * Benchmark of the TimerThreadScheduler with the timer load of 10, 50 and 200 protocol processors,
+ * each running a polling timer as the OSC and OCP1 processors do. Logs how late the callbacks are called
+ * compared to their interval and how often the scheduler threads woke up for it.
+ */
+class TimerThreadSchedulerBenchmark : public UnitTest
+{
+public:
+	TimerThreadSchedulerBenchmark() : UnitTest("TimerThreadScheduler", "Benchmarks") {}
+
+	void runTest() override
+	{
+		for (auto processorCount : { 10, 50, 200 })
+		{
+			beginTest(String(processorCount) + " processors");
+
+			SharedResourcePointer<TimerThreadScheduler> scheduler;
+			auto startWakeupCount = scheduler->GetWakeupCount();
+
+			std::vector<std::unique_ptr<LatenessTimer>> timers;
+			for (auto i = 0; i < processorCount; i++)
+			{
+				timers.push_back(std::make_unique<LatenessTimer>(s_callbackInterval));
+				timers.back()->startTimerThread(s_callbackInterval, i % s_callbackInterval);
+			}
+
+			Thread::sleep(s_durationMs);
+			for (auto const& timer : timers)
+				timer->stopTimerThread();
+
+			auto callbackCount = 0;
+			auto overrunCount = 0;
+			auto latenessSumMs = 0.0;
+			auto maxLatenessMs = 0.0;
+			for (auto const& timer : timers)
+			{
+				callbackCount += timer->GetCallbackCount();
+				overrunCount += timer->getTimerThreadOverrunCount();
+				latenessSumMs += timer->GetLatenessSumMs();
+				maxLatenessMs = jmax(maxLatenessMs, timer->GetMaxLatenessMs());
+			}
+			auto wakeupCount = scheduler->GetWakeupCount() - startWakeupCount;
+
+			logMessage(String(callbackCount) + " callbacks by " + String(scheduler->GetThreadCount()) + " threads in " + String(s_durationMs) + " ms, "
+				+ String(static_cast<int>(wakeupCount)) + " wakeups, "
+				+ "mean lateness " + String(callbackCount > 0 ? latenessSumMs / callbackCount : 0.0, 3) + " ms, "
+				+ "max lateness " + String(maxLatenessMs, 3) + " ms, "
+				+ String(overrunCount) + " overruns");
+			expectGreaterThan(callbackCount, 0);
+		}
+	}
+
+private:
+	/**
+	 * Timer that measures by how much each callback is later than its interval.
+	 */
+	class LatenessTimer : public TimerThreadBase
+	{
+	public:
+		explicit LatenessTimer(int callbackInterval) : m_callbackInterval(callbackInterval) {}
+		~LatenessTimer() override { stopTimerThread(); }
+
+		int GetCallbackCount() const { return m_callbackCount; }
+		double GetLatenessSumMs() const { return m_latenessSumMs; }
+		double GetMaxLatenessMs() const { return m_maxLatenessMs; }
+
+	protected:
+		void timerThreadCallback() override
+		{
+			auto now = Time::getMillisecondCounterHiRes();
+			if (m_lastCallbackTime > 0.0)
+			{
+				auto lateness = jmax(0.0, now - m_lastCallbackTime - m_callbackInterval);
+				m_latenessSumMs = m_latenessSumMs + lateness;
+				m_maxLatenessMs = jmax(m_maxLatenessMs.load(), lateness);
+				m_callbackCount++;
+			}
+			m_lastCallbackTime = now;
+		}
+
+	private:
+		int					m_callbackInterval{ 0 };
+		double				m_lastCallbackTime{ 0.0 };
+		std::atomic<int>	m_callbackCount{ 0 };
+		std::atomic<double>	m_latenessSumMs{ 0.0 };
+		std::atomic<double>	m_maxLatenessMs{ 0.0 };
+	};
+
+	static constexpr int s_callbackInterval = 20;
+	static constexpr int s_durationMs = 2000;
+};
+
+static TimerThreadSchedulerBenchmark timerThreadSchedulerBenchmark;
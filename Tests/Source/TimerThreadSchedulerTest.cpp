@@ -0,0 +1,182 @@
+/* Copyright (c) 2023, Christian Ahrens
+ *
+ * This file is part of RemoteProtocolBridgeCore <https://github.com/ChristianAhrens/RemoteProtocolBridgeCore>
+ *
+ * This library is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU Lesser General Public License version 3.0 as published
+ * by the Free Software Foundation.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more
+ * details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#include <JuceHeader.h>
+
+#include <TimerThreadBase.h>
+
+
+/**
+ * Unit tests for the TimerThreadBase callbacks as called by the shared TimerThreadScheduler.
+ */
+class TimerThreadSchedulerTest : public UnitTest
+{
+public:
+	TimerThreadSchedulerTest() : UnitTest("TimerThreadScheduler", "ProcessingEngine") {}
+
+	void runTest() override
+	{
+		beginTest("Callbacks are called at the interval");
+		{
+			CountingTimer timer;
+			timer.startTimerThread(10);
+			expect(timer.isTimerThreadRunning());
+			Thread::sleep(500);
+			timer.stopTimerThread();
+			expect(!timer.isTimerThreadRunning());
+
+			// generous bounds, to not fail on loaded machines
+			expectGreaterOrEqual(timer.GetCallbackCount(), 10);
+			expectLessOrEqual(timer.GetCallbackCount(), 60);
+		}
+
+		beginTest("No callback after stopping");
+		{
+			CountingTimer timer(20);
+			timer.startTimerThread(5);
+			Thread::sleep(100);
+			timer.stopTimerThread();
+			expect(!timer.IsInCallback(), "Stopping has to wait for a running callback");
+
+			auto callbackCount = timer.GetCallbackCount();
+			Thread::sleep(100);
+			expectEquals(timer.GetCallbackCount(), callbackCount);
+		}
+
+		beginTest("Initial callback offset");
+		{
+			CountingTimer timer;
+			timer.startTimerThread(10, 300);
+			Thread::sleep(150);
+			expectEquals(timer.GetCallbackCount(), 0);
+			Thread::sleep(300);
+			timer.stopTimerThread();
+			expectGreaterThan(timer.GetCallbackCount(), 0);
+		}
+
+		beginTest("Many timers share the scheduler threads");
+		{
+			std::vector<std::unique_ptr<CountingTimer>> timers;
+			for (auto i = 0; i < s_timerCount; i++)
+			{
+				timers.push_back(std::make_unique<CountingTimer>());
+				timers.back()->startTimerThread(10 + (i % 7), i % 10);
+			}
+
+			SharedResourcePointer<TimerThreadScheduler> scheduler;
+			expectLessOrEqual(scheduler->GetThreadCount(), 4);
+
+			Thread::sleep(300);
+			for (auto const& timer : timers)
+				timer->stopTimerThread();
+
+			for (auto const& timer : timers)
+				expectGreaterThan(timer->GetCallbackCount(), 0);
+		}
+
+		beginTest("Callbacks longer than the interval are counted as overruns");
+		{
+			CountingTimer timer(30);
+			timer.startTimerThread(10);
+			Thread::sleep(200);
+			timer.stopTimerThread();
+
+			expectGreaterThan(timer.GetCallbackCount(), 0);
+			// every callback exceeds the interval, so every callback but one still running when stopping is an overrun
+			expectGreaterOrEqual(timer.getTimerThreadOverrunCount(), timer.GetCallbackCount() - 1);
+			expectGreaterOrEqual(timer.getTimerThreadMaxCallbackDuration(), 29);
+		}
+
+		beginTest("Callbacks within the interval are not counted as overruns");
+		{
+			CountingTimer timer(1);
+			timer.startTimerThread(20);
+			Thread::sleep(200);
+			timer.stopTimerThread();
+
+			expectGreaterThan(timer.GetCallbackCount(), 0);
+			expectEquals(timer.getTimerThreadOverrunCount(), 0);
+		}
+
+		beginTest("Intervals beyond the first wheel level");
+		{
+			// 64 ms is the range of wheel level 0, so these timers are linked into level 1 and cascaded down
+			CountingTimer timer100;
+			CountingTimer timer300;
+			timer100.startTimerThread(100);
+			timer300.startTimerThread(300);
+
+			// the first callback is called right away, the second one only after the interval elapsed
+			Thread::sleep(60);
+			expectEquals(timer100.GetCallbackCount(), 1, "A timer must not be called again before its interval elapsed");
+
+			Thread::sleep(990);
+			timer100.stopTimerThread();
+			timer300.stopTimerThread();
+
+			// 11 and 4 callbacks are expected after 1050 ms, the bounds allow for delays on loaded machines
+			expectGreaterOrEqual(timer100.GetCallbackCount(), 9);
+			expectLessOrEqual(timer100.GetCallbackCount(), 12);
+			expectGreaterOrEqual(timer300.GetCallbackCount(), 3);
+			expectLessOrEqual(timer300.GetCallbackCount(), 5);
+		}
+
+		beginTest("Restart with a different interval");
+		{
+			CountingTimer timer;
+			timer.startTimerThread(1000);
+			timer.startTimerThread(10);
+			Thread::sleep(300);
+			timer.stopTimerThread();
+			expectGreaterThan(timer.GetCallbackCount(), 5, "Restarting has to replace the previous interval");
+		}
+	}
+
+private:
+	/**
+	 * Timer that counts its callbacks and optionally takes some time in each.
+	 */
+	class CountingTimer : public TimerThreadBase
+	{
+	public:
+		explicit CountingTimer(int callbackDurationMs = 0) : m_callbackDurationMs(callbackDurationMs) {}
+		~CountingTimer() override { stopTimerThread(); }
+
+		int GetCallbackCount() const { return m_callbackCount; }
+		bool IsInCallback() const { return m_isInCallback; }
+
+	protected:
+		void timerThreadCallback() override
+		{
+			m_isInCallback = true;
+			if (m_callbackDurationMs > 0)
+				Thread::sleep(m_callbackDurationMs);
+			m_callbackCount++;
+			m_isInCallback = false;
+		}
+
+	private:
+		int					m_callbackDurationMs{ 0 };
+		std::atomic<int>	m_callbackCount{ 0 };
+		std::atomic<bool>	m_isInCallback{ false };
+	};
+
+	static constexpr int s_timerCount = 64;
+};
+
+static TimerThreadSchedulerTest timerThreadSchedulerTest;